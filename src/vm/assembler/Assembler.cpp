@@ -200,6 +200,25 @@ void Assembler::emit_farith( std::int32_t b1, std::int32_t b2, std::int32_t i )
 }
 
 
+void Assembler::emit_sse( std::int32_t prefix, std::int32_t opcode, std::int32_t reg, std::int32_t rm )  {
+    // [prefix] 0F opcode [11 reg rm]
+    st_assert( 0 <= reg and reg < 8 and 0 <= rm and rm < 8, "illegal register" );
+    emit_byte( prefix );
+    emit_byte( 0x0F );
+    emit_byte( opcode );
+    emit_byte( 0xC0 | reg << 3 | rm );
+}
+
+
+void Assembler::emit_sse( std::int32_t prefix, std::int32_t opcode, std::int32_t reg, const Address &a )  {
+    // [prefix] 0F opcode [mod reg r/m] ...
+    emit_byte( prefix );
+    emit_byte( 0x0F );
+    emit_byte( opcode );
+    emit_operand( Register( reg, ' ' ), a );
+}
+
+
 void Assembler::pushad() {
     emit_byte( 0x60 );
 }
@@ -1227,3 +1246,119 @@ void Assembler::fnstsw_ax() {
 void Assembler::fwait() {
     emit_byte( 0x9B );
 }
+
+
+// SSE2 prefixes: F2 = scalar double, 66 = packed double/integer
+
+void Assembler::movsd( const XMMRegister &dst, const Address &src ) {
+    emit_sse( 0xF2, 0x10, dst.number(), src );
+}
+
+
+void Assembler::movsd( const Address &dst, const XMMRegister &src ) {
+    emit_sse( 0xF2, 0x11, src.number(), dst );
+}
+
+
+void Assembler::movsd( const XMMRegister &dst, const XMMRegister &src ) {
+    emit_sse( 0xF2, 0x10, dst.number(), src.number() );
+}
+
+
+void Assembler::addsd( const XMMRegister &dst, const XMMRegister &src ) {
+    emit_sse( 0xF2, 0x58, dst.number(), src.number() );
+}
+
+
+void Assembler::addsd( const XMMRegister &dst, const Address &src ) {
+    emit_sse( 0xF2, 0x58, dst.number(), src );
+}
+
+
+void Assembler::subsd( const XMMRegister &dst, const XMMRegister &src ) {
+    emit_sse( 0xF2, 0x5C, dst.number(), src.number() );
+}
+
+
+void Assembler::subsd( const XMMRegister &dst, const Address &src ) {
+    emit_sse( 0xF2, 0x5C, dst.number(), src );
+}
+
+
+void Assembler::mulsd( const XMMRegister &dst, const XMMRegister &src ) {
+    emit_sse( 0xF2, 0x59, dst.number(), src.number() );
+}
+
+
+void Assembler::mulsd( const XMMRegister &dst, const Address &src ) {
+    emit_sse( 0xF2, 0x59, dst.number(), src );
+}
+
+
+void Assembler::divsd( const XMMRegister &dst, const XMMRegister &src ) {
+    emit_sse( 0xF2, 0x5E, dst.number(), src.number() );
+}
+
+
+void Assembler::divsd( const XMMRegister &dst, const Address &src ) {
+    emit_sse( 0xF2, 0x5E, dst.number(), src );
+}
+
+
+void Assembler::sqrtsd( const XMMRegister &dst, const XMMRegister &src ) {
+    emit_sse( 0xF2, 0x51, dst.number(), src.number() );
+}
+
+
+void Assembler::ucomisd( const XMMRegister &dst, const XMMRegister &src ) {
+    emit_sse( 0x66, 0x2E, dst.number(), src.number() );
+}
+
+
+void Assembler::ucomisd( const XMMRegister &dst, const Address &src ) {
+    emit_sse( 0x66, 0x2E, dst.number(), src );
+}
+
+
+void Assembler::andpd( const XMMRegister &dst, const XMMRegister &src ) {
+    emit_sse( 0x66, 0x54, dst.number(), src.number() );
+}
+
+
+void Assembler::xorpd( const XMMRegister &dst, const XMMRegister &src ) {
+    emit_sse( 0x66, 0x57, dst.number(), src.number() );
+}
+
+
+void Assembler::pcmpeqd( const XMMRegister &dst, const XMMRegister &src ) {
+    emit_sse( 0x66, 0x76, dst.number(), src.number() );
+}
+
+
+void Assembler::psllq( const XMMRegister &dst, std::int32_t imm8 ) {
+    st_assert( 0 <= imm8 and imm8 < 64, "illegal shift count" );
+    emit_sse( 0x66, 0x73, 6, dst.number() );
+    emit_byte( imm8 );
+}
+
+
+void Assembler::psrlq( const XMMRegister &dst, std::int32_t imm8 ) {
+    st_assert( 0 <= imm8 and imm8 < 64, "illegal shift count" );
+    emit_sse( 0x66, 0x73, 2, dst.number() );
+    emit_byte( imm8 );
+}
+
+
+void Assembler::cvtsi2sd( const XMMRegister &dst, const Register &src ) {
+    emit_sse( 0xF2, 0x2A, dst.number(), src.number() );
+}
+
+
+void Assembler::cvtsi2sd( const XMMRegister &dst, const Address &src ) {
+    emit_sse( 0xF2, 0x2A, dst.number(), src );
+}
+
+
+void Assembler::cvttsd2si( const Register &dst, const XMMRegister &src ) {
+    emit_sse( 0xF2, 0x2C, dst.number(), src.number() );
+}
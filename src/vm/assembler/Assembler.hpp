@@ -85,6 +85,10 @@ protected:
 
     void emit_farith( std::int32_t b1, std::int32_t b2, std::int32_t i ) ;
 
+    void emit_sse( std::int32_t prefix, std::int32_t opcode, std::int32_t reg, std::int32_t rm ) ;
+
+    void emit_sse( std::int32_t prefix, std::int32_t opcode, std::int32_t reg, const Address &a ) ;
+
     void print( const Label &L ) const;
 
     void bind_to( Label &L, std::int32_t pos );
@@ -111,6 +115,8 @@ public:
         carryClear   = 0x3, //
         negative     = 0x8, //
         positive     = 0x9, //
+        parity       = 0xa, //
+        noParity     = 0xb, //
     };
 
     enum class Constants {
@@ -427,6 +433,52 @@ public:
 
     void fwait();
 
+    // SSE2 scalar double operations (UseSSE2)
+    // %note: in contrast to the FPU stack, the operands are explicit and the result is in dst
+    void movsd( const XMMRegister &dst, const Address &src );
+
+    void movsd( const Address &dst, const XMMRegister &src );
+
+    void movsd( const XMMRegister &dst, const XMMRegister &src );
+
+    void addsd( const XMMRegister &dst, const XMMRegister &src );
+
+    void addsd( const XMMRegister &dst, const Address &src );
+
+    void subsd( const XMMRegister &dst, const XMMRegister &src );
+
+    void subsd( const XMMRegister &dst, const Address &src );
+
+    void mulsd( const XMMRegister &dst, const XMMRegister &src );
+
+    void mulsd( const XMMRegister &dst, const Address &src );
+
+    void divsd( const XMMRegister &dst, const XMMRegister &src );
+
+    void divsd( const XMMRegister &dst, const Address &src );
+
+    void sqrtsd( const XMMRegister &dst, const XMMRegister &src );
+
+    void ucomisd( const XMMRegister &dst, const XMMRegister &src );
+
+    void ucomisd( const XMMRegister &dst, const Address &src );
+
+    void andpd( const XMMRegister &dst, const XMMRegister &src );
+
+    void xorpd( const XMMRegister &dst, const XMMRegister &src );
+
+    void pcmpeqd( const XMMRegister &dst, const XMMRegister &src );
+
+    void psllq( const XMMRegister &dst, std::int32_t imm8 );
+
+    void psrlq( const XMMRegister &dst, std::int32_t imm8 );
+
+    void cvtsi2sd( const XMMRegister &dst, const Register &src );
+
+    void cvtsi2sd( const XMMRegister &dst, const Address &src );
+
+    void cvttsd2si( const Register &dst, const XMMRegister &src );
+
 
     // For compatibility with old assembler only - should be removed at some point
     void Load( const Register &base, std::int32_t disp, const Register &dst ) {
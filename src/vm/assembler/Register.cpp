@@ -62,3 +62,52 @@ bool Register::operator==( const Register &rhs ) const {
 bool Register::operator!=( const Register &rhs ) const {
     return rhs._number != _number;
 }
+
+
+std::array<const char *, XMM_REGISTER_COUNT> xmmRegisterNames = {
+    "xmm0", //
+    "xmm1", //
+    "xmm2", //
+    "xmm3", //
+    "xmm4", //
+    "xmm5", //
+    "xmm6", //
+    "xmm7"  //
+};
+
+
+const char *XMMRegister::name() const {
+    return (const char *) ( isValid() ? xmmRegisterNames[ _number ] : "noxmmreg" );
+}
+
+
+XMMRegister::XMMRegister( void ) :
+    _number( -1 ) {
+}
+
+
+XMMRegister::XMMRegister( std::int32_t number, char f ) :
+    _number( number ) {
+    st_unused( f ); // unused
+}
+
+
+std::int32_t XMMRegister::number() const {
+    st_assert( isValid(), "not an xmm register" );
+    return _number;
+}
+
+
+bool XMMRegister::isValid() const {
+    return ( 0 <= _number ) and ( _number < XMM_REGISTER_COUNT );
+}
+
+
+bool XMMRegister::operator==( const XMMRegister &rhs ) const {
+    return rhs._number == _number;
+}
+
+
+bool XMMRegister::operator!=( const XMMRegister &rhs ) const {
+    return rhs._number != _number;
+}
@@ -10,6 +10,7 @@
 
 
 constexpr std::int32_t REGISTER_COUNT = 8;    // total number of registers
+constexpr std::int32_t XMM_REGISTER_COUNT = 8;    // total number of SSE registers
 
 
 class Register : public ValueObject {
@@ -54,3 +55,42 @@ const Register ebp = Register( 5, ' ' );   //
 const Register esi = Register( 6, ' ' );   //
 const Register edi = Register( 7, ' ' );   //
 const Register noreg;                               // Dummy register used in Load, LoadAddr, and Store.
+
+
+// SSE registers, used for scalar double arithmetic (UseSSE2)
+class XMMRegister : public ValueObject {
+
+private:
+    std::int32_t _number;
+
+public:
+    XMMRegister( void );
+
+    explicit XMMRegister( std::int32_t number, char f );
+
+    // attributes
+    std::int32_t number() const;
+
+
+    bool isValid() const;
+
+
+    bool operator==( const XMMRegister &rhs ) const;
+
+
+    bool operator!=( const XMMRegister &rhs ) const;
+
+
+    // debugging
+    const char *name() const;
+};
+
+
+const XMMRegister xmm0 = XMMRegister( 0, ' ' );   //
+const XMMRegister xmm1 = XMMRegister( 1, ' ' );   //
+const XMMRegister xmm2 = XMMRegister( 2, ' ' );   //
+const XMMRegister xmm3 = XMMRegister( 3, ' ' );   //
+const XMMRegister xmm4 = XMMRegister( 4, ' ' );   //
+const XMMRegister xmm5 = XMMRegister( 5, ' ' );   //
+const XMMRegister xmm6 = XMMRegister( 6, ' ' );   //
+const XMMRegister xmm7 = XMMRegister( 7, ' ' );   //
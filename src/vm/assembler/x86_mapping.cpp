@@ -292,6 +292,20 @@ void Mapping::fstore( const Location &dst, const Register &base ) {
 }
 
 
+void Mapping::fload( const Location &src, const Register &base, const XMMRegister &dst ) {
+    st_assert( isFloatTemporary( src ), "must be a float location" );
+    st_assert( ( src.offset() * OOP_SIZE ) % SIZEOF_FLOAT == 0, "float is not aligned" );
+    theMacroAssembler->movsd( dst, Address( base, src.offset() * OOP_SIZE ) );
+}
+
+
+void Mapping::fstore( const Location &dst, const Register &base, const XMMRegister &src ) {
+    st_assert( isFloatTemporary( dst ), "must be a float location" );
+    st_assert( ( dst.offset() * OOP_SIZE ) % SIZEOF_FLOAT == 0, "float is not aligned" );
+    theMacroAssembler->movsd( Address( base, dst.offset() * OOP_SIZE ), src );
+}
+
+
 void mapping_init() {
     SPDLOG_INFO( "system-init:  mapping_init" );
 
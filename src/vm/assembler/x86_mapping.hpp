@@ -99,6 +99,11 @@ public:
     static void fload( const Location &src, const Register &base );
 
     static void fstore( const Location &dst, const Register &base );
+
+    // same for SSE2 (UseSSE2): the value is loaded into/stored from an xmm register instead of ST
+    static void fload( const Location &src, const Register &base, const XMMRegister &dst );
+
+    static void fstore( const Location &dst, const Register &base, const XMMRegister &src );
 };
 
 
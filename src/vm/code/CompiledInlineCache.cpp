@@ -402,6 +402,20 @@ void CompiledInlineCache::replace( NativeMethod *nm ) {
 }
 
 
+bool CompiledInlineCache::calls_zombie() const {
+    if ( is_empty() or is_megamorphic() )
+        return false;
+    CompiledInlineCacheIterator it( (CompiledInlineCache *) this );
+    while ( not it.at_end() ) {
+        NativeMethod *nm = it.compiled_method();
+        if ( nm not_eq nullptr and nm->isZombie() )
+            return true;
+        it.advance();
+    }
+    return false;
+}
+
+
 void CompiledInlineCache::clear() {
     // Fix this when compiler is more flexible
     st_assert( not isSuperSend() or UseNewBackend, "We cannot yet have super sends in nativeMethods" );
@@ -495,7 +509,7 @@ void CompiledInlineCache::cleanup() {
         NativeMethod           *nm;
         PolymorphicInlineCache *result = p->cleanup( &nm );
         if ( result not_eq p ) {
-            if ( p not_eq nullptr ) {
+            if ( result not_eq nullptr ) {
                 // still POLYMORPHIC
                 set_call_destination( result->entry() );
             } else {
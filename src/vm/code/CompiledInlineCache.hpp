@@ -223,6 +223,8 @@ public:
     void clear();        // clear inline cache
     void cleanup();        // cleanup inline cache
 
+    bool calls_zombie() const;    // does one of the targets (or PolymorphicInlineCache entries) call a zombie NativeMethod?
+
     bool verify();
 
     void print();
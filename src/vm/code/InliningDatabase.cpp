@@ -28,6 +28,7 @@ InliningDatabaseKey *InliningDatabase::_table = nullptr;
 std::uint32_t            InliningDatabase::_table_size      = 0;
 std::uint32_t            InliningDatabase::_table_size_mask = 0;
 std::uint32_t            InliningDatabase::_table_no        = 0;
+std::uint32_t            InliningDatabase::_table_cursor    = 0;
 
 
 const char *InliningDatabase::default_directory() {
@@ -706,20 +707,25 @@ void InliningDatabase::reset_lookup_table() {
     _table_size      = 0;
     _table_size_mask = 0;
     _table_no        = 0;
+    _table_cursor    = 0;
 }
 
 
 RecompilationScope *InliningDatabase::select_and_remove( bool *end_of_table ) {
 
     if ( _table_no == 0 ) {
+        *end_of_table = true;
         return nullptr;
     }
 
-    for ( std::uint32_t index = 0; index < _table_size; index++ ) {
+    // continue where the last call stopped, so that draining the table is linear in its size
+    for ( std::uint32_t n = 0; n < _table_size; n++ ) {
+        std::uint32_t index = ( _table_cursor + n ) & _table_size_mask;
         if ( _table[ index ].is_filled() and _table[ index ].is_outer() ) {
             RecompilationScope *result = file_in( &_table[ index ]._outer );
             _table[ index ].set_deleted();
             _table_no--;
+            _table_cursor = next_index( index );
             *end_of_table = false;
             return result;
         }
@@ -740,6 +746,7 @@ void InliningDatabase::allocate_table( std::uint32_t size ) {
     _table_size      = size;
     _table_size_mask = size - 1;
     _table_no        = 0;
+    _table_cursor    = 0;
     _table           = new_c_heap_array<InliningDatabaseKey>( _table_size );
 
     for ( std::uint32_t index = 0; index < _table_size; index++ ) {
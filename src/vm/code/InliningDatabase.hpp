@@ -106,6 +106,7 @@ private:
     static std::uint32_t       _table_size;      // Size of table power of 2
     static std::uint32_t       _table_size_mask; // nthMask(table_size)
     static std::uint32_t       _table_no;        // Number of elements in the table
+    static std::uint32_t       _table_cursor;    // Where select_and_remove continues its scan
 
 public:
     // Accessor for the root of the database
@@ -4,6 +4,7 @@
 //
 
 #include "vm/code/NativeMethod.hpp"
+#include "vm/code/PolymorphicInlineCache.hpp"
 #include "vm/code/ProgramCounterDescriptor.hpp"
 #include "vm/code/StubRoutines.hpp"
 #include "vm/compiler/Compiler.hpp"
@@ -31,6 +32,7 @@ static std::int32_t instruction_length;
 static std::int32_t location_length;
 static std::int32_t scope_length;
 static std::int32_t nof_noninlined_blocks;
+static bool         is_hot;
 
 
 NativeMethod *new_nativeMethod( Compiler *c ) {
@@ -40,6 +42,7 @@ NativeMethod *new_nativeMethod( Compiler *c ) {
     location_length       = roundTo( c->code()->reloc_size(), OOP_SIZE );
     scope_length          = roundTo( c->scopeDescRecorder()->size(), OOP_SIZE );
     nof_noninlined_blocks = c->number_of_noninlined_blocks();
+    is_hot                = c->version() > 0 and not c->is_database_compile();  // recompiled, so the method is known to be hot
 
     NativeMethod *nm = new NativeMethod( c );
     if ( c->is_method_compile() ) {
@@ -56,7 +59,7 @@ void *NativeMethod::operator new( std::size_t size ) {
     st_assert( sizeof( NativeMethod ) % OOP_SIZE == 0, "NativeMethod size must be multiple of a word" );
     std::int32_t nativeMethod_size = sizeof( NativeMethod ) + instruction_length + location_length + scope_length + roundTo( ( nof_noninlined_blocks ) * sizeof( std::uint16_t ), OOP_SIZE );
 
-    void *p = Universe::code->allocate( nativeMethod_size );
+    void *p = Universe::code->allocate( nativeMethod_size, is_hot );
     if ( not p ) {
         st_fatal( "out of Space in code cache" );
     }
@@ -322,6 +325,16 @@ void NativeMethod::clear_inline_caches() {
 }
 
 
+void NativeMethod::clear_zombie_inline_caches() {
+    RelocationInformationIterator iter( this );
+    while ( iter.next() ) {
+        if ( iter.type() == RelocationInformation::RelocationType::ic_type and iter.ic()->calls_zombie() ) {
+            iter.ic()->clear();
+        }
+    }
+}
+
+
 void NativeMethod::cleanup_inline_caches() {
     // Ignore zombies
     if ( isZombie() )
@@ -337,6 +350,18 @@ void NativeMethod::cleanup_inline_caches() {
 }
 
 
+void NativeMethod::decay_inline_cache_counts( double decay_factor ) {
+    RelocationInformationIterator iter( this );
+    while ( iter.next() ) {
+        if ( iter.type() == RelocationInformation::RelocationType::ic_type ) {
+            PolymorphicInlineCache *pic = iter.ic()->pic();
+            if ( pic not_eq nullptr )
+                pic->decay_counts( decay_factor );
+        }
+    }
+}
+
+
 void NativeMethod::makeOld() {
     //SPDLOG_INFO( "marking NativeMethod 0x{0:x} as old", static_cast<const void *>( this ) );
     _nativeMethodFlags.isYoung = 0;
@@ -1043,6 +1068,7 @@ void NativeMethod::sweeper_step( double decay_factor ) {
         return;
     decay_invocation_count( decay_factor );
     _uncommonTrapCounter = std::int32_t( _uncommonTrapCounter / decay_factor );
+    decay_inline_cache_counts( decay_factor );
     cleanup_inline_caches();
     incrementAge();
 }
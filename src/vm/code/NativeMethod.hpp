@@ -350,6 +350,8 @@ public:
 
     void clear_inline_caches();
 
+    void clear_zombie_inline_caches();  // clears only the inline caches calling zombies
+
     void cleanup_inline_caches();
 
     void forwardLinkedSends( NativeMethod *to );
@@ -486,6 +488,8 @@ public:
 private:
     inline void decay_invocation_count( double decay_factor );
 
+    void decay_inline_cache_counts( double decay_factor );    // the hit counters of the PICs
+
 public:
     static std::int32_t invocationCountOffset() {
         return (std::int32_t) &( (NativeMethod *) 0 )->_invocationCount;
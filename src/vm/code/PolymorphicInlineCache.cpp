@@ -11,6 +11,7 @@
 #include "vm/oop/SymbolOopDescriptor.hpp"
 #include "vm/oop/KlassOopDescriptor.hpp"
 #include "vm/runtime/ResourceMark.hpp"
+#include "vm/runtime/flags.hpp"
 
 // A PolymorphicInlineCache implements a Polymorphic Inline Cache for compiled code.
 //
@@ -26,57 +27,83 @@
 // Layout a)		(methodOop entries only)
 //
 //  0			: call PolymorphicInlineCache stub routine
-//  5			: m methodOop entries a 8 bytes each
-//  5 + m*8		: <end of PolymorphicInlineCache>
+//  5			: m methodOop entries a 12 bytes each
+//  5 + m*12		: <end of PolymorphicInlineCache>
 //
 // i.th methodOop entry (0 <= i < m; m > 0)
 //
-//  5 + i*8		: klass(i)
-//  9 + i*8		: methodOop(i)
+//  5 + i*12		: klass(i)
+//  9 + i*12		: methodOop(i)
+// 13 + i*12		: address of counter(i)
 //
 //
 // Layout b)		(NativeMethod & methodOop entries)
 //
 //  0			: test al, MEMOOP_TAG
-//  2			: jz smi_nativeMethod/jz methodOop call stub/jz cache_miss
+//  2			: jz smi entry/jz methodOop call stub/jz cache_miss
 //  8			: mov edx, [eax.klass] (always here to simplify iteration, even if n = 0)
-// 11			: n NativeMethod entries a 12 bytes each
-// 11 + n*12		: call PolymorphicInlineCache stub routine (m > 0)/jmp cache_miss (m = 0)
-// 16 + n*12		: m methodOop entries a 8 bytes each
-// 16 + n*12 + m*8	: <end of PolymorphicInlineCache>
+// 11			: n NativeMethod entries a 19 bytes each
+// 11 + n*19		: call PolymorphicInlineCache stub routine (m > 0)/jmp cache_miss (m = 0)
+// 16 + n*19		: m methodOop entries a 12 bytes each
+// 16 + n*19 + m*12	: smi entry (if the small_int_t target is an NativeMethod), 11 bytes
+//			: <end of PolymorphicInlineCache>
 //
 // i.th NativeMethod entry (0 <= i < n; n >= 0):
 //
-// 11 + i*12		: cmp edx, klass(i)
-// 11 + i*12 + 6	: je NativeMethod(i)
+// 11 + i*19		: cmp edx, klass(i)
+// 11 + i*19 + 6	: jne next entry
+// 11 + i*19 + 8	: inc [counter(i)]
+// 11 + i*19 + 14	: jmp NativeMethod(i)
 //
 // i.th methodOop (0 <= i < m; m >= 0):
 //
-// 16 + n*12 + i*8	: klass
-// 16 + n*12 + i*8 + 4	: methodOop
+// 16 + n*19 + i*12	: klass
+// 16 + n*19 + i*12 + 4	: methodOop
+// 16 + n*19 + i*12 + 8	: address of counter
 //
+// smi entry:
 //
-// Layout c)		(MEGAMORPHIC inline cache, selector only)
+//  0			: inc [counter]
+//  6			: jmp smi_nativeMethod
+//
+//
+// Layout c)		(MEGAMORPHIC inline cache, selector & table)
 //
 //  0			: call MIC stub routine
 //  5			: selector
-//  9			: <end of MIC>
+//  9			: t table entries a 8 bytes each (t = MegamorphicInlineCache_table_size)
+//  9 + t*8		: <end of MIC>
+//
+// i.th table entry (0 <= i < t):
+//
+//  9 + i*8		: klass(i) (nullptr if the entry is empty)
+//  9 + i*8 + 4		: methodOop(i) or NativeMethod entry point(i)
 //
 // The PolymorphicInlineCache stub routine interprets the remaining entries of the PolymorphicInlineCache; there
 // are different stub routines for different m (starting point for interpretation
 // is the return address). Entries for smis are treated especially in the sense
 // that an initial check for them is always there.
 //
+// Every entry counts its hits in a counter of its own. The counters are kept in the C heap
+// (PolymorphicInlineCache::_counts), away from the code, so that incrementing them doesn't
+// write into the instruction cache lines. The sweeper decays them like the invocation
+// counters of nativeMethods, and cleanup() re-emits a PolymorphicInlineCache whose entries are
+// no longer ordered by their counts, so the most frequent receiver klasses are tested first.
+// The counts are also the send counts RecompilationScopes use for the targets of a PolymorphicInlineCache.
+//
 // NB: The reason for interpreting the interpreter entries is Space, a smallest
 // native code implementation for these cases requires 18 bytes per entry (cmp,
 // je and load of methodOop). Furthermore, in each case it would be necessary
 // to call a stub routine to setup an interpreter frame anyway.
 //
-// The MIC stub routine interprets the one entry in the MIC. In case of a miss,
-// no new PolymorphicInlineCache/MIC is generated but the current entries are updated. The reason
-// for having a specialized PolymorphicInlineCache allocated in the MIC case is only so the selector
-// can be stored. It is used for fast lookup (usually the selector is recomputed
-// via debug-info from the corresponding interpreted method).
+// The MIC stub routine probes the table of the MIC, a small direct-mapped cache indexed by the
+// receiver klass (see MegamorphicInlineCache_index), and only on a miss the global LookupCache,
+// using the selector stored in the MIC (usually the selector is recomputed via debug-info from
+// the corresponding interpreted method). A hit in the LookupCache is copied into the table, so
+// the targets of a hot MEGAMORPHIC send site stay in its own table and are not evicted by other
+// send sites whose keys hash to the same LookupCache entries. No new PolymorphicInlineCache/MIC
+// is ever generated; the table entries are cleared together with the LookupCache entries (see
+// flush_megamorphic_table).
 
 
 // Opcodes for code pattern generation/parsing
@@ -86,6 +113,8 @@ static const char             jmp_opcode      = '\xe9';
 static const std::uint16_t    jz_opcode       = 0x840f;
 static const std::uint16_t    mov_opcode      = 0x508b;
 static const std::uint16_t    cmp_opcode      = 0xfa81;
+static const char             jne_opcode      = '\x75';  // jne rel8
+static const std::uint16_t    inc_opcode      = 0x05ff;  // inc [abs32]
 static constexpr std::int32_t cmp_opcode_size = sizeof( std::uint16_t );
 
 
@@ -114,6 +143,14 @@ static inline void put_disp( char *&p, const char *d ) {
 }
 
 
+// allocates the next hit counter, initialized to count, and puts its address
+static inline void put_counter( char *&p, std::int32_t *&counts, std::int32_t count ) {
+    *counts = count;
+    put_word( p, (std::int32_t) counts );
+    counts++;
+}
+
+
 // -----------------------------------------------------------------------------
 
 static inline std::int32_t get_shrt( const char *p ) {
@@ -126,6 +163,11 @@ static inline const char *get_disp( const char *p ) {
 }
 
 
+static inline std::int32_t *get_counter( const char *p ) {
+    return *(std::int32_t **) p;
+}
+
+
 // -----------------------------------------------------------------------------
 
 
@@ -133,22 +175,31 @@ static inline const char *get_disp( const char *p ) {
 class PolymorphicInlineCacheContents {
 public:
     // small_int_t case
-    char      *smi_nativeMethod;
-    MethodOop smi_methodOop;
+    char         *smi_nativeMethod;
+    MethodOop    smi_methodOop;
+    std::int32_t smi_count;
 
     // NativeMethod entries
     KlassOop     nativeMethod_klasses[static_cast<std::int32_t>(PolymorphicInlineCache::Constant::max_nof_entries)];
     char         *nativeMethods[static_cast<std::int32_t>(PolymorphicInlineCache::Constant::max_nof_entries)];
+    std::int32_t nativeMethod_counts[static_cast<std::int32_t>(PolymorphicInlineCache::Constant::max_nof_entries)];
     std::int32_t n;    // nativeMethods index
 
     // methodOop entries
     KlassOop     methodOop_klasses[static_cast<std::int32_t>(PolymorphicInlineCache::Constant::max_nof_entries)];
     MethodOop    methodOops[static_cast<std::int32_t>(PolymorphicInlineCache::Constant::max_nof_entries)];
+    std::int32_t methodOop_counts[static_cast<std::int32_t>(PolymorphicInlineCache::Constant::max_nof_entries)];
     std::int32_t m;    // methodOops index
 
-    void append_NativeMethod_entry( KlassOop klass, char *entry );
+    void append_NativeMethod_entry( KlassOop klass, char *entry, std::int32_t count = 0 );
 
-    void append_method( KlassOop klass, MethodOop method );
+    void append_method( KlassOop klass, MethodOop method, std::int32_t count = 0 );
+
+    // appends the entry the iterator is at, with its hit count
+    void append_entry( PolymorphicInlineCacheIterator *it );
+
+    // orders the NativeMethod and the methodOop entries by decreasing hit counts (the small_int_t case is tested separately)
+    void sort_by_counts();
 
 
     std::int32_t number_of_compiled_targets() const {
@@ -179,7 +230,8 @@ public:
     std::int32_t code_size() const {
         std::int32_t methodOop_size = number_of_interpreted_targets() * static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_methodOop_entry_size );
         if ( has_nativeMethods() ) {
-            return static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_methodOop_entry_offset ) + n * static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_entry_size ) + methodOop_size;
+            std::int32_t smi_size = smi_nativeMethod ? static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_smi_entry_size ) : 0;
+            return static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_methodOop_entry_offset ) + n * static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_entry_size ) + methodOop_size + smi_size;
         } else {
             return static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_methodOop_only_offset ) + methodOop_size;
         }
@@ -190,6 +242,7 @@ public:
     PolymorphicInlineCacheContents() :
         smi_nativeMethod{ nullptr },
         smi_methodOop{ nullptr },
+        smi_count{ 0 },
         n{ 0 },
         m{ 0 } {
     }
@@ -198,33 +251,80 @@ public:
 };
 
 
-void PolymorphicInlineCacheContents::append_NativeMethod_entry( KlassOop klass, char *entry ) {
+void PolymorphicInlineCacheContents::append_NativeMethod_entry( KlassOop klass, char *entry, std::int32_t count ) {
     // add new entry
     if ( klass == smiKlassObject ) {
         st_assert( not has_smi_case(), "cannot overwrite small_int_t case" );
         smi_nativeMethod = entry;
+        smi_count        = count;
     } else {
         nativeMethod_klasses[ n ] = klass;
         nativeMethods[ n ]        = entry;
+        nativeMethod_counts[ n ]  = count;
         n++;
     }
 }
 
 
-void PolymorphicInlineCacheContents::append_method( KlassOop klass, MethodOop method ) {
+void PolymorphicInlineCacheContents::append_method( KlassOop klass, MethodOop method, std::int32_t count ) {
     // add new entry
     st_assert( method->is_method(), "must be methodOop" );
     if ( klass == smiKlassObject ) {
         st_assert( not has_smi_case(), "cannot overwrite small_int_t case" );
         smi_methodOop = method;
+        smi_count     = count;
     } else {
         methodOop_klasses[ m ] = klass;
         methodOops[ m ]        = method;
+        methodOop_counts[ m ]  = count;
         m++;
     }
 }
 
 
+void PolymorphicInlineCacheContents::append_entry( PolymorphicInlineCacheIterator *it ) {
+    if ( it->is_interpreted() ) {
+        append_method( it->get_klass(), it->interpreted_method(), it->hit_count() );
+    } else {
+        append_NativeMethod_entry( it->get_klass(), it->get_call_addr(), it->hit_count() );
+    }
+}
+
+
+void PolymorphicInlineCacheContents::sort_by_counts() {
+    // insertion sort, stable so that equally frequent entries keep their order
+    for ( std::int32_t i = 1; i < n; i++ ) {
+        KlassOop     klass = nativeMethod_klasses[ i ];
+        char         *nm   = nativeMethods[ i ];
+        std::int32_t count = nativeMethod_counts[ i ];
+        std::int32_t j     = i;
+        for ( ; j > 0 and nativeMethod_counts[ j - 1 ] < count; j-- ) {
+            nativeMethod_klasses[ j ] = nativeMethod_klasses[ j - 1 ];
+            nativeMethods[ j ]        = nativeMethods[ j - 1 ];
+            nativeMethod_counts[ j ]  = nativeMethod_counts[ j - 1 ];
+        }
+        nativeMethod_klasses[ j ] = klass;
+        nativeMethods[ j ]        = nm;
+        nativeMethod_counts[ j ]  = count;
+    }
+
+    for ( std::int32_t i = 1; i < m; i++ ) {
+        KlassOop     klass  = methodOop_klasses[ i ];
+        MethodOop    method = methodOops[ i ];
+        std::int32_t count  = methodOop_counts[ i ];
+        std::int32_t j      = i;
+        for ( ; j > 0 and methodOop_counts[ j - 1 ] < count; j-- ) {
+            methodOop_klasses[ j ] = methodOop_klasses[ j - 1 ];
+            methodOops[ j ]        = methodOops[ j - 1 ];
+            methodOop_counts[ j ]  = methodOop_counts[ j - 1 ];
+        }
+        methodOop_klasses[ j ] = klass;
+        methodOops[ j ]        = method;
+        methodOop_counts[ j ]  = count;
+    }
+}
+
+
 // Implementation of PolymorphicInlineCache_Iterators
 
 PolymorphicInlineCacheIterator::PolymorphicInlineCacheIterator( PolymorphicInlineCache *pic ) :
@@ -252,7 +352,7 @@ PolymorphicInlineCacheIterator::PolymorphicInlineCacheIterator( PolymorphicInlin
     } else {
         // nativeMethods -> handle smis first
         const char *dest = get_disp( _pos + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_smi_nativeMethodOffset ) );
-        if ( dest == CompiledInlineCache::normalLookupRoutine() or _pic->contains( dest ) ) {
+        if ( dest == CompiledInlineCache::normalLookupRoutine() or *dest == call_opcode ) {
             // no smis or small_int_t case is treated in methodOop section
             _state = InlineState::AT_NATIVE_METHOD;
             _pos += static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_entry_offset );
@@ -324,8 +424,7 @@ std::int32_t *PolymorphicInlineCacheIterator::nativeMethod_disp_addr() const {
     std::int32_t offs{ 0 };
     switch ( state() ) {
         case InlineState::AT_SMI_NATIVE_METHOD:
-            offs = static_cast<std::int32_t>(PolymorphicInlineCache::Constant::PolymorphicInlineCache_smi_nativeMethodOffset);
-            break;
+            return (std::int32_t *) ( smi_entry() + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_smi_entry_nativeMethodOffset ) );
         case InlineState::AT_NATIVE_METHOD:
             offs = static_cast<std::int32_t>(PolymorphicInlineCache::Constant::PolymorphicInlineCache_nativeMethodOffset);
             break;
@@ -337,6 +436,32 @@ std::int32_t *PolymorphicInlineCacheIterator::nativeMethod_disp_addr() const {
 }
 
 
+const char *PolymorphicInlineCacheIterator::smi_entry() const {
+    st_assert( state() == InlineState::AT_SMI_NATIVE_METHOD, "no smi entry" );
+    return get_disp( _pic->entry() + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_smi_nativeMethodOffset ) );
+}
+
+
+std::int32_t *PolymorphicInlineCacheIterator::count_addr() const {
+    switch ( state() ) {
+        case InlineState::AT_SMI_NATIVE_METHOD:
+            return get_counter( smi_entry() + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_smi_counter_offset ) );
+        case InlineState::AT_NATIVE_METHOD:
+            return get_counter( _pos + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_counter_offset ) );
+        case InlineState::AT_METHOD_OOP:
+            return get_counter( _pos + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_methodOop_counter_offset ) );
+        case InlineState::AT_THE_END: ShouldNotCallThis();            // no entry -> no counter
+        default: ShouldNotReachHere();
+    }
+    return nullptr;
+}
+
+
+std::int32_t PolymorphicInlineCacheIterator::hit_count() const {
+    return *count_addr();
+}
+
+
 MethodOop *PolymorphicInlineCacheIterator::methodOop_addr() const {
     std::int32_t offs{ 0 };
     switch ( state() ) {
@@ -447,6 +572,59 @@ SymbolOop *PolymorphicInlineCache::MegamorphicInlineCache_selector_address() con
 }
 
 
+std::int32_t PolymorphicInlineCache::MegamorphicInlineCache_index( KlassOop klass ) {
+    // must match the hash computed by StubRoutines::generate_megamorphic_ic
+    return ( (std::uint32_t) klass >> 2 ) & ( static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_table_size ) - 1 );
+}
+
+
+KlassOop *PolymorphicInlineCache::MegamorphicInlineCache_klass_address( std::int32_t index ) const {
+    st_assert( is_megamorphic(), "not a MIC" );
+    st_assert( 0 <= index and index < static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_table_size ), "index out of bounds" );
+    return (KlassOop *) ( entry() + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_table_offset ) + index * static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_entry_size ) + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_entry_klass_offset ) );
+}
+
+
+Oop *PolymorphicInlineCache::MegamorphicInlineCache_target_address( std::int32_t index ) const {
+    st_assert( is_megamorphic(), "not a MIC" );
+    st_assert( 0 <= index and index < static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_table_size ), "index out of bounds" );
+    return (Oop *) ( entry() + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_table_offset ) + index * static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_entry_size ) + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_entry_target_offset ) );
+}
+
+
+Oop PolymorphicInlineCache::MegamorphicInlineCache_lookup( KlassOop klass ) const {
+    // same probe as StubRoutines::generate_megamorphic_ic
+    std::int32_t index = MegamorphicInlineCache_index( klass );
+    if ( *MegamorphicInlineCache_klass_address( index ) not_eq klass )
+        return nullptr;
+    return *MegamorphicInlineCache_target_address( index );
+}
+
+
+void PolymorphicInlineCache::flush_megamorphic_table( LookupKey *key ) {
+    if ( not is_megamorphic() )
+        return;
+
+    if ( key == nullptr ) {
+        for ( std::int32_t i = 0; i < static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_table_size ); i++ ) {
+            *MegamorphicInlineCache_klass_address( i )  = nullptr;
+            *MegamorphicInlineCache_target_address( i ) = nullptr;
+        }
+        return;
+    }
+
+    // MICs are never used for super sends, so only normal lookup keys can be cached
+    if ( not key->is_normal_type() or key->selector() not_eq *MegamorphicInlineCache_selector_address() )
+        return;
+
+    if ( MegamorphicInlineCache_lookup( key->klass() ) not_eq nullptr ) {
+        std::int32_t index = MegamorphicInlineCache_index( key->klass() );
+        *MegamorphicInlineCache_klass_address( index )  = nullptr;
+        *MegamorphicInlineCache_target_address( index ) = nullptr;
+    }
+}
+
+
 PolymorphicInlineCache *PolymorphicInlineCache::replace( NativeMethod *nm ) {
     // nothing to do in MEGAMORPHIC case
     if ( is_megamorphic() )
@@ -476,13 +654,9 @@ PolymorphicInlineCache *PolymorphicInlineCache::replace( NativeMethod *nm ) {
         while ( not it.at_end() ) {
             KlassOop receiver_klass = it.get_klass();
             if ( receiver_klass == nm->_lookupKey.klass() ) {
-                contents.append_NativeMethod_entry( nm->_lookupKey.klass(), nm->verifiedEntryPoint() );
+                contents.append_NativeMethod_entry( nm->_lookupKey.klass(), nm->verifiedEntryPoint(), it.hit_count() );
             } else {
-                if ( it.is_interpreted() ) {
-                    contents.append_method( it.get_klass(), it.interpreted_method() );
-                } else {
-                    contents.append_NativeMethod_entry( it.get_klass(), it.get_call_addr() );
-                }
+                contents.append_entry( &it );
             }
             it.advance();
         }
@@ -510,22 +684,23 @@ PolymorphicInlineCache *PolymorphicInlineCache::cleanup( NativeMethod **nm ) {
     PolymorphicInlineCacheIterator it( this );
     while ( not it.at_end() ) {
 //        KlassOop receiver_klass = it.get_klass();
+        std::int32_t count = it.hit_count();
 
         if ( it.is_interpreted() ) {
             // Interpreted methodOop
             if ( compiled_ic()->isSuperSend() ) {
-                contents.append_method( it.get_klass(), it.interpreted_method() );
+                contents.append_method( it.get_klass(), it.interpreted_method(), count );
             } else {
                 LookupKey    key( it.get_klass(), it.interpreted_method()->selector() );
                 LookupResult result = LookupCache::lookup( &key );
                 if ( result.matches( it.interpreted_method() ) ) {
-                    contents.append_method( it.get_klass(), it.interpreted_method() );
+                    contents.append_method( it.get_klass(), it.interpreted_method(), count );
                 } else {
                     if ( result.is_method() ) {
-                        contents.append_method( it.get_klass(), result.method() );
+                        contents.append_method( it.get_klass(), result.method(), count );
                         it.set_methodOop( result.method() );
                     } else if ( result.is_entry() ) {
-                        contents.append_NativeMethod_entry( it.get_klass(), result.get_nativeMethod()->verifiedEntryPoint() );
+                        contents.append_NativeMethod_entry( it.get_klass(), result.get_nativeMethod()->verifiedEntryPoint(), count );
                         pic_layout_has_changed = true;
                     } else {
                         pic_layout_has_changed = true;
@@ -537,13 +712,13 @@ PolymorphicInlineCache *PolymorphicInlineCache::cleanup( NativeMethod **nm ) {
             NativeMethod *nm    = it.compiled_method();
             LookupResult result = LookupCache::lookup( &nm->_lookupKey );
             if ( result.matches( nm ) ) {
-                contents.append_NativeMethod_entry( it.get_klass(), it.get_call_addr() );
+                contents.append_NativeMethod_entry( it.get_klass(), it.get_call_addr(), count );
             } else {
                 if ( result.is_method() ) {
-                    contents.append_method( it.get_klass(), result.method() );
+                    contents.append_method( it.get_klass(), result.method(), count );
                     pic_layout_has_changed = true;
                 } else if ( result.is_entry() ) {
-                    contents.append_NativeMethod_entry( it.get_klass(), result.get_nativeMethod()->verifiedEntryPoint() );
+                    contents.append_NativeMethod_entry( it.get_klass(), result.get_nativeMethod()->verifiedEntryPoint(), count );
                     it.set_nativeMethod( result.get_nativeMethod() );
                 } else {
                     pic_layout_has_changed = true;
@@ -554,6 +729,11 @@ PolymorphicInlineCache *PolymorphicInlineCache::cleanup( NativeMethod **nm ) {
     }
 
     *nm = nullptr;
+    if ( not pic_layout_has_changed and is_badly_ordered( &contents ) ) {
+        // the receiver klasses have changed frequencies; test the frequent ones first
+        pic_layout_has_changed = true;
+    }
+
     if ( pic_layout_has_changed ) {
 
         if ( contents.number_of_targets() == 0 ) {
@@ -568,6 +748,7 @@ PolymorphicInlineCache *PolymorphicInlineCache::cleanup( NativeMethod **nm ) {
             return nullptr;
         }
 
+        contents.sort_by_counts();
         std::int32_t allocated_code_size = contents.code_size();
         return new( allocated_code_size ) PolymorphicInlineCache( _ic, &contents, allocated_code_size );
     }
@@ -577,6 +758,23 @@ PolymorphicInlineCache *PolymorphicInlineCache::cleanup( NativeMethod **nm ) {
 }
 
 
+bool PolymorphicInlineCache::is_badly_ordered( PolymorphicInlineCacheContents *c ) {
+    // An entry is out of place if it has been hit more than twice as often as an entry tested before it;
+    // smaller differences (and small counts) are not worth a new PolymorphicInlineCache.
+    constexpr std::int32_t min_count = 16;
+
+    for ( std::int32_t i = 1; i < c->n; i++ ) {
+        if ( c->nativeMethod_counts[ i ] >= min_count and c->nativeMethod_counts[ i ] > 2 * c->nativeMethod_counts[ i - 1 ] )
+            return true;
+    }
+    for ( std::int32_t i = 1; i < c->m; i++ ) {
+        if ( c->methodOop_counts[ i ] >= min_count and c->methodOop_counts[ i ] > 2 * c->methodOop_counts[ i - 1 ] )
+            return true;
+    }
+    return false;
+}
+
+
 std::int32_t PolymorphicInlineCache::nof_entries( const char *pic_stub ) {
     std::int32_t i = 1;
     while ( true ) {
@@ -590,7 +788,7 @@ std::int32_t PolymorphicInlineCache::nof_entries( const char *pic_stub ) {
 }
 
 
-std::int32_t PolymorphicInlineCache::code_for_methodOops_only( const char *entry, PolymorphicInlineCacheContents *c ) {
+std::int32_t PolymorphicInlineCache::code_for_methodOops_only( const char *entry, PolymorphicInlineCacheContents *c, std::int32_t *&counts ) {
     char *p = const_cast<char *>(entry);
     put_byte( p, call_opcode );
     if ( c->smi_methodOop == nullptr ) {
@@ -603,6 +801,7 @@ std::int32_t PolymorphicInlineCache::code_for_methodOops_only( const char *entry
         put_disp( p, StubRoutines::PolymorphicInlineCache_stub_entry( 1 + c->m ) );
         put_word( p, std::int32_t( smiKlassObject ) );
         put_word( p, std::int32_t( c->smi_methodOop ) );
+        put_counter( p, counts, c->smi_count );
         st_assert( entry + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_methodOop_only_offset ) + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_methodOop_entry_size ) == p, "constant value inconsistent with code pattern" );
 
     }
@@ -612,6 +811,7 @@ std::int32_t PolymorphicInlineCache::code_for_methodOops_only( const char *entry
         st_assert( c->methodOop_klasses[ i ] not_eq smiKlassObject, "should not be smiKlassObject" );
         put_word( p, std::int32_t( c->methodOop_klasses[ i ] ) );
         put_word( p, std::int32_t( c->methodOops[ i ] ) );
+        put_counter( p, counts, c->methodOop_counts[ i ] );
     }
 
     st_assert( p1 + c->m * static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_methodOop_entry_size ) == p, "constant value inconsistent with code pattern" );
@@ -619,21 +819,24 @@ std::int32_t PolymorphicInlineCache::code_for_methodOops_only( const char *entry
 }
 
 
-std::int32_t PolymorphicInlineCache::code_for_polymorphic_case( char *entry, PolymorphicInlineCacheContents *c ) {
+std::int32_t PolymorphicInlineCache::code_for_polymorphic_case( char *entry, PolymorphicInlineCacheContents *c, std::int32_t *&counts ) {
 
     if ( c->has_nativeMethods() ) {
         // nativeMethods & methodOops
         // test al, MEMOOP_TAG
 
-        char *p     = entry;
-        char *fixup = nullptr;
+        char *p         = entry;
+        char *fixup     = nullptr;
+        char *smi_fixup = nullptr;
         put_byte( p, test_opcode );
         put_byte( p, MEMOOP_TAG );
         // jz ...
         put_shrt( p, jz_opcode );
         if ( c->smi_nativeMethod not_eq nullptr ) {
             st_assert( c->smi_methodOop == nullptr, "can only have one method for smis" );
-            put_disp( p, c->smi_nativeMethod );
+            // small_int_t method is NativeMethod -> counted by the smi entry at the end
+            smi_fixup = p;
+            put_disp( p, 0 );
         } else if ( c->smi_methodOop not_eq nullptr ) {
             // small_int_t method is methodOop -> handle it in methodOop section
             fixup = p;
@@ -649,14 +852,22 @@ std::int32_t PolymorphicInlineCache::code_for_polymorphic_case( char *entry, Pol
         st_assert( entry + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_entry_offset ) == p, "constant value inconsistent with code pattern" );
         // handle nativeMethods
         for ( std::size_t i = 0; i < c->n; i++ ) {
+            char *entry_i = entry + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_entry_offset ) + i * static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_entry_size );
             // cmp edx, klass(i)
             st_assert( c->nativeMethod_klasses[ i ] not_eq smiKlassObject, "should not be smiKlassObject" );
             put_shrt( p, cmp_opcode );
-            st_assert( entry + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_entry_offset ) + i * static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_entry_size ) + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_klass_offset ) == p, "constant value inconsistent with code pattern" );
+            st_assert( entry_i + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_klass_offset ) == p, "constant value inconsistent with code pattern" );
             put_word( p, std::int32_t( c->nativeMethod_klasses[ i ] ) );
-            // je NativeMethod(j)
-            put_shrt( p, jz_opcode );
-            st_assert( entry + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_entry_offset ) + i * static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_entry_size ) + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_nativeMethodOffset ) == p, "constant value inconsistent with code pattern" );
+            // jne next entry
+            put_byte( p, jne_opcode );
+            put_byte( p, static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_entry_size ) - ( static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_counter_offset ) - sizeof( inc_opcode ) ) );
+            // inc [counter(i)]
+            put_shrt( p, inc_opcode );
+            st_assert( entry_i + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_counter_offset ) == p, "constant value inconsistent with code pattern" );
+            put_counter( p, counts, c->nativeMethod_counts[ i ] );
+            // jmp NativeMethod(i)
+            put_byte( p, jmp_opcode );
+            st_assert( entry_i + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_nativeMethodOffset ) == p, "constant value inconsistent with code pattern" );
             put_disp( p, c->nativeMethods[ i ] );
         }
         st_assert( entry + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_entry_offset ) + c->n * static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_NativeMethod_entry_size ) == p, "constant value inconsistent with code pattern" );
@@ -664,16 +875,28 @@ std::int32_t PolymorphicInlineCache::code_for_polymorphic_case( char *entry, Pol
             // handle methodOops
             if ( fixup not_eq nullptr )
                 put_disp( fixup, p );
-            p += code_for_methodOops_only( p, c );
+            p += code_for_methodOops_only( p, c, counts );
         } else {
             // jmp cache_miss
             put_byte( p, jmp_opcode );
             put_disp( p, CompiledInlineCache::normalLookupRoutine() );
         }
+        if ( smi_fixup not_eq nullptr ) {
+            // smi entry: inc [counter]; jmp smi_nativeMethod
+            char *smi_entry = p;
+            put_disp( smi_fixup, smi_entry );
+            put_shrt( p, inc_opcode );
+            st_assert( smi_entry + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_smi_counter_offset ) == p, "constant value inconsistent with code pattern" );
+            put_counter( p, counts, c->smi_count );
+            put_byte( p, jmp_opcode );
+            st_assert( smi_entry + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_smi_entry_nativeMethodOffset ) == p, "constant value inconsistent with code pattern" );
+            put_disp( p, c->smi_nativeMethod );
+            st_assert( smi_entry + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_smi_entry_size ) == p, "constant value inconsistent with code pattern" );
+        }
         return p - entry;
     } else {
         // no nativeMethods -> call PolymorphicInlineCache stub routine directly
-        return code_for_methodOops_only( entry, c );
+        return code_for_methodOops_only( entry, c, counts );
     }
 }
 
@@ -686,6 +909,11 @@ std::int32_t PolymorphicInlineCache::code_for_megamorphic_case( char *entry ) {
     put_disp( p, StubRoutines::megamorphic_ic_entry() );
     st_assert( entry + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_selector_offset ) == p, "layout constant inconsistent with code pattern" );
     put_word( p, std::int32_t( selector() ) );    // used for fast lookup
+    st_assert( entry + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_table_offset ) == p, "layout constant inconsistent with code pattern" );
+    for ( std::int32_t i = 0; i < static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_table_size ); i++ ) {
+        put_word( p, 0 );                           // klass: empty entry
+        put_word( p, 0 );                           // target
+    }
     st_assert( entry + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_code_size ) == p, "layout constant inconsistent with code pattern" );
 
     return p - entry;
@@ -700,6 +928,11 @@ void PolymorphicInlineCache::shrink_and_generate( PolymorphicInlineCache *pic, K
 }
 
 
+std::int32_t PolymorphicInlineCache::max_number_of_entries() {
+    return max( 2, min( MaxPolymorphicInlineCacheEntries, static_cast<std::int32_t>( PolymorphicInlineCache::Constant::max_nof_entries ) ) );
+}
+
+
 void *PolymorphicInlineCache::operator new( std::size_t size, std::int32_t code_size ) {
     return Universe::code->_picHeap->allocate( size + code_size );
 }
@@ -736,7 +969,7 @@ PolymorphicInlineCache *PolymorphicInlineCache::allocate( CompiledInlineCache *i
         // ic contains pic
         st_assert( old_nativeMethod == nullptr, "just checking" );
         st_assert( not old_pic->is_megamorphic(), "MICs should not change anymore" );
-        if ( old_pic->number_of_targets() >= static_cast<std::int32_t>( PolymorphicInlineCache::Constant::max_nof_entries ) ) {
+        if ( old_pic->number_of_targets() >= max_number_of_entries() ) {
             if ( UseMICs ) {
                 // switch to MIC, keep only no lookup result
                 switch_to_MIC = true;
@@ -745,16 +978,13 @@ PolymorphicInlineCache *PolymorphicInlineCache::allocate( CompiledInlineCache *i
                 return nullptr;
             }
         } else {
-            // append old PolymorphicInlineCache entries
+            // append old PolymorphicInlineCache entries with their counts; the new entry goes behind the ones hit before
             PolymorphicInlineCacheIterator it( old_pic );
             while ( not it.at_end() ) {
-                if ( it.is_interpreted() ) {
-                    contents.append_method( it.get_klass(), it.interpreted_method() );
-                } else {
-                    contents.append_NativeMethod_entry( it.get_klass(), it.get_call_addr() );
-                }
+                contents.append_entry( &it );
                 it.advance();
             }
+            contents.sort_by_counts();
         }
     } else if ( old_nativeMethod not_eq nullptr ) {
         // ic contains 1 NativeMethod
@@ -766,13 +996,11 @@ PolymorphicInlineCache *PolymorphicInlineCache::allocate( CompiledInlineCache *i
 
     st_assert( switch_to_MIC or contents.number_of_interpreted_targets() > 0 or contents.number_of_compiled_targets() > 1, "no PolymorphicInlineCache required for only 1 compiled target" );
 
-    PolymorphicInlineCache *new_pic = nullptr;
-    if ( switch_to_MIC ) {
-        new_pic = new( static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_code_size ) ) PolymorphicInlineCache( ic );
-    } else {
-        std::int32_t allocated_code_size = contents.code_size();
-        new_pic = new( allocated_code_size ) PolymorphicInlineCache( ic, &contents, allocated_code_size );
-    }
+    if ( switch_to_MIC )
+        return allocate_megamorphic( ic );
+
+    std::int32_t           allocated_code_size = contents.code_size();
+    PolymorphicInlineCache *new_pic            = new( allocated_code_size ) PolymorphicInlineCache( ic, &contents, allocated_code_size );
 
     new_pic->verify();
 
@@ -780,13 +1008,24 @@ PolymorphicInlineCache *PolymorphicInlineCache::allocate( CompiledInlineCache *i
 }
 
 
+PolymorphicInlineCache *PolymorphicInlineCache::allocate_megamorphic( CompiledInlineCache *ic ) {
+    PolymorphicInlineCache *new_pic = new( static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_code_size ) ) PolymorphicInlineCache( ic );
+    new_pic->verify();
+    return new_pic;
+}
+
+
 PolymorphicInlineCache::PolymorphicInlineCache( CompiledInlineCache *ic, PolymorphicInlineCacheContents *contents, std::int32_t allocated_code_size ) :
     _ic{ ic },
     _codeSize{ 0 },
-    _numberOfTargets{ 0 } {
+    _numberOfTargets{ 0 },
+    _counts{ nullptr } {
     st_assert( contents->number_of_targets() >= 1, "at least one entry needed for non-MEGAMORPHIC case" );
     _numberOfTargets = contents->number_of_targets();
-    _codeSize        = code_for_polymorphic_case( entry(), contents );
+    _counts          = new_c_heap_array<std::int32_t>( _numberOfTargets );
+    std::int32_t *counts = _counts;
+    _codeSize = code_for_polymorphic_case( entry(), contents, counts );
+    st_assert( counts == _counts + _numberOfTargets, "one counter per entry" );
     st_assert( code_size() == allocated_code_size, "Please adjust PolymorphicInlineCacheContents::code_size()" );
 }
 
@@ -794,13 +1033,27 @@ PolymorphicInlineCache::PolymorphicInlineCache( CompiledInlineCache *ic, Polymor
 PolymorphicInlineCache::PolymorphicInlineCache( CompiledInlineCache *ic ) :
     _ic{ ic },
     _codeSize{ 0 },
-    _numberOfTargets{ 0 } {
+    _numberOfTargets{ 0 },
+    _counts{ nullptr } {
 //    _numberOfTargets = 0; // indicates MEGAMORPHIC case
     _codeSize = code_for_megamorphic_case( entry() );
     st_assert( code_size() == static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_code_size ), "Please adjust PolymorphicInlineCacheContents::code_size()" );
 }
 
 
+PolymorphicInlineCache::~PolymorphicInlineCache() {
+    if ( _counts not_eq nullptr )
+        FreeHeap( _counts );
+}
+
+
+void PolymorphicInlineCache::decay_counts( double decay_factor ) {
+    for ( std::int32_t i = 0; i < number_of_targets(); i++ ) {
+        _counts[ i ] = std::int32_t( _counts[ i ] / decay_factor );
+    }
+}
+
+
 GrowableArray<KlassOop> *PolymorphicInlineCache::klasses() const {
     GrowableArray<KlassOop>        *k = new GrowableArray<KlassOop>( 2 );
     PolymorphicInlineCacheIterator it( (PolymorphicInlineCache *) this );
@@ -818,6 +1071,14 @@ void PolymorphicInlineCache::oops_do( void f( Oop * ) ) {
     if ( is_megamorphic() ) {
         // cannot use PolymorphicInlineCacheIterator (0 entries) -> deal with MIC directly
         f( (Oop *) MegamorphicInlineCache_selector_address() );
+        for ( std::int32_t i = 0; i < static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_table_size ); i++ ) {
+            if ( *MegamorphicInlineCache_klass_address( i ) == nullptr )
+                continue;
+            f( (Oop *) MegamorphicInlineCache_klass_address( i ) );
+            // NativeMethod entry points look like smis and are left alone
+            if ( ( *MegamorphicInlineCache_target_address( i ) )->isMemOop() )
+                f( MegamorphicInlineCache_target_address( i ) );
+        }
     } else {
         PolymorphicInlineCacheIterator it( this );
         while ( not it.at_end() ) {
@@ -860,6 +1121,7 @@ void PolymorphicInlineCache::print() {
                 break;
             default: ShouldNotReachHere();
         }
+        SPDLOG_INFO( "\t-    hits: {}", it.hit_count() );
         i++;
         it.advance();
     }
@@ -26,38 +26,52 @@ class PolymorphicInlineCache {
 
 public:
     enum class Constant {
-        max_nof_entries = 4,            // the maximal number of PolymorphicInlineCache entries
+        max_nof_entries = 8,            // the maximal number of PolymorphicInlineCache entries (the actual limit is MaxPolymorphicInlineCacheEntries)
 
         // PolymorphicInlineCache layout constants
-        PolymorphicInlineCache_methodOop_only_offset     = 5,   //
-        PolymorphicInlineCache_smi_nativeMethodOffset    = 4,   //
-        PolymorphicInlineCache_NativeMethod_entry_offset = 11,  //
-        PolymorphicInlineCache_NativeMethod_entry_size   = 12,  //
-        PolymorphicInlineCache_NativeMethod_klass_offset = 2,   //
-        PolymorphicInlineCache_nativeMethodOffset        = 8,   //
-        PolymorphicInlineCache_methodOop_entry_offset    = 16,  //
-        PolymorphicInlineCache_methodOop_entry_size      = 8,   //
-        PolymorphicInlineCache_methodOop_klass_offset    = 0,   //
-        PolymorphicInlineCache_methodOop_offset          = 4,   //
+        PolymorphicInlineCache_methodOop_only_offset        = 5,   //
+        PolymorphicInlineCache_smi_nativeMethodOffset       = 4,   //
+        PolymorphicInlineCache_NativeMethod_entry_offset    = 11,  //
+        PolymorphicInlineCache_NativeMethod_entry_size      = 19,  //
+        PolymorphicInlineCache_NativeMethod_klass_offset    = 2,   //
+        PolymorphicInlineCache_NativeMethod_counter_offset  = 10,  //
+        PolymorphicInlineCache_nativeMethodOffset           = 15,  //
+        PolymorphicInlineCache_methodOop_entry_offset       = 16,  //
+        PolymorphicInlineCache_methodOop_entry_size         = 12,  //
+        PolymorphicInlineCache_methodOop_klass_offset       = 0,   //
+        PolymorphicInlineCache_methodOop_offset             = 4,   //
+        PolymorphicInlineCache_methodOop_counter_offset     = 8,   //
+        PolymorphicInlineCache_smi_entry_size               = 11,  //
+        PolymorphicInlineCache_smi_counter_offset           = 2,   //
+        PolymorphicInlineCache_smi_entry_nativeMethodOffset = 7,   //
 
         // MegamorphicInlineCache layout constants
-        MegamorphicInlineCache_selector_offset = 5, //
-        MegamorphicInlineCache_code_size       = 9, //
+        MegamorphicInlineCache_selector_offset     = 5, //
+        MegamorphicInlineCache_table_offset        = 9, //
+        MegamorphicInlineCache_table_size          = 8, // the number of (klass, target) entries, a power of 2
+        MegamorphicInlineCache_entry_size          = 8, //
+        MegamorphicInlineCache_entry_klass_offset  = 0, //
+        MegamorphicInlineCache_entry_target_offset = 4, //
+        MegamorphicInlineCache_code_size           = MegamorphicInlineCache_table_offset + MegamorphicInlineCache_table_size * MegamorphicInlineCache_entry_size, //
     };
 
 private:
     CompiledInlineCache *_ic;      // the ic linked to this PolymorphicInlineCache
     std::int16_t        _codeSize;              // size of code in bytes
     std::int16_t        _numberOfTargets;       // the total number of PolymorphicInlineCache entries, 0 indicates a MonomorphicInlineCache
+    std::int32_t        *_counts;               // the hit counters of the entries (C heap), incremented by the code; nullptr for MICs
 
     static std::int32_t nof_entries( const char *pic_stub );    // the no. of methodOop entries for a given stub routine
 
-    std::int32_t code_for_methodOops_only( const char *entry, PolymorphicInlineCacheContents *c );
+    std::int32_t code_for_methodOops_only( const char *entry, PolymorphicInlineCacheContents *c, std::int32_t *&counts );
 
-    std::int32_t code_for_polymorphic_case( char *entry, PolymorphicInlineCacheContents *c );
+    std::int32_t code_for_polymorphic_case( char *entry, PolymorphicInlineCacheContents *c, std::int32_t *&counts );
 
     std::int32_t code_for_megamorphic_case( char *entry );
 
+    // tells whether the entries should be re-emitted in the order of their hit counts
+    static bool is_badly_ordered( PolymorphicInlineCacheContents *c );
+
     void shrink_and_generate( PolymorphicInlineCache *pic, KlassOop klass, void *method );
 
 
@@ -71,6 +85,8 @@ private:
     PolymorphicInlineCache( CompiledInlineCache *ic ); // creation of MegamorphicInlineCache
 
 public:
+    ~PolymorphicInlineCache();
+
     void *operator new( std::size_t size, std::int32_t code_size );
 
     // Deallocates this pic from the pic heap
@@ -85,6 +101,12 @@ public:
     // Allocates and returns a new ready to execute pic.
     static PolymorphicInlineCache *allocate( CompiledInlineCache *ic, KlassOop klass, LookupResult result );
 
+    // Allocates and returns a new ready to execute MIC with an empty table.
+    static PolymorphicInlineCache *allocate_megamorphic( CompiledInlineCache *ic );
+
+    // The number of entries a PolymorphicInlineCache may have before it is replaced by a MIC
+    static std::int32_t max_number_of_entries();
+
     // Tells whether addr inside the PolymorphicInlineCache area
     static bool in_heap( const char *addr );
 
@@ -137,19 +159,36 @@ public:
     // For MegamorphicInlineCache instances only
     SymbolOop *MegamorphicInlineCache_selector_address() const;    // the address of the selector in the MegamorphicInlineCache
 
+    // The MegamorphicInlineCache table entry used for receivers of klass (the hash used by the MIC stub routine)
+    static std::int32_t MegamorphicInlineCache_index( KlassOop klass );
+
+    KlassOop *MegamorphicInlineCache_klass_address( std::int32_t index ) const;
+
+    Oop *MegamorphicInlineCache_target_address( std::int32_t index ) const;
+
+    // The methodOop or NativeMethod entry point cached for receivers of klass, nullptr on a miss
+    Oop MegamorphicInlineCache_lookup( KlassOop klass ) const;
+
+    // Clears the MegamorphicInlineCache table entry for key, or all entries if key is nullptr;
+    // called whenever the corresponding entries of the LookupCache are flushed.
+    void flush_megamorphic_table( LookupKey *key = nullptr );
+
     // replace appropriate target (with key nm->key) by nm.
     // this is returned if we could patch the current PolymorphicInlineCache.
     // a new PolymorphicInlineCache is returned if we could not patch this PolymorphicInlineCache.
     PolymorphicInlineCache *replace( NativeMethod *nm );
 
     // Cleans up the pic and returns:
-    //  1) A PolymorphicInlineCache			(still POLYMORPHIC or MEGAMORPHIC)
+    //  1) A PolymorphicInlineCache			(still POLYMORPHIC or MEGAMORPHIC; a new one if the entries had to be reordered by their hit counts)
     //  2) A NativeMethod		(now   MONOMORPHIC)
     //  3) nothing		(now   ANAMORPHIC)
     PolymorphicInlineCache *cleanup( NativeMethod **nm );
 
     GrowableArray<KlassOop> *klasses() const;
 
+    // Divides the hit counters by decay_factor (see NativeMethod::decay_invocation_count)
+    void decay_counts( double decay_factor );
+
     // Iterate over all oops in the pic
     void oops_do( void f( Oop * ) );
 
@@ -371,14 +371,24 @@ const char *StubRoutines::generate_megamorphic_ic( MacroAssembler *masm ) {
     //
     // call <this stub routine>
     // selector			<--- return address (tos)
+    // table of MegamorphicInlineCache_table_size (klass, methodOop/NativeMethod) entries
+    //
+    // The table is probed first; the global lookup cache is only probed if the receiver klass
+    // is not found there, and a hit in it is copied into the table.
     //
     // Note: Don't use this for MEGAMORPHIC super sends!
 
-    Label isSmallIntegerOop, probe_primary_cache, probe_secondary_cache, call_method, is_methodOop, do_lookup;
+    constexpr std::int32_t table_mask    = ( static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_table_size ) - 1 ) << 2;
+    constexpr std::int32_t table_offset  = static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_table_offset ) - static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_selector_offset );
+    constexpr std::int32_t klass_offset  = table_offset + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_entry_klass_offset );
+    constexpr std::int32_t target_offset = table_offset + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_entry_target_offset );
+    static_assert( static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_entry_size ) == 2 * OOP_SIZE, "table index is scaled by 2" );
+
+    Label isSmallIntegerOop, probe_table, probe_primary_cache, probe_secondary_cache, fill_table, call_method, is_methodOop, do_lookup;
 
     masm->bind( isSmallIntegerOop );                // small_int_t case (assumed to be infrequent)
     masm->movl( ecx, Address( (std::int32_t) &smiKlassObject, RelocationInformation::RelocationType::external_word_type ) );
-    masm->jmp( probe_primary_cache );
+    masm->jmp( probe_table );
 
     // eax    : receiver
     // tos    : return address pointing to selector in MIC
@@ -390,24 +400,19 @@ const char *StubRoutines::generate_megamorphic_ic( MacroAssembler *masm ) {
     masm->jcc( Assembler::Condition::zero, isSmallIntegerOop );        // if so, get small_int_t class directly
     masm->movl( ecx, Address( eax, MemOopDescriptor::klass_byte_offset() ) );    // otherwise, load receiver class
 
-    // probe primary cache
+    // probe MIC table (see PolymorphicInlineCache::MegamorphicInlineCache_index)
     //
     // eax: receiver
     // ebx: MIC cache pointer
     // ecx: receiver klass
     // tos: return address of MEGAMORPHIC send in compiled code (ic)
-    masm->bind( probe_primary_cache );        // compute hash value
-    masm->movl( edx, Address( ebx ) );        // get selector
-    // compute hash value
+    masm->bind( probe_table );
     masm->movl( edi, ecx );
-    masm->xorl( edi, edx );
-    masm->andl( edi, ( primary_cache_size - 1 ) << 4 );
-    // probe cache
-    masm->cmpl( ecx, Address( edi, LookupCache::primary_cache_address() + 0 * OOP_SIZE ) );
-    masm->jcc( Assembler::Condition::notEqual, probe_secondary_cache );
-    masm->cmpl( edx, Address( edi, LookupCache::primary_cache_address() + 1 * OOP_SIZE ) );
-    masm->jcc( Assembler::Condition::notEqual, probe_secondary_cache );
-    masm->movl( ecx, Address( edi, LookupCache::primary_cache_address() + 2 * OOP_SIZE ) );
+    masm->andl( edi, table_mask );            // edi: table index * 4
+    masm->cmpl( ecx, Address( ebx, edi, Address::ScaleFactor::times_2, klass_offset ) );
+    masm->jcc( Assembler::Condition::notEqual, probe_primary_cache );
+    masm->incl( Address( (std::int32_t) &LookupCache::number_of_megamorphic_hits, RelocationInformation::RelocationType::external_word_type ) );
+    masm->movl( ecx, Address( ebx, edi, Address::ScaleFactor::times_2, target_offset ) );
 
     // call method
     //
@@ -432,6 +437,41 @@ const char *StubRoutines::generate_megamorphic_ic( MacroAssembler *masm ) {
     // tos: return address of MEGAMORPHIC send in compiled code (ic)
     masm->jmp( edx );                // call method_entry
 
+    // probe primary cache
+    //
+    // eax: receiver
+    // ebx: MIC cache pointer
+    // ecx: receiver klass
+    // tos: return address of MEGAMORPHIC send in compiled code (ic)
+    masm->bind( probe_primary_cache );
+    masm->incl( Address( (std::int32_t) &LookupCache::number_of_megamorphic_misses, RelocationInformation::RelocationType::external_word_type ) );
+    masm->movl( edx, Address( ebx ) );        // get selector
+    // compute hash value
+    masm->movl( edi, ecx );
+    masm->xorl( edi, edx );
+    masm->andl( edi, ( primary_cache_size - 1 ) << 4 );
+    // probe cache
+    masm->cmpl( ecx, Address( edi, LookupCache::primary_cache_address() + 0 * OOP_SIZE ) );
+    masm->jcc( Assembler::Condition::notEqual, probe_secondary_cache );
+    masm->cmpl( edx, Address( edi, LookupCache::primary_cache_address() + 1 * OOP_SIZE ) );
+    masm->jcc( Assembler::Condition::notEqual, probe_secondary_cache );
+    masm->movl( edx, Address( edi, LookupCache::primary_cache_address() + 2 * OOP_SIZE ) );
+
+    // copy lookup cache hit into MIC table
+    //
+    // eax: receiver
+    // ebx: MIC cache pointer
+    // ecx: receiver klass
+    // edx: methodOop/NativeMethod
+    // tos: return address of MEGAMORPHIC send in compiled code (ic)
+    masm->bind( fill_table );
+    masm->movl( edi, ecx );
+    masm->andl( edi, table_mask );
+    masm->movl( Address( ebx, edi, Address::ScaleFactor::times_2, klass_offset ), ecx );
+    masm->movl( Address( ebx, edi, Address::ScaleFactor::times_2, target_offset ), edx );
+    masm->movl( ecx, edx );
+    masm->jmp( call_method );
+
     // probe secondary cache
     //
     // eax: receiver
@@ -447,8 +487,8 @@ const char *StubRoutines::generate_megamorphic_ic( MacroAssembler *masm ) {
     masm->jcc( Assembler::Condition::notEqual, do_lookup );
     masm->cmpl( edx, Address( edi, LookupCache::secondary_cache_address() + 1 * OOP_SIZE ) );
     masm->jcc( Assembler::Condition::notEqual, do_lookup );
-    masm->movl( ecx, Address( edi, LookupCache::secondary_cache_address() + 2 * OOP_SIZE ) );
-    masm->jmp( call_method );
+    masm->movl( edx, Address( edi, LookupCache::secondary_cache_address() + 2 * OOP_SIZE ) );
+    masm->jmp( fill_table );
 
     // do lookup
     //
@@ -458,6 +498,10 @@ const char *StubRoutines::generate_megamorphic_ic( MacroAssembler *masm ) {
     // edx: selector
     // edi: secondary cache index
     // tos: return address of MEGAMORPHIC send in compiled code (ic)
+    //
+    // Note: The result is not copied into the MIC table, the lookup may compile and flush the
+    //       zone, taking the MIC with it. It is entered into the lookup cache, from where the
+    //       next send copies it.
     masm->bind( do_lookup );
     masm->set_last_delta_frame_after_call();
     masm->pushl( eax );                // save receiver
@@ -1374,12 +1418,15 @@ const char *StubRoutines::generate_PolymorphicInlineCache_stub( MacroAssembler *
 // call <this stub routine>
 // cached klass 1	<--- return address (tos)
 // cached methodOop 1
+// counter address 1
 // cached klass 2
 // cached methodOop2
+// counter address 2
 // ...
 //
 // cached klass n
 // cached methodOop n
+// counter address n
 //
 // Note: Don't use this for POLYMORPHIC super sends!
 
@@ -1418,10 +1465,16 @@ const char *StubRoutines::generate_PolymorphicInlineCache_stub( MacroAssembler *
     // tos: return address of POLYMORPHIC send in compiled code
     masm->bind( loop );
     for ( std::size_t i = 0; i < pic_size; i++ ) {
+        Label next;
         // compare receiver klass with klass in PolymorphicInlineCache table at index
         masm->cmpl( edx, Address( ebx, i * static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_methodOop_entry_size ) + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_methodOop_klass_offset ) ) );
+        masm->jcc( Assembler::Condition::notEqual, next );
+        // count the hit
+        masm->movl( ecx, Address( ebx, i * static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_methodOop_entry_size ) + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_methodOop_counter_offset ) ) );
+        masm->incl( Address( ecx ) );
         masm->movl( ecx, Address( ebx, i * static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_methodOop_entry_size ) + static_cast<std::int32_t>( PolymorphicInlineCache::Constant::PolymorphicInlineCache_methodOop_offset ) ) );
-        masm->jcc( Assembler::Condition::equal, found );
+        masm->jmp( found );
+        masm->bind( next );
     }
     st_assert( ic_normal_lookup_entry() not_eq nullptr, "ic_normal_lookup_entry must be generated before" );
     masm->jmp( ic_normal_lookup_entry(), RelocationInformation::RelocationType::runtime_call_type );
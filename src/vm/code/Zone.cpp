@@ -89,7 +89,7 @@ Zone::Zone( std::int32_t &size ) :
     _methodTable{ nullptr },
     _jumpTable{},
     LRUhand{ nullptr },
-    _needsCompaction{ false },
+    _needsReclamation{ false },
     _needsLRUSweep{ false },
     _needsSweep{ false },
     compactTime{ 0 },
@@ -120,7 +120,7 @@ void Zone::clear() {
     LRUtime = 0;
     jump_table()->init();
 
-    _needsCompaction = _needsSweep = false;
+    _needsReclamation = _needsSweep = false;
     compactTime      = 0;
     compactDuration  = 1;
     minFreeFrac      = 0.05;
@@ -132,21 +132,24 @@ std::int32_t Zone::nextNativeMethodID() {
 }
 
 
-NativeMethod *Zone::allocate( std::int32_t size ) {
+NativeMethod *Zone::allocate( std::int32_t size, bool hot ) {
     // CSect cs(profilerSemaphore); // for profiler
     // must get method ID here! (because reclaim might change firstFree)
     // (compiler may have used peekID to get ID of new NativeMethod for LRU stuff)
-    if ( needsSweep() )
-        doSweep();
+    if ( needsWork() )
+        doWork();
 
-    NativeMethod *n = (NativeMethod *) _methodHeap->allocate( size );
+    bool atTop = SegregateHotCode and not hot;
+
+    NativeMethod *n = (NativeMethod *) _methodHeap->allocate( size, atTop );
 
     if ( n == nullptr ) {
         // allocation failed so flush zombies and retry
         flushZombies();
-        n = (NativeMethod *) _methodHeap->allocate( size );
+        n = (NativeMethod *) _methodHeap->allocate( size, atTop );
         if ( n == nullptr ) {
             print();
+            print_fragmentation();
             st_fatal( "cannot allocate enough Space for NativeMethod" );
         }
     }
@@ -235,10 +238,14 @@ void moveInsts( const char *from, char *to, std::int32_t size ) {
 }
 
 
-class ConvertBlockClosure : public ObjectClosure {
+// Removes the references to zombies from the heap in a single walk: the inline caches of
+// the methodOops may call them through the jump table, and blocks may have compiled code
+class FlushZombieReferencesClosure : public ObjectClosure {
 public:
     void do_object( MemOop obj ) {
-        if ( obj->is_block() and BlockClosureOop( obj )->isCompiledBlock() ) {
+        if ( obj->is_method() ) {
+            MethodOop( obj )->clear_inline_caches();
+        } else if ( obj->is_block() and BlockClosureOop( obj )->isCompiledBlock() ) {
             BlockClosureOop( obj )->deoptimize();
         }
     }
@@ -250,19 +257,38 @@ extern NativeMethod *recompilee;
 
 void Zone::flushZombies( bool deoptimize ) {
     // 1. cleanup all methodOop inline caches
-    // 2. cleanup all NativeMethod inline caches
+    // 2. cleanup the NativeMethod inline caches calling zombies
     // 3..deoptimized blocks with compiled code.
 
+    // Without zombies there is nothing to flush (and no need to walk the heap)
+    bool hasZombies = false;
+    FOR_ALL_NMETHODS( p ) {
+        if ( p->isZombie() ) {
+            hasZombies = true;
+            break;
+        }
+    }
+    _needsReclamation = false;
+    if ( not hasZombies )
+        return;
+
+    TraceTime   t( "*flushing zombies...", PrintCodeReclamation );
+    EventMarker em( "flushing zombies" );
+
     // Clear caches
     LookupCache::flush();
     // Universe::cleanup_all_inline_caches();
 
-    Universe::flush_inline_caches_in_methods();
-    clear_inline_caches();
+    // The inline caches of live nativeMethods keep their targets (and PolymorphicInlineCache counts) unless they call a zombie;
+    // the zombies' own inline caches are cleared when they are flushed
+    FOR_ALL_NMETHODS( p ) {
+        if ( not p->isZombie() )
+            p->clear_zombie_inline_caches();
+    }
 
-    // Convert all blocks with compiled code
-    ConvertBlockClosure bl;
-    Universe::object_iterate( &bl );
+    // Clear the methodOops' inline caches and convert all blocks with compiled code
+    FlushZombieReferencesClosure blk;
+    Universe::object_iterate( &blk );
 
     FOR_ALL_NMETHODS( p ) {
         debug_nm = p;
@@ -338,36 +364,28 @@ void Zone::doSweep() {
 void Zone::doWork() {
     if ( needsSweep() )
         doSweep();
-    if ( needsCompaction() )
-        compact();
+    if ( needsReclamation() )
+        reclaim();
 }
 
 
-void Zone::compact( bool forced ) {
-    // BlockProfilerTicks bpt(exclude_NativeMethod_compact);
-    // CSect cs(profilerSemaphore); // for profiler
-
-    TraceTime   t( "*compacting NativeMethod cache...", PrintCodeReclamation );
-    EventMarker em( "compacting zone" );
+void Zone::reclaim( bool forced ) {
+    // nativeMethods are never moved (and no frames or inline caches patched): the zombies are
+    // flushed and their chunks go back to the free lists of the heap
+    EventMarker em( "reclaiming zone" );
 
-    // chainFrames();
+    if ( PrintCodeReclamation ) {
+        SPDLOG_INFO( "*reclaiming zone ({:d}K used)", _methodHeap->usedBytes() / 1024 );
+    }
     flushZombies();
-//    const char *firstFree = nullptr;
     if ( not forced )
         adjustPolicy();
-
-    if ( needsCompaction() ) {
-        if ( PrintCodeReclamation ) {
-            _console->print( "I" );
-        }
-//        const char *firstFree = _methodHeap->compact( moveInsts );
+    if ( PrintCodeReclamation ) {
+        print_fragmentation();
     }
-    // unchainFrames();
-    //    flushICache();
 
     verify_if_often();
-    _needsCompaction = false;
-    // compactDuration = cpuTimer->tickNo - compactTime;
+    _needsReclamation = false;
 }
 
 
@@ -464,6 +482,13 @@ void Zone::PICs_do( void f( PolymorphicInlineCache *pic ) ) {
 }
 
 
+void Zone::flush_megamorphic_tables( LookupKey *key ) {
+    FOR_ALL_PICS( p ) {
+        p->flush_megamorphic_table( key );
+    }
+}
+
+
 #define NMLINE( format, n, ntot, ntot2 ) \
   _console->print(format, (n), 100.0 * (n) / (ntot), 100.0 * (n) / (ntot2))
 
@@ -563,6 +588,15 @@ void Zone::print() {
 }
 
 
+void Zone::print_fragmentation() {
+    SPDLOG_INFO( "Zone fragmentation:" );
+    SPDLOG_INFO( " Code ({:d}K, {:d}% used)", _methodHeap->capacity() / 1024, ( _methodHeap->usedBytes() * 100 ) / _methodHeap->capacity() );
+    _methodHeap->print_fragmentation();
+    SPDLOG_INFO( " PICs ({:d}K, {:d}% used)", _picHeap->capacity() / 1024, ( _picHeap->usedBytes() * 100 ) / _picHeap->capacity() );
+    _picHeap->print_fragmentation();
+}
+
+
 struct nm_hist_elem {
     NativeMethod *nm;
     std::int32_t count;
@@ -20,9 +20,25 @@
 //   - Each compiled method occupies one chunk of memory.
 //   - Like the offset table in oldspace the zone has at table for
 //     locating a method given a address of an instruction.
+//   - nativeMethods never move; the segregated free lists of ZoneHeap keep
+//     the fragmentation low instead (see print_fragmentation).
+//   - With SegregateHotCode, first versions (and inlining database compiles)
+//     are placed at the top end of the zone and recompiled versions, whose
+//     methods have proven to be hot, at the bottom end; the hot code is thus
+//     packed together and doesn't share i-cache lines and pages with code
+//     that is rarely run.
+//   - Zombies are freed by flushZombies, which needs a walk over the heap (the
+//     interpreter's inline caches and the compiled blocks may refer to them).
+//     The ZoneSweeper asks for it (reclaim) as soon as ZombieReclaimThreshold
+//     percent of the zone are taken by zombies, so the zone rarely fills up.
+//     The walk is not incremental: all zombies are freed in one pause whose
+//     length depends on the size of the object heap. Freeing a few zombies
+//     per step would need back references from the jump table and the
+//     compiled blocks to the nativeMethods they use.
 
 
 class PolymorphicInlineCache;
+class LookupKey;
 
 class Zone : public CHeapAllocatedObject {
 
@@ -41,7 +57,7 @@ public:
 
 protected:
     NativeMethod *LRUhand;          // for LRU algorithm; sweeps through iZone
-    bool         _needsCompaction;  //
+    bool         _needsReclamation; // zombies should be flushed at the next allocation
     bool         _needsLRUSweep;    //
     bool         _needsSweep;       //
 
@@ -87,22 +103,28 @@ public:
     }
 
 
-    NativeMethod *allocate( std::int32_t size );
+    NativeMethod *allocate( std::int32_t size, bool hot = true );
 
     void free( NativeMethod *m );
 
     void addToCodeTable( NativeMethod *nm );
 
-    void compact( bool forced = false );
+    void reclaim( bool forced = false );
 
 
-    bool needsCompaction() const {
-        return _needsCompaction;
+    bool needsReclamation() const {
+        return _needsReclamation;
+    }
+
+
+    // called by the ZoneSweeper; the zombies are flushed at the next allocation (a safe point)
+    void requestReclamation() {
+        _needsReclamation = true;
     }
 
 
     bool needsWork() const {
-        return needsCompaction() or _needsSweep;
+        return needsReclamation() or _needsSweep;
     }
 
 
@@ -144,6 +166,9 @@ public:
 
     void PICs_do( void f( PolymorphicInlineCache *pic ) );
 
+    // Clears the tables of the MEGAMORPHIC PICs (all entries, or only those for key)
+    void flush_megamorphic_tables( LookupKey *key = nullptr );
+
     // Iterates over all oops is the zone
     void oops_do( void f( Oop * ) );
 
@@ -155,6 +180,9 @@ public:
 
     void print_NativeMethod_histogram( std::int32_t size );
 
+    // Prints the free chunks of the code and PolymorphicInlineCache heaps by size class
+    void print_fragmentation();
+
 
     NativeMethod *first_nm() const {
         return (NativeMethod *) ( _methodHeap->firstUsed() );
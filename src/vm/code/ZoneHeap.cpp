@@ -179,6 +179,7 @@ ZoneHeap::ZoneHeap( std::int32_t s, std::int32_t bs ) :
     size{},
     blockSize{},
     nfree{ 30 },
+    nbig{ 16 },
     log2BS{},
     _bytesUsed{},
     _total{},
@@ -187,7 +188,7 @@ ZoneHeap::ZoneHeap( std::int32_t s, std::int32_t bs ) :
     base{},
     _heapKlass{},
     _freeList{},
-    _bigList{},
+    _bigLists{},
     _lastCombine{},
     _newHeap{},
     _combineOnDeallocation{} {
@@ -212,7 +213,7 @@ ZoneHeap::ZoneHeap( std::int32_t s, std::int32_t bs ) :
     _heapKlass = (ChunkKlass *) ( AllocateHeap( mapSize() + 2, "zone free map" ) + 1 );
     // + 2 for sentinels
     _freeList  = new_c_heap_array<FreeList>( nfree );
-    _bigList   = new_c_heap_array<FreeList>( 1 );
+    _bigLists  = new_c_heap_array<FreeList>( nbig );
     _newHeap   = nullptr;
     clear();
 }
@@ -228,7 +229,9 @@ void ZoneHeap::clear() {
     for ( std::size_t i = 0; i < nfree; i++ ) {
         _freeList[ i ].clear();
     }
-    _bigList->clear();
+    for ( std::size_t i = 0; i < nbig; i++ ) {
+        _bigLists[ i ].clear();
+    }
 
     // initialize the map
     _heapKlass->markUnused( mapSize() );              // mark everything as unused
@@ -248,7 +251,7 @@ void ZoneHeap::clear() {
 
 
 bool ZoneHeap::contains( const void *p ) const {
-    return between( p, base, base + capacity() ) or between( p, _freeList, _freeList + nfree );
+    return between( p, base, base + capacity() ) or between( p, _freeList, _freeList + nfree ) or between( p, _bigLists, _bigLists + nbig );
 }
 
 
@@ -257,7 +260,7 @@ ZoneHeap::~ZoneHeap() {
     free( const_cast<char *>(_base) );
     free( _heapKlass - 1 );        // -1 to get rid of sentinel
     free( _freeList );
-    free( _bigList );
+    free( _bigLists );
 }
 
 
@@ -276,14 +279,23 @@ bool ZoneHeap::addToFreeList( ChunkKlass *m ) {
         _freeList[ sz - 1 ].append( p );
         return false;
     } else {
-        _bigList->append( p );
+        _bigLists[ bigListIndex( sz ) ].append( p );
         p->size = sz;
         return true; // "big"
     }
 }
 
 
-void *ZoneHeap::allocFromLists( std::int32_t wantedBytes ) {
+std::int32_t ZoneHeap::bigListIndex( std::int32_t blocks ) const {
+    st_assert( blocks > nfree, "not a big chunk" );
+    std::int32_t i = 0;
+    for ( std::int32_t s = blocks / ( nfree + 1 ); s > 1 and i < nbig - 1; s >>= 1 )
+        i++;
+    return i;
+}
+
+
+void *ZoneHeap::allocFromLists( std::int32_t wantedBytes, bool atTop ) {
     st_assert( wantedBytes % blockSize == 0, "not a multiple of blockSize" );
     std::int32_t wantedBlocks = wantedBytes >> log2BS;
     st_assert( wantedBlocks > 0, "negative alloc size" );
@@ -293,19 +305,34 @@ void *ZoneHeap::allocFromLists( std::int32_t wantedBytes ) {
         p = _freeList[ blocks - 1 ].get();
     }
     if ( not p ) {
-        HeapChunk *f = _bigList->anchor();
-        HeapChunk *c = f->next();
-        for ( ; c not_eq f and c->size < wantedBlocks; c = c->next() );
-        if ( c == f ) {
+        // first fit in the size class of wantedBlocks; any chunk of a bigger class is big enough
+        std::int32_t i = wantedBlocks > nfree ? bigListIndex( wantedBlocks ) : 0;
+        HeapChunk    *c = nullptr;
+        for ( ; c == nullptr and i < nbig; i++ ) {
+            HeapChunk *f = _bigLists[ i ].anchor();
+            for ( c = f->next(); c not_eq f and c->size < wantedBlocks; c = c->next() );
+            if ( c == f )
+                c = nullptr;
+        }
+        if ( c == nullptr ) {
             if ( not _combineOnDeallocation and combineAll() >= wantedBlocks )
-                return allocFromLists( wantedBytes );
+                return allocFromLists( wantedBytes, atTop );
         } else {
             p      = (void *) c;
             blocks = c->size;
-            _bigList->remove( c );
+            c->remove();
         }
     }
-    if ( p ) {
+    if ( p and atTop and blocks > wantedBlocks ) {
+        // use the end of the chunk, the beginning remains free
+        ChunkKlass *freeChunk = mapAddr( p );
+        st_assert( freeChunk->size() == blocks, "inconsistent sizes" );
+        freeChunk->markUnused( blocks - wantedBlocks );
+        ChunkKlass *m = freeChunk->next();
+        m->markUsed( wantedBlocks );
+        addToFreeList( freeChunk );
+        p = (void *) blockAddr( m );
+    } else if ( p ) {
         ChunkKlass *m = mapAddr( p );
         st_assert( m->size() == blocks, "inconsistent sizes" );
         m->markUsed( wantedBlocks );
@@ -326,11 +353,11 @@ void *ZoneHeap::allocFromLists( std::int32_t wantedBytes ) {
 }
 
 
-void *ZoneHeap::allocate( std::int32_t wantedBytes ) {
+void *ZoneHeap::allocate( std::int32_t wantedBytes, bool atTop ) {
     st_assert( wantedBytes > 0, "Heap::allocate: size <= 0" );
     std::int32_t rounded = ( ( wantedBytes + blockSize - 1 ) >> log2BS ) << log2BS;
 
-    void *p = allocFromLists( rounded );
+    void *p = allocFromLists( rounded, atTop );
     if ( p ) {
         _bytesUsed += rounded;
         _total += rounded;
@@ -394,7 +421,8 @@ const char *ZoneHeap::compact( void move( const char *from, char *to, std::int32
     for ( std::size_t i = 0; i < nfree; i++ )
         _freeList[ i ].clear();
 
-    _bigList->clear();
+    for ( std::size_t i = 0; i < nbig; i++ )
+        _bigLists[ i ].clear();
     std::int32_t freeBlocks = end->asByte() - freeChunk->asByte();
     freeChunk->markUnused( freeBlocks );
     addToFreeList( freeChunk );
@@ -581,14 +609,19 @@ void ZoneHeap::verify() const {
             }
         }
     }
-    std::int32_t    j  = 0;
-    HeapChunk       *f = _bigList->anchor();
-    for ( HeapChunk *h = f->next(); h not_eq f; h = h->next(), j++ ) {
-        ChunkKlass *p = mapAddr( h );
-        if ( not p->verify() )
-            SPDLOG_INFO( " in bigList (elem %ld) of heap 0x{0:x}", j, static_cast<const void *>(this) );
-        if ( p->isUsed() ) {
-            error( "inconsistent freeList %ld elem 0x{0:x} in heap 0x{0:x} (map 0xlx)", i, h, this, p );
+    for ( std::int32_t k = 0; k < nbig; k++ ) {
+        std::int32_t    j  = 0;
+        HeapChunk       *f = _bigLists[ k ].anchor();
+        for ( HeapChunk *h = f->next(); h not_eq f; h = h->next(), j++ ) {
+            ChunkKlass *p = mapAddr( h );
+            if ( not p->verify() )
+                SPDLOG_INFO( " in bigList {:d} (elem {:d}) of heap 0x{:x}", k, j, reinterpret_cast<std::uint32_t>( this ) );
+            if ( p->isUsed() ) {
+                error( "inconsistent freeList %ld elem 0x{0:x} in heap 0x{0:x} (map 0xlx)", i, h, this, p );
+            }
+            if ( bigListIndex( p->size() ) not_eq k ) {
+                error( "bigList %ld elem 0x{0:x} in heap 0x{0:x} (map 0x{0:x}) has wrong size", k, h, this, p );
+            }
         }
     }
     if ( not _lastCombine->verify() )
@@ -607,5 +640,47 @@ void ZoneHeap::print() const {
     SPDLOG_INFO( "  free lists: " );
     for ( std::size_t i = 0; i < nfree; i++ )
         SPDLOG_INFO( "%ld ", _freeList[ i ].length() );
-    SPDLOG_INFO( "; %ld", _bigList->length() );
+    for ( std::size_t i = 0; i < nbig; i++ )
+        SPDLOG_INFO( "; %ld", _bigLists[ i ].length() );
+}
+
+
+void ZoneHeap::free_histogram( std::int32_t *counts, std::int32_t *bytes ) const {
+    for ( std::int32_t i = 0; i < histogram_size; i++ ) {
+        counts[ i ] = 0;
+        bytes[ i ]  = 0;
+    }
+    for ( ChunkKlass *m = _heapKlass; m < heapEnd(); m = m->next() ) {
+        if ( m->isUnused() ) {
+            std::int32_t i = 0;
+            for ( std::int32_t s = m->size(); s > 1 and i < histogram_size - 1; s >>= 1 )
+                i++;
+            counts[ i ]++;
+            bytes[ i ] += m->size() << log2BS;
+        }
+    }
+}
+
+
+std::int32_t ZoneHeap::largestFreeChunk() const {
+    std::int32_t largest = 0;
+    for ( ChunkKlass *m = _heapKlass; m < heapEnd(); m = m->next() ) {
+        if ( m->isUnused() and m->size() > largest )
+            largest = m->size();
+    }
+    return largest << log2BS;
+}
+
+
+void ZoneHeap::print_fragmentation() const {
+    std::int32_t counts[histogram_size];
+    std::int32_t bytes[histogram_size];
+    free_histogram( counts, bytes );
+
+    std::int32_t largest = largestFreeChunk();
+    SPDLOG_INFO( "  {:d}K free, largest free chunk {:d}K ({:1.1f}% of free space)", freeBytes() / 1024, largest / 1024, freeBytes() ? 100.0 * largest / freeBytes() : 100.0 );
+    for ( std::int32_t i = 0; i < histogram_size; i++ ) {
+        if ( counts[ i ] > 0 )
+            SPDLOG_INFO( "  {:>8d} bytes and up: {:>6d} chunks, {:>8d}K", ( 1 << i ) * blockSize, counts[ i ], bytes[ i ] / 1024 );
+    }
 }
@@ -15,6 +15,14 @@
 // Basic heap management
 // maintains a map of the heap + free lists to reduce fragmentation
 // allocations are in multiples of block size (2**k)
+//
+// Free chunks of up to nfree blocks are kept in one list per size; larger ones are segregated into
+// nbig size classes (class i holds chunks of (nfree+1)*2^i .. (nfree+1)*2^(i+1)-1 blocks), so an
+// allocation only has to search one list and tends to reuse a chunk of about the right size.
+// Chunks are never moved once allocated.
+//
+// An allocation that splits a chunk normally takes its beginning; allocate(..., true) takes its end instead,
+// so two kinds of allocations can be kept apart, growing from the two ends of the heap (see Zone::allocate).
 
 //class HeapChunk;
 //
@@ -256,6 +264,9 @@ protected:
 public:
     std::int32_t blockSize;              // allocation unit in bytes (must be power of 2)
     std::int32_t nfree;                  // number of free lists
+    std::int32_t nbig;                   // number of size classes for big chunks
+
+    static constexpr std::int32_t histogram_size = 24;  // number of size classes in free_histogram
 
 protected:
     std::int32_t log2BS;         // log2(blockSize)
@@ -267,7 +278,7 @@ protected:
 
     ChunkKlass *_heapKlass;     // map of heap (1 byte / block)
     FreeList   *_freeList;      // array of free lists for different chunk sizes
-    FreeList   *_bigList;       // list of all big free blocks
+    FreeList   *_bigLists;      // array of lists of big free blocks, one per size class
     ChunkKlass *_lastCombine;   // result of last block combination
 
 public:
@@ -289,7 +300,7 @@ public:
     void clear();
 
     // Allocation
-    void *allocate( std::int32_t wantedBytes );    // returns nullptr if allocation failed
+    void *allocate( std::int32_t wantedBytes, bool atTop = false );    // returns nullptr if allocation failed
     void deallocate( void *p, std::int32_t bytes );
 
     // Compaction
@@ -322,6 +333,16 @@ public:
     }
 
 
+    // Fills counts and bytes (histogram_size elements each) with the number and total size of the free
+    // chunks of 2^i .. 2^(i+1)-1 blocks; the last class also holds all bigger chunks
+    void free_histogram( std::int32_t *counts, std::int32_t *bytes ) const;
+
+    // Size in bytes of the biggest free chunk (i.e. of the biggest possible allocation)
+    std::int32_t largestFreeChunk() const;
+
+    void print_fragmentation() const;
+
+
     // Location
     const char *startAddr() const {
         return base;
@@ -375,10 +396,12 @@ protected:
 
 
     // Free list management
-    void *allocFromLists( std::int32_t wantedBytes );
+    void *allocFromLists( std::int32_t wantedBytes, bool atTop );
 
     bool addToFreeList( ChunkKlass *m );
 
+    std::int32_t bigListIndex( std::int32_t blocks ) const;
+
     void removeFromFreeList( ChunkKlass *m );
 
     std::int32_t combineAll();
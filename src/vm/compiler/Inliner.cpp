@@ -13,6 +13,7 @@
 #include "vm/compiler/RecompilationScope.hpp"
 #include "vm/oop/KlassOopDescriptor.hpp"
 #include "vm/lookup/LookupCache.hpp"
+#include "vm/lookup/ClassHierarchyAnalysis.hpp"
 #include "vm/compiler/NodeFactory.hpp"
 
 
@@ -204,6 +205,43 @@ Expression *Inliner::inlineMerge( SendInfo *info ) {
     std::size_t nexprs = r->exprs->length();
     std::size_t ncases = nexprs - ( r->containsUnknown() ? 1 : 0 );
 
+    // if the PolymorphicInlineCache counted its hits, only the MaxTypeCaseSize most frequent cases are type-cased,
+    // and only those with at least MinTypeCaseFrequency percent of the hits; the others are left to the real send
+    GrowableArray<std::int32_t> *rare       = new GrowableArray<std::int32_t>( nexprs, nexprs, false );
+    std::int32_t                totalHits   = 0;
+    bool                        frequencies = true;
+    for ( std::size_t i = 0; i < nexprs; i++ ) {
+        std::int32_t hits = r->exprs->at( i )->isUnknownExpression() ? 0 : picHits( r->exprs->at( i ) );
+        if ( hits < 0 ) {
+            frequencies = false;
+            break;
+        }
+        totalHits += hits;
+    }
+    if ( frequencies and totalHits > 0 ) {
+        for ( std::size_t i = 0; i < nexprs; i++ ) {
+            Expression *nth = r->exprs->at( i );
+            if ( nth->isUnknownExpression() )
+                continue;
+            std::int32_t hits = picHits( nth );
+            std::size_t  rank = 0;                // # of cases more frequent than this one
+            for ( std::size_t j = 0; j < nexprs; j++ ) {
+                Expression *other = r->exprs->at( j );
+                if ( j not_eq i and not other->isUnknownExpression() ) {
+                    std::int32_t otherHits = picHits( other );
+                    if ( otherHits > hits or ( otherHits == hits and j < i ) )
+                        rank++;
+                }
+            }
+            if ( rank >= static_cast<std::size_t>( MaxTypeCaseSize ) or hits * 100 < MinTypeCaseFrequency * totalHits ) {
+                rare->at_put( i, true );
+                ncases--;
+                if ( CompilerDebug )
+                    cout( PrintInlining )->print( "%*s*not type-casing %s for %s (%d of %d hits)\n", depth, "", sel->as_string(), nth->klass()->print_value_string(), hits, totalHits );
+            }
+        }
+    }
+
     if ( ncases > MaxTypeCaseSize ) {
         info->_needRealSend = true;
         info->uninlinable   = true;
@@ -233,7 +271,11 @@ Expression *Inliner::inlineMerge( SendInfo *info ) {
         }
 
         InlinedScope *s;
-        if ( nth->hasKlass() and ( s = tryLookup( nth ) ) not_eq nullptr ) {
+        if ( rare->at( i ) ) {
+            // infrequent case -- not worth a type test
+            others->append( nth );
+            info->_needRealSend = true;
+        } else if ( nth->hasKlass() and ( s = tryLookup( nth ) ) not_eq nullptr ) {
             // can inline this case
             KlassOop klass = nth->klass();
             if ( klass == smiKlassObject ) {
@@ -350,6 +392,19 @@ Expression *Inliner::inlineMerge( SendInfo *info ) {
 }
 
 
+std::int32_t Inliner::picHits( Expression *receiver ) {
+    if ( not receiver->hasKlass() or not _sender->rscope->hasSubScopes( _sender->byteCodeIndex() ) )
+        return -1;
+    GrowableArray<RecompilationScope *> *predictedReceivers = _sender->rscope->subScopes( _sender->byteCodeIndex() );
+    for ( std::size_t i = 0; i < predictedReceivers->length(); i++ ) {
+        RecompilationScope *s = predictedReceivers->at( i );
+        if ( s->isPICScope() and ( (PICRecompilationScope *) s )->receiverKlass() == receiver->klass() )
+            return ( (PICRecompilationScope *) s )->hits();
+    }
+    return -1;
+}
+
+
 Expression *Inliner::makeResult( Expression *r ) {
     Expression *res;
     // massage the result expression so it fulfills all constraints
@@ -481,7 +536,7 @@ Expression *Inliner::picPredict() {
     // extract klasses from PolymorphicInlineCache
     GrowableArray<Expression *> klasses( 5 );
     MergeExpression             *allKlasses                 = new MergeExpression( _info->_receiver->pseudoRegister(), nullptr );
-    std::int32_t                i                           = 0;
+    std::size_t                 i                           = 0;
     for ( ; i < predictedReceivers->length(); i++ ) {
         RecompilationScope *r    = predictedReceivers->at( i );
         Expression         *expr = r->receiverExpression( _info->_receiver->pseudoRegister() );
@@ -630,6 +685,8 @@ Expression *Inliner::typePredict() {
     } else if ( InliningPolicy::isPredictedBoolSelector( _info->_selector ) ) {
         r = r->mergeWith( new ConstantExpression( trueObject, r->pseudoRegister(), nullptr ), nullptr );
         r = r->mergeWith( new ConstantExpression( falseObject, r->pseudoRegister(), nullptr ), nullptr );
+    } else if ( UseClassHierarchyAnalysis and _sendKind == SendKind::NormalSend ) {
+        return classHierarchyPredict( r );
     } else {
         return r;
     }
@@ -643,6 +700,23 @@ Expression *Inliner::typePredict() {
 }
 
 
+Expression *Inliner::classHierarchyPredict( Expression *r ) {
+    // the selector has a single implementation: type-case the classes that inherit it
+    // NB: the unknown case isn't made unlikely, classes outside the system dictionary may understand the selector too;
+    // the inlined cases depend on their klasses (see doInline), so a new override invalidates the code
+    GrowableArray<KlassOop> *klasses = ClassHierarchyAnalysis::unique_implementation_receivers( _info->_selector, MaxTypeCaseSize );
+    if ( klasses == nullptr )
+        return r;
+
+    for ( std::size_t i = 0; i < klasses->length(); i++ ) {
+        r = r->mergeWith( new KlassExpression( klasses->at( i ), r->pseudoRegister(), nullptr ), nullptr );
+    }
+    if ( CompilerDebug )
+        cout( PrintInlining )->print( "%*s*CHA-predicting %s (%ld receivers)\n", depth, "", _info->_selector->as_string(), klasses->length() );
+    return r;
+}
+
+
 bool SuperSendsAreAlwaysInlined = true;    // remove when removing super hack
 
 InlinedScope *Inliner::tryLookup( Expression *receiver ) {
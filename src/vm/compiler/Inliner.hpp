@@ -110,12 +110,16 @@ protected:
 
     Expression *inlineMerge( SendInfo *info );
 
+    std::int32_t picHits( Expression *receiver );     // PolymorphicInlineCache hits for receiver's klass (-1 == unknown)
+
     Expression *picPredict();
 
     Expression *picPredictUnlikely( SendInfo *info, UntakenRecompilationScope *uscope );
 
     Expression *typePredict();
 
+    Expression *classHierarchyPredict( Expression *r );
+
     Expression *genRealSend();
 
     InlinedScope *tryLookup( Expression *receiver );      // try lookup and determine if should inline send
@@ -40,7 +40,9 @@ NodeBuilder::NodeBuilder() :
     _expressionStack{ nullptr },
     _inliner{ nullptr },
     _scope{ nullptr },
-    _current{ nullptr } {
+    _current{ nullptr },
+    _floatBoxes{ nullptr },
+    _floatBoxSources{ nullptr } {
 }
 
 
@@ -49,6 +51,8 @@ void NodeBuilder::initialize( InlinedScope *scope ) {
     _inliner         = new Inliner( scope );
     _scope           = scope;
     _current         = nullptr;
+    _floatBoxes      = new GrowableArray<PseudoRegister *>( 4 );
+    _floatBoxSources = new GrowableArray<std::int32_t>( 4 );
 }
 
 
@@ -138,7 +142,9 @@ bool NodeBuilder::abortIfDead( Expression *e ) {
 void NodeBuilder::generate_subinterval( MethodInterval *m, bool produces_result ) {
     st_assert( not aborting(), "shouldn't generate when already aborting" );
     std::int32_t   savedLen = exprStack()->length();
+    forget_float_boxes();    // the subinterval may be executed more than once or not at all
     MethodIterator mi( m, this );
+    forget_float_boxes();
     if ( aborting() ) {
         // the subinterval ended with dead code
         Expression *res = exprStack()->isEmpty() ? nullptr : exprStack()->top();
@@ -1282,11 +1288,53 @@ void NodeBuilder::float_allocate( std::int32_t nofFloatTemps, std::int32_t nofFl
 }
 
 
+void NodeBuilder::record_float_box( PseudoRegister *box, std::int32_t fno ) {
+    if ( not EliminateFloatBoxing or UseFPUStack )
+        return;    // with UseFPUStack, float_at doesn't answer the same PseudoRegister for expression floats
+    _floatBoxes->append( box );
+    _floatBoxSources->append( fno );
+}
+
+
+std::int32_t NodeBuilder::float_box_source( PseudoRegister *box ) const {
+    for ( std::size_t i = 0; i < _floatBoxes->length(); i++ ) {
+        if ( _floatBoxes->at( i ) == box )
+            return _floatBoxSources->at( i );
+    }
+    return -1;
+}
+
+
+void NodeBuilder::float_assigned( std::int32_t fno ) {
+    for ( std::size_t i = 0; i < _floatBoxes->length(); i++ ) {
+        if ( _floatBoxSources->at( i ) == fno )
+            _floatBoxSources->at_put( i, -1 );
+    }
+}
+
+
+void NodeBuilder::forget_float_boxes() {
+    _floatBoxes->clear();
+    _floatBoxSources->clear();
+}
+
+
 void NodeBuilder::float_floatify( Floats::Function f, std::int32_t fno ) {
     st_unused( f ); // unused
 
     // top of stack must be a boxed float, it is unboxed and stored at float(fno).
     Expression *t = _expressionStack->pop();
+    std::int32_t src = float_box_source( t->pseudoRegister() );
+    if ( src >= 0 ) {
+        // t was boxed from float(src) which still holds the value -> no unboxing needed;
+        // the box itself is removed as dead code unless it escapes (send, store, return)
+        if ( src not_eq fno ) {
+            float_assigned( fno );
+            append( NodeFactory::createAndRegisterNode<AssignNode>( float_at( src ), float_at( fno ) ) );
+        }
+        return;
+    }
+    float_assigned( fno );
     if ( t->hasKlass() and t->klass() == doubleKlassObject ) {
         // no type test needed
     } else {
@@ -1298,12 +1346,14 @@ void NodeBuilder::float_floatify( Floats::Function f, std::int32_t fno ) {
 
 void NodeBuilder::float_move( std::int32_t to, std::int32_t from ) {
     // float(to) := float(from)
+    float_assigned( to );
     append( NodeFactory::createAndRegisterNode<AssignNode>( float_at( from ), float_at( to ) ) );
 }
 
 
 void NodeBuilder::float_set( std::int32_t to, DoubleOop value ) {
     // float(to) := value
+    float_assigned( to );
     ConstPseudoRegister *val = new_ConstPseudoRegister( _scope, value );
     append( NodeFactory::createAndRegisterNode<AssignNode>( val, float_at( to ) ) );
 }
@@ -1347,6 +1397,7 @@ void NodeBuilder::float_unary( Floats::Function f, std::int32_t fno ) {
         case Floats::Function::ln: Unimplemented();
         default: st_fatal1( "bad float unary code %d", f );
     }
+    float_assigned( fno );
     PseudoRegister *pseudoRegister = float_at( fno );
     append( NodeFactory::createAndRegisterNode<FloatUnaryArithNode>( op, pseudoRegister, pseudoRegister ) );
 }
@@ -1376,6 +1427,7 @@ void NodeBuilder::float_binary( Floats::Function f, std::int32_t fno ) {
             break;
         default: st_fatal1( "bad float binary code %d", f );
     }
+    float_assigned( fno );
     PseudoRegister *op1 = float_at( fno );
     PseudoRegister *op2 = float_at( fno + 1 );
     append( NodeFactory::createAndRegisterNode<FloatArithRRNode>( op, op1, op2, op1 ) );
@@ -1399,6 +1451,7 @@ void NodeBuilder::float_unaryToOop( Floats::Function f, std::int32_t fno ) {
             break;
         case Floats::Function::oopify: {
             append( NodeFactory::createAndRegisterNode<FloatUnaryArithNode>( ArithOpCode::f2OopArithOp, src, res ) );
+            record_float_box( res, fno );
             Expression *result = new KlassExpression( doubleKlassObject, res, current() );
             _expressionStack->push( result, scope(), scope()->byteCodeIndex() );
         }
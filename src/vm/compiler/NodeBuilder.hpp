@@ -53,6 +53,19 @@ private:
     InlinedScope    *_scope;            // scope for which this NodeBuilder is generating code
     Node            *_current;        // where new nodes are appended
 
+    // Boxed floats (float_unaryToOop oopify) whose float source hasn't been assigned since
+    // the boxing; float_floatify uses the source instead of unboxing them again.
+    GrowableArray<PseudoRegister *> *_floatBoxes;
+    GrowableArray<std::int32_t>     *_floatBoxSources;
+
+    void record_float_box( PseudoRegister *box, std::int32_t fno );
+
+    std::int32_t float_box_source( PseudoRegister *box ) const;    // -1 if box is not a known box
+
+    void float_assigned( std::int32_t fno );            // float(fno) is about to change
+
+    void forget_float_boxes();                          // at control flow merges
+
     void append_exit( Node *exitNode );    // append an exit node (UncommonNode, Return, etc.)
     void append1( Node *node );
 
@@ -72,7 +72,7 @@ InlinedRecompilationScope::InlinedRecompilationScope( NonDummyRecompilationScope
 }
 
 
-PICRecompilationScope::PICRecompilationScope( const NativeMethod *c, ProgramCounterDescriptor *pc, CompiledInlineCache *s, KlassOop k, ScopeDescriptor *dsc, NativeMethod *n, MethodOop m, std::int32_t ns, std::int32_t lev, bool tr ) :
+PICRecompilationScope::PICRecompilationScope( const NativeMethod *c, ProgramCounterDescriptor *pc, CompiledInlineCache *s, KlassOop k, ScopeDescriptor *dsc, NativeMethod *n, MethodOop m, std::int32_t ns, std::int32_t lev, bool tr, std::int32_t hits ) :
     NonDummyRecompilationScope( nullptr, pc->_byteCodeIndex, m, lev ),
     caller{ c },
     _sd{ s },
@@ -82,7 +82,8 @@ PICRecompilationScope::PICRecompilationScope( const NativeMethod *c, ProgramCoun
     _method{ m },
     trusted{ tr },
     _extended{ false },
-    _desc{ dsc } {
+    _desc{ dsc },
+    _hits{ hits } {
 
     //
     _invocationCount = ns;
@@ -425,7 +426,7 @@ static void getCallees( const NativeMethod *nm, GrowableArray<ProgramCounterDesc
                             desc  = nullptr;
                             count = m->invocation_count();
                         }
-                        sends->append( new PICRecompilationScope( nm, p, sd, it.klass(), desc, callee, m, count, level, trusted ) );
+                        sends->append( new PICRecompilationScope( nm, p, sd, it.klass(), desc, callee, m, count, level, trusted, it.hit_count() ) );
                         it.advance();
                     }
                 } else if ( theCompiler and CompilerDebug ) {
@@ -509,9 +509,10 @@ protected:
     const bool                     trusted;        // is PolymorphicInlineCache info trusted?
     bool                           _extended;        // subScopes computed?
     const ScopeDescriptor          *_desc;    // scope (or nullptr if interpreted)
+    const std::int32_t             _hits;        // (decayed) # of PolymorphicInlineCache hits for klass (-1 == unknown)
 
 public:
-    PICRecompilationScope( const NativeMethod *caller, ProgramCounterDescriptor *pc, CompiledInlineCache *s, KlassOop k, ScopeDescriptor *d, NativeMethod *n, MethodOop m, std::int32_t nsends, std::int32_t level, bool trusted );
+    PICRecompilationScope( const NativeMethod *caller, ProgramCounterDescriptor *pc, CompiledInlineCache *s, KlassOop k, ScopeDescriptor *d, NativeMethod *n, MethodOop m, std::int32_t nsends, std::int32_t level, bool trusted, std::int32_t hits = -1 );
     PICRecompilationScope();
     virtual ~PICRecompilationScope() = default;
     PICRecompilationScope( const PICRecompilationScope & ) = default;
@@ -546,6 +547,11 @@ public:
     }
 
 
+    std::int32_t hits() const {
+        return _hits;
+    }
+
+
     CompiledInlineCache *sd() const {
         return (CompiledInlineCache *) _sd;
     }
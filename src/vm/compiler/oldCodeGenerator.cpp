@@ -669,6 +669,33 @@ static void fstore( PseudoRegister *dst, Register base ) {
 }
 
 
+static bool useSSE2() {
+    // The FPU stack locations (UseFPUStack) only exist for the FPU.
+    // Float temporaries are not allocated to xmm registers (yet): each node loads its operands from the float
+    // section of the frame into xmm0/xmm1 and stores the result back.
+    return UseSSE2 and not UseFPUStack;
+}
+
+
+static void fload( PseudoRegister *src, Register base, Register temp, XMMRegister dst ) {
+    st_assert( base not_eq temp, "registers must be different" );
+    // Loads src into dst
+    if ( src->isConstPseudoRegister() ) {
+        theMacroAssembler->movl( temp, ( (ConstPseudoRegister *) src )->constant );
+        theMacroAssembler->movsd( dst, Address( temp, byteOffset( DoubleOopDescriptor::value_offset() ) ) ); // unbox float
+    } else {
+        Mapping::fload( src->_location, base, dst );
+    }
+}
+
+
+static void fstore( PseudoRegister *dst, Register base, XMMRegister src ) {
+    // Stores src to dst
+    st_assert( not dst->isConstPseudoRegister(), "destination cannot be a constant" );
+    Mapping::fstore( dst->_location, base, src );
+}
+
+
 static void storeO( ConstPseudoRegister *src, PseudoRegister *dst, Register temp1, Register temp2, bool needsStoreCheck = true ) {
     // Stores constant src to dst.
     st_assert( not dst->isConstPseudoRegister(), "destination cannot be a constant" );
@@ -703,8 +730,13 @@ static void assign( Node *node, PseudoRegister *src, PseudoRegister *dst, Regist
         if ( node->isAccessingFloats() ) {
             Register base = temp3;
             set_floats_base( node, base );
-            fload( src, base, temp1 );
-            fstore( dst, base );
+            if ( useSSE2() ) {
+                fload( src, base, temp1, xmm0 );
+                fstore( dst, base, xmm0 );
+            } else {
+                fload( src, base, temp1 );
+                fstore( dst, base );
+            }
         } else if ( src->isConstPseudoRegister() ) {
             // assign constants directly without loading into temporary register first
             storeO( (ConstPseudoRegister *) src, dst, temp1, temp2, needsStoreCheck );
@@ -1413,12 +1445,41 @@ static void floatArithRROp( ArithOpCode op ) {
 }
 
 
+static bool sse2FloatArithRROp( ArithOpCode op, XMMRegister x, XMMRegister y ) {
+    // Generates x := x op y and returns true, or returns false if there's no SSE2
+    // instruction for op (the result of ArithOpCode::fCmpArithOp must be an FPU status word).
+    switch ( op ) {
+        case ArithOpCode::fAddArithOp:
+            theMacroAssembler->addsd( x, y );
+            return true;
+        case ArithOpCode::fSubArithOp:
+            theMacroAssembler->subsd( x, y );
+            return true;
+        case ArithOpCode::fMulArithOp:
+            theMacroAssembler->mulsd( x, y );
+            return true;
+        case ArithOpCode::fDivArithOp:
+            theMacroAssembler->divsd( x, y );
+            return true;
+        default:
+            return false;
+    }
+}
+
+
 void FloatArithRRNode::gen() {
     BasicNode::gen();
 //    bool     noResult = ( _op == ArithOpCode::fCmpArithOp );
     bool     exchange = ( _op == ArithOpCode::fModArithOp or _op == ArithOpCode::fCmpArithOp );
     Register base     = temp3;
     set_floats_base( this, base );
+    if ( useSSE2() and _op not_eq ArithOpCode::fModArithOp and _op not_eq ArithOpCode::fCmpArithOp ) {
+        fload( _src, base, temp1, xmm0 );
+        fload( _oper, base, temp2, xmm1 );
+        sse2FloatArithRROp( _op, xmm0, xmm1 );
+        fstore( _dest, base, xmm0 );
+        return;
+    }
     fload( _src, base, temp1 );
     fload( _oper, base, temp2 );
     if ( exchange )
@@ -1506,11 +1567,67 @@ static void floatArithROp( ArithOpCode op, Register reg, Register temp ) {
 }
 
 
+static bool sse2FloatArithROp( ArithOpCode op, Register reg, XMMRegister x, XMMRegister temp ) {
+    // Same as floatArithROp but with the float in x; returns false if op must use the FPU
+    switch ( op ) {
+        case ArithOpCode::fNegArithOp:
+            theMacroAssembler->pcmpeqd( temp, temp );
+            theMacroAssembler->psllq( temp, 63 );            // sign bit only
+            theMacroAssembler->xorpd( x, temp );
+            return true;
+        case ArithOpCode::fAbsArithOp:
+            theMacroAssembler->pcmpeqd( temp, temp );
+            theMacroAssembler->psrlq( temp, 1 );            // all bits but the sign bit
+            theMacroAssembler->andpd( x, temp );
+            return true;
+        case ArithOpCode::fSqrArithOp:
+            theMacroAssembler->mulsd( x, x );
+            return true;
+        case ArithOpCode::f2FloatArithOp: {
+            Label isSmallIntegerOop, is_float, done;
+            Register klass = temp1 == reg ? temp2 : temp1;
+            theMacroAssembler->test( reg, MEMOOP_TAG );            // check if small_int_t
+            theMacroAssembler->jcc( Assembler::Condition::zero, isSmallIntegerOop );
+            theMacroAssembler->movl( klass, Address( reg, MemOopDescriptor::klass_byte_offset() ) );    // get object klass
+            theMacroAssembler->cmpl( klass, doubleKlass_addr() );        // check if floatOop
+            theMacroAssembler->jcc( Assembler::Condition::equal, is_float );
+            theMacroAssembler->hlt(); // not yet implemented		// cannot be converted
+
+            // convert small_int_t
+            theMacroAssembler->bind( isSmallIntegerOop );
+            theMacroAssembler->sarl( reg, TAG_SIZE );            // convert small_int_t into std::int32_t
+            theMacroAssembler->cvtsi2sd( x, reg );            // convert into FloatValue
+            theMacroAssembler->jmp( done );
+
+            // unbox DoubleOop
+            theMacroAssembler->bind( is_float );
+            theMacroAssembler->movsd( x, Address( reg, byteOffset( DoubleOopDescriptor::value_offset() ) ) ); // unbox float
+
+            theMacroAssembler->bind( done );
+        }
+            return true;
+        default:
+            return false;    // f2OopArithOp: StubRoutines::oopify_float takes its argument in ST
+    }
+}
+
+
 void FloatUnaryArithNode::gen() {
     BasicNode::gen();
     Register reg;
     Register base = temp3;
     set_floats_base( this, base );
+    if ( useSSE2() and _op not_eq ArithOpCode::f2OopArithOp ) {
+        if ( _op == ArithOpCode::f2FloatArithOp ) {
+            reg = movePseudoRegisterToReg( _src, temp1 );
+        } else {
+            fload( _src, base, temp1, xmm0 );
+            reg = temp1;
+        }
+        sse2FloatArithROp( _op, reg, xmm0, xmm1 );
+        fstore( _dest, base, xmm0 );
+        return;
+    }
     if ( Mapping::isFloatTemporary( _src->_location ) or _src->_location == Location::TOP_OF_FLOAT_STACK ) {
         // load argument on FPU stack & setup reg if result is an Oop
         fload( _src, base, temp1 );
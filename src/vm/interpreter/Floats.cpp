@@ -147,12 +147,127 @@ void Floats::generate_cmp(MacroAssembler *masm, Assembler::Condition cc) {
 	masm->bind(L);
 }
 
-void Floats::generate(MacroAssembler *masm, Function f) {
+void Floats::generate_sse2_tst(MacroAssembler *masm, Assembler::Condition cc) {
+	masm->xorpd(xmm1, xmm1);
+	generate_sse2_cmp(masm, cc, false);
+}
 
-	//
-	const char *entry_point = masm->pc();
+void Floats::generate_sse2_cmp(MacroAssembler *masm, Assembler::Condition cc, bool swap) {
+	// ucomisd sets the flags like an unsigned compare; unordered operands (NaN) set ZF, PF and CF
+	// so that only the (not) equal tests have to look at the parity flag.
+	Label is_true, is_false, done;
+	if (swap) {
+		masm->ucomisd(xmm1, xmm0);
+	}
+	else {
+		masm->ucomisd(xmm0, xmm1);
+	}
+	if (cc == Assembler::Condition::equal) {
+		masm->jcc(Assembler::Condition::parity, is_false);
+	}
+	else if (cc == Assembler::Condition::notEqual) {
+		masm->jcc(Assembler::Condition::parity, is_true);
+	}
+	masm->jcc(cc, is_true);
+	masm->bind(is_false);
+	masm->movl(eax, Address((std::int32_t) &falseObject, RelocationInformation::RelocationType::external_word_type));
+	masm->jmp(done);
+	masm->bind(is_true);
+	masm->movl(eax, Address((std::int32_t) &trueObject, RelocationInformation::RelocationType::external_word_type));
+	masm->bind(done);
+}
 
-	//
+void Floats::generate_sse2(MacroAssembler *masm, Function f) {
+	switch (f) {
+		// nullary functions
+		case Floats::Function::zero:
+			masm->xorpd(xmm0, xmm0);
+			break;
+
+		case Floats::Function::one:
+			masm->movl(eax, 1);
+			masm->cvtsi2sd(xmm0, eax);
+			break;
+
+			// unary functions
+		case Floats::Function::abs:
+			masm->pcmpeqd(xmm1, xmm1);    // all bits set
+			masm->psrlq(xmm1, 1);            // all bits but the sign bit
+			masm->andpd(xmm0, xmm1);
+			break;
+		case Floats::Function::negated:
+			masm->pcmpeqd(xmm1, xmm1);    // all bits set
+			masm->psllq(xmm1, 63);            // sign bit only
+			masm->xorpd(xmm0, xmm1);
+			break;
+		case Floats::Function::squared:
+			masm->mulsd(xmm0, xmm0);
+			break;
+		case Floats::Function::sqrt:
+			masm->sqrtsd(xmm0, xmm0);
+			break;
+
+			// binary functions
+		case Floats::Function::add:
+			masm->addsd(xmm0, xmm1);
+			break;
+		case Floats::Function::subtract:
+			masm->subsd(xmm0, xmm1);
+			break;
+		case Floats::Function::multiply:
+			masm->mulsd(xmm0, xmm1);
+			break;
+		case Floats::Function::divide:
+			masm->divsd(xmm0, xmm1);
+			break;
+		case Floats::Function::modulo:
+			// there's no SSE2 remainder instruction -> go through the FPU
+			masm->subl(esp, 2 * SIZEOF_FLOAT);
+			masm->movsd(Address(esp, SIZEOF_FLOAT), xmm1);
+			masm->movsd(Address(esp), xmm0);
+			masm->fld_d(Address(esp, SIZEOF_FLOAT));
+			masm->fld_d(Address(esp));
+			masm->fprem();
+			masm->fstp_d(Address(esp));
+			masm->fpop();
+			masm->movsd(xmm0, Address(esp));
+			masm->addl(esp, 2 * SIZEOF_FLOAT);
+			break;
+
+			// unary functions to Oop
+		case Floats::Function::is_zero:
+			generate_sse2_tst(masm, Assembler::Condition::equal);
+			break;
+		case Floats::Function::is_not_zero:
+			generate_sse2_tst(masm, Assembler::Condition::notEqual);
+			break;
+
+			// binary functions to Oop
+			// (Note: less is tested as swapped greater so that unordered operands answer false)
+		case Floats::Function::is_equal:
+			generate_sse2_cmp(masm, Assembler::Condition::equal, false);
+			break;
+		case Floats::Function::is_not_equal:
+			generate_sse2_cmp(masm, Assembler::Condition::notEqual, false);
+			break;
+		case Floats::Function::is_less:
+			generate_sse2_cmp(masm, Assembler::Condition::above, true);
+			break;
+		case Floats::Function::is_less_equal:
+			generate_sse2_cmp(masm, Assembler::Condition::aboveEqual, true);
+			break;
+		case Floats::Function::is_greater:
+			generate_sse2_cmp(masm, Assembler::Condition::above, false);
+			break;
+		case Floats::Function::is_greater_equal:
+			generate_sse2_cmp(masm, Assembler::Condition::aboveEqual, false);
+			break;
+
+		default: ShouldNotReachHere();
+	}
+}
+
+void Floats::generate_fpu(MacroAssembler *masm, Function f) {
 	switch (f) {
 		// nullary functions
 		case Floats::Function::zero:
@@ -174,17 +289,8 @@ void Floats::generate(MacroAssembler *masm, Function f) {
 			masm->fmul(0);
 			break;
 		case Floats::Function::sqrt:
-			masm->int3(); // Unimplemented         break;
-		case Floats::Function::sin:
-			masm->int3(); // Unimplemented         break;
-		case Floats::Function::cos:
-			masm->int3(); // Unimplemented         break;
-		case Floats::Function::tan:
-			masm->int3(); // Unimplemented         break;
-		case Floats::Function::exp:
-			masm->int3(); // Unimplemented         break;
-		case Floats::Function::ln:
-			masm->int3(); // Unimplemented         break;
+			masm->int3(); // Unimplemented
+			break;
 
 			// binary functions
 		case Floats::Function::add:
@@ -211,8 +317,6 @@ void Floats::generate(MacroAssembler *masm, Function f) {
 		case Floats::Function::is_not_zero:
 			generate_tst(masm, Assembler::Condition::notZero);
 			break;
-		case Floats::Function::oopify:
-			masm->hlt();    // see InterpreterGenerator     break;
 
 			// binary functions to Oop
 			// (Note: This is comparing ST(1) with ST while the bits in the FPU status word (assume comparison of ST with ST(1) -> reverse the conditions).
@@ -237,6 +341,34 @@ void Floats::generate(MacroAssembler *masm, Function f) {
 
 		default: ShouldNotReachHere();
 	}
+}
+
+void Floats::generate(MacroAssembler *masm, Function f) {
+
+	//
+	const char *entry_point = masm->pc();
+
+	// the functions without an implementation are the same for the FPU and SSE2
+	switch (f) {
+		case Floats::Function::sin:
+		case Floats::Function::cos:
+		case Floats::Function::tan:
+		case Floats::Function::exp:
+		case Floats::Function::ln:
+			masm->int3(); // Unimplemented
+			break;
+		case Floats::Function::oopify:
+			masm->hlt();    // see InterpreterGenerator
+			break;
+
+		default:
+			if (UseSSE2) {
+				generate_sse2(masm, f);
+			}
+			else {
+				generate_fpu(masm, f);
+			}
+	}
 	masm->ret(0);
 	_function_table[static_cast<std::int32_t>(f)] = entry_point;
 
@@ -14,6 +14,9 @@
 
 // Floats describes the floating point operations of the interpreter and implements stub routines used to execute this operations.
 // Note: The Floats stub routines are *inside* the interpreter code.
+//
+// The stubs take their arguments on the FPU stack, or with UseSSE2 in xmm0 (float(i)) and xmm1 (float(i + 1)).
+// Float results are returned in ST or xmm0, Oop results in eax.
 
 class Floats : AllStatic {
 
@@ -78,6 +81,14 @@ private:
 
 	static void generate(MacroAssembler *masm, Function f);
 
+	static void generate_fpu(MacroAssembler *masm, Function f);
+
+	static void generate_sse2_tst(MacroAssembler *masm, Assembler::Condition cc);
+
+	static void generate_sse2_cmp(MacroAssembler *masm, Assembler::Condition cc, bool swap);
+
+	static void generate_sse2(MacroAssembler *masm, Function f);
+
 public:
 	// Dispatch (interpreter)
 	// Note: _function_table is bigger than number_of_functions to catch illegal (byte) indices // XXX
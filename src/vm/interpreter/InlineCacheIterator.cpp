@@ -201,6 +201,16 @@ NativeMethod *CompiledInlineCacheIterator::compiled_method() const {
 	}
 }
 
+std::int32_t CompiledInlineCacheIterator::hit_count() const {
+	st_assert(not at_end(), "iterated over the end");
+	if (_picit not_eq nullptr) {
+		return _picit->hit_count();
+	}
+	else {
+		return -1;
+	}
+}
+
 void CompiledInlineCacheIterator::print() {
 	//SPDLOG_INFO( "CompiledInlineCacheIterator for ((CompiledInlineCache*)0x{0:x}) ({})", static_cast<void *>( _ic ), selector()->as_string() );
 }
@@ -211,6 +211,8 @@ private:
 	InlineState _state;                  // current iterator state
 	std::int32_t _methodOop_counter;      // remaining no. of methodOop entries
 	std::int32_t *nativeMethod_disp_addr() const;   // valid if state() in {InlineState::AT_SMI_NATIVE_METHOD, InlineState::AT_NATIVE_METHOD}
+	const char *smi_entry() const;                  // valid if state() is InlineState::AT_SMI_NATIVE_METHOD
+	std::int32_t *count_addr() const;               // valid if not at_end()
 	void computeNextState();
 
 public:
@@ -248,6 +250,9 @@ public:
 
 	NativeMethod *compiled_method() const;
 
+	// the number of times the current entry was hit (decayed by the sweeper)
+	std::int32_t hit_count() const;
+
 	// Modifying PolymorphicInlineCache entries
 	void set_klass(KlassOop klass);
 
@@ -324,6 +329,9 @@ public:
 	MethodOop interpreted_method() const;   // current target method (whether compiled or not)
 	NativeMethod *compiled_method() const; // current compiled target or nullptr if interpreted
 
+	// number of hits of the current target, or -1 if not counted (MONOMORPHIC send to an NativeMethod)
+	std::int32_t hit_count() const;
+
 	// Debugging
 	void print();
 };
@@ -16,6 +16,7 @@
 #include "vm/interpreter/Floats.hpp"
 #include "vm/memory/OopFactory.hpp"
 #include "vm/runtime/ResourceMark.hpp"
+#include "vm/recompiler/Recompilation.hpp"
 
 
 //
@@ -52,6 +53,7 @@ const char *Interpreter::_code_end_addr = nullptr;
 
 std::int32_t Interpreter::_interpreter_loop_counter = 0;
 std::int32_t Interpreter::_interpreter_loop_counter_limit = 0;
+std::int32_t Interpreter::_loop_backoff = 1;
 
 bool Interpreter::contains(const char *pc) {
 	return (_code_begin_addr <= pc and pc < _code_end_addr) or (pc == StubRoutines::single_step_continuation());
@@ -103,8 +105,9 @@ void Interpreter::print_code_status() {
 void Interpreter::loop_counter_overflow() {
 
 	const bool debug = false;
-	MethodOop method = DeltaProcess::active()->last_frame().method();
-	method->set_invocation_count(method->invocation_count() + loop_counter_limit());
+	Frame f = DeltaProcess::active()->last_frame();
+	MethodOop method = f.method();
+	std::int32_t count = charge_loop_iterations(method);
 
 	if (debug) {
 		ResourceMark resourceMark;
@@ -113,6 +116,35 @@ void Interpreter::loop_counter_overflow() {
 	}
 
 	reset_loop_counter();
+
+	// An activation looping in the interpreter may never return (e.g. a "do it" or a server's request loop),
+	// so waiting for the next invocation to hit the invocation counter overflow in the method prologue would
+	// keep it out of the optimizing compiler forever. Trigger the recompilation right away instead: the
+	// running activation continues interpreted, but the compiled method (and any recompiled callees) are
+	// installed in the inline caches and used by all subsequent invocations.
+	// For a loop in a block the RecompilationPolicy picks the home method, as for the block's invocation counter.
+	if (UseRecompilation and UseLoopRecompilation and count >= get_invocation_counter_limit()) {
+		if (debug) {
+			ResourceMark resourceMark;
+			SPDLOG_INFO("loop_counter_overflow: triggering recompilation of method[{}]", method->print_value_string());
+		}
+		loop_recompilation_done(Recompilation::methodOop_loop_counter_overflow(f.receiver(), method));
+	}
+}
+
+std::int32_t Interpreter::charge_loop_iterations(MethodOop method) {
+	// saturating, the counter is only 16 bits wide
+	std::int32_t count = min(method->invocation_count() + loop_counter_limit(), static_cast<std::int32_t>( MethodOopDescriptor::_invocation_count_max ));
+	method->set_invocation_count(count);
+	return count;
+}
+
+void Interpreter::loop_recompilation_done(bool recompiled) {
+	// The recompilation resets the trigger's counter, so without a back-off a method the policy refuses to
+	// recompile would be tried again at every overflow. The loop counter is shared by all methods; starting
+	// it below 0 delays the next overflow.
+	_loop_backoff = recompiled ? 1 : min(2 * _loop_backoff, max_loop_backoff);
+	_interpreter_loop_counter = -(_loop_backoff - 1) * loop_counter_limit();
 }
 
 std::int32_t Interpreter::loop_counter() {
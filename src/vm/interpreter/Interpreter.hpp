@@ -90,12 +90,29 @@ public:
 	static void print_code_status();
 
 	// Loops
+	//
+	// A loop counter overflow charges the iterations to the method running the loop and may recompile it, but
+	// only later sends use the new NativeMethod. There is no on-stack replacement: the looping activation itself
+	// stays interpreted, since compiled code has no loop-header entry that an interpreted frame could migrate to.
 	static void loop_counter_overflow();            // this routine gets called when the loop counter overflows
 	static std::int32_t loop_counter();                      // the number of loop iterations since the last reset
 	static void reset_loop_counter();               // resets the loop counter to 0
 	static std::int32_t loop_counter_limit();                // the loop counter limit
 	static void set_loop_counter_limit(std::int32_t limit);
 
+	// charges a loop counter overflow to the invocation counter of method (a method or block method); returns the new count
+	static std::int32_t charge_loop_iterations(MethodOop method);
+
+	// a refused loop recompilation doubles the iterations until the next overflow (up to max_loop_backoff times
+	// the limit); a successful one resets the back-off
+	static constexpr std::int32_t max_loop_backoff = 64;
+
+	static void loop_recompilation_done(bool recompiled);
+
+	static std::int32_t loop_backoff() {
+		return _loop_backoff;
+	}
+
 	static std::int32_t *loop_counter_addr();
 
 	static std::int32_t *loop_counter_limit_addr();
@@ -149,6 +166,7 @@ public:
 
 	static std::int32_t _interpreter_loop_counter;
 	static std::int32_t _interpreter_loop_counter_limit;
+	static std::int32_t _loop_backoff;                       // current multiple of the loop counter limit
 
 	// Initialization
 	static bool is_initialized() {
@@ -1160,8 +1160,14 @@ const char *InterpreterGenerator::float_floatify() {
 
 	// unbox DoubleOop
 	_macroAssembler->movb(ebx, Address(esi, -1));        // get float number
-	_macroAssembler->fld_d(Address(eax, byteOffset(DoubleOopDescriptor::value_offset()))); // unbox float
-	_macroAssembler->fstp_d(float_addr(ebx));        // store float
+	if (UseSSE2) {
+		_macroAssembler->movsd(xmm0, Address(eax, byteOffset(DoubleOopDescriptor::value_offset()))); // unbox float
+		_macroAssembler->movsd(float_addr(ebx), xmm0);    // store float
+	}
+	else {
+		_macroAssembler->fld_d(Address(eax, byteOffset(DoubleOopDescriptor::value_offset()))); // unbox float
+		_macroAssembler->fstp_d(float_addr(ebx));        // store float
+	}
 	load_ebx();
 	_macroAssembler->popl(eax);                // discard argument
 	jump_ebx();
@@ -1171,9 +1177,15 @@ const char *InterpreterGenerator::float_floatify() {
 	_macroAssembler->movb(ebx, Address(esi, -1));        // get float number
 	_macroAssembler->leal(ecx, float_addr(ebx));
 	_macroAssembler->sarl(eax, TAG_SIZE);            // convert small_int_t argument into std::int32_t
-	_macroAssembler->movl(Address(ecx), eax);        // store it in memory (use float target location)
-	_macroAssembler->fild_s(Address(ecx));            // convert it into float
-	_macroAssembler->fstp_d(Address(ecx));            // store float
+	if (UseSSE2) {
+		_macroAssembler->cvtsi2sd(xmm0, eax);        // convert it into float
+		_macroAssembler->movsd(Address(ecx), xmm0);    // store float
+	}
+	else {
+		_macroAssembler->movl(Address(ecx), eax);        // store it in memory (use float target location)
+		_macroAssembler->fild_s(Address(ecx));            // convert it into float
+		_macroAssembler->fstp_d(Address(ecx));            // store float
+	}
 	load_ebx();
 	_macroAssembler->popl(eax);                // discard argument
 	jump_ebx();
@@ -1190,7 +1202,9 @@ const char *InterpreterGenerator::float_oopify() {
 	// here the return address to float_op is on the stack
 	// discard it so that C routine can be called regularly.
 	_macroAssembler->popl(eax);                // discard return address
-	_macroAssembler->fpop();                // pop ST (in order to avoid FPU stack overflows) -> get rid of argument
+	if (not UseSSE2) {
+		_macroAssembler->fpop();            // pop ST (in order to avoid FPU stack overflows) -> get rid of argument
+	}
 	call_C((const char *) Interpreter::oopify_FloatValue);// eax: = oopify_FloatValue() (gets its argument by looking at the last bytecode)
 	load_ebx();
 	jump_ebx();
@@ -1204,9 +1218,16 @@ const char *InterpreterGenerator::float_move() {
 	_macroAssembler->xorl(ecx, ecx);            // clear ecx
 	_macroAssembler->movb(ebx, Address(esi, -1));        // get source float number
 	_macroAssembler->movb(ecx, Address(esi, -2));        // get destination float number
-	_macroAssembler->fld_d(float_addr(ebx));        // load source
-	load_ebx();
-	_macroAssembler->fstp_d(float_addr(ecx));        // store at destination
+	if (UseSSE2) {
+		_macroAssembler->movsd(xmm0, float_addr(ebx));    // load source
+		load_ebx();
+		_macroAssembler->movsd(float_addr(ecx), xmm0);    // store at destination
+	}
+	else {
+		_macroAssembler->fld_d(float_addr(ebx));        // load source
+		load_ebx();
+		_macroAssembler->fstp_d(float_addr(ecx));        // store at destination
+	}
 	_macroAssembler->popl(eax);                // re-adjust esp
 	jump_ebx();
 	return ep;
@@ -1218,8 +1239,14 @@ const char *InterpreterGenerator::float_set() {
 	_macroAssembler->movb(ebx, Address(esi, 1));        // get float number
 	advance_aligned(2 + OOP_SIZE);            // advance to next instruction
 	_macroAssembler->movl(ecx, Address(esi, -OOP_SIZE));    // get DoubleOop address
-	_macroAssembler->fld_d(Address(ecx, byteOffset(DoubleOopDescriptor::value_offset()))); // unbox float
-	_macroAssembler->fstp_d(float_addr(ebx));        // store it
+	if (UseSSE2) {
+		_macroAssembler->movsd(xmm0, Address(ecx, byteOffset(DoubleOopDescriptor::value_offset()))); // unbox float
+		_macroAssembler->movsd(float_addr(ebx), xmm0);    // store it
+	}
+	else {
+		_macroAssembler->fld_d(Address(ecx, byteOffset(DoubleOopDescriptor::value_offset()))); // unbox float
+		_macroAssembler->fstp_d(float_addr(ebx));        // store it
+	}
 	load_ebx();
 	_macroAssembler->popl(eax);                // re-adjust esp
 	jump_ebx();
@@ -1235,12 +1262,27 @@ const char *InterpreterGenerator::float_op(std::int32_t nof_args, bool returns_f
 	_macroAssembler->leal(edx, float_addr(ebx));        // get float address
 	_macroAssembler->movb(ebx, Address(esi, -1));        // get function number
 	_macroAssembler->movl(ecx, Address(noreg, ebx, Address::ScaleFactor::times_4, std::int32_t(Floats::_function_table[0]), RelocationInformation::RelocationType::external_word_type));
-	for (std::size_t i = 0; i < nof_args; i++)
-		_macroAssembler->fld_d(Address(edx, -i * SIZEOF_FLOAT));
+	if (UseSSE2) {
+		// arguments in xmm0 and xmm1 (see Floats)
+		st_assert(nof_args <= 2, "too many arguments for SSE2 float operation");
+		if (nof_args > 0)
+			_macroAssembler->movsd(xmm0, Address(edx));
+		if (nof_args > 1)
+			_macroAssembler->movsd(xmm1, Address(edx, -SIZEOF_FLOAT));
+	}
+	else {
+		for (std::size_t i = 0; i < nof_args; i++)
+			_macroAssembler->fld_d(Address(edx, -i * SIZEOF_FLOAT));
+	}
 	_macroAssembler->call(ecx);                // invoke operation
 	load_ebx();                    // get next byte code
 	if (returns_float) {
-		_macroAssembler->fstp_d(Address(edx));        // store result
+		if (UseSSE2) {
+			_macroAssembler->movsd(Address(edx), xmm0);    // store result
+		}
+		else {
+			_macroAssembler->fstp_d(Address(edx));        // store result
+		}
 		_macroAssembler->popl(eax);                // re-adjust esp
 	}                        // otherwise: result in eax
 	jump_ebx();
@@ -29,7 +29,13 @@ Oop ByteArrayKlass::allocateObjectSize(std::int32_t size, bool permit_scavenge,
 	std::int32_t ni_size = non_indexable_size();
 	std::int32_t obj_size = ni_size + 1 + roundTo(size, OOP_SIZE) / OOP_SIZE;
 	// allocate
-	Oop *result = permit_tenured ? Universe::allocate_tenured(obj_size, false) : Universe::allocate(obj_size, (MemOop *) &k, permit_scavenge);
+	Oop *result;
+	if (permit_tenured)
+		result = Universe::allocate_tenured(obj_size, false);
+	else if (is_pretenured())
+		result = Universe::allocate_tenured(obj_size);
+	else
+		result = Universe::allocate(obj_size, (MemOop *) &k, permit_scavenge);
 
 	if (not result)
 		return nullptr;
@@ -41,7 +41,7 @@ constexpr std::int32_t VTBL_OFFSET = 0;
 //  Klass layout:
 //    [_vtbl                 ]
 //    [_non_indexable_size   ]
-//    [_has_untagged_contents]  can be avoided if prototype is stored.
+//    [_has_untagged_contents]  can be avoided if prototype is stored; also holds the pretenuring bit (see Pretenuring)
 //    [_classVars            ]  class variables copied from mixin
 //    [_methods              ]  customized methods from the mixin
 //    [_superKlass           ]  super
@@ -90,12 +90,36 @@ public:
 		_non_indexable_size = smiOopFromValue(size);
 	}
 
+	// the bits of _has_untagged_contents
+	static constexpr small_int_t untagged_contents_bit = 1;
+	static constexpr small_int_t pretenured_bit = 2;
+
+	// every klass creation path sets the field to a smi (see set_untagged_contents) before the klass is used
+	small_int_t bits() const {
+		st_assert(Oop(_has_untagged_contents)->isSmallIntegerOop(), "klass bits not initialized");
+		return _has_untagged_contents->value();
+	}
+
 	bool has_untagged_contents() const {
-		return _has_untagged_contents == smiOop_one;
+		return (bits() & untagged_contents_bit) not_eq 0;
 	}
 
+	// only done when the klass is set up, when the field is still nil; clears the other bits
 	void set_untagged_contents(bool v) {
-		_has_untagged_contents = v ? smiOop_one : smiOop_zero;
+		_has_untagged_contents = smiOopFromValue(v ? untagged_contents_bit : 0);
+	}
+
+	// instances are allocated in the old generation (UsePretenuring)
+	bool is_pretenured() const {
+		return (bits() & pretenured_bit) not_eq 0;
+	}
+
+	void set_pretenured(bool v) {
+		set_bit(pretenured_bit, v);
+	}
+
+	void set_bit(small_int_t bit, bool v) {
+		_has_untagged_contents = smiOopFromValue(v ? bits() | bit : bits() & ~bit);
 	}
 
 	ObjectArrayOop classVars() const {
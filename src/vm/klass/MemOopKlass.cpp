@@ -93,7 +93,7 @@ Oop MemOopKlass::allocateObject(bool permit_scavenge, bool tenured) {
 	KlassOop k = as_klassOop();
 	std::int32_t size = non_indexable_size();
 
-	Oop *result = basicAllocate(size, &k, permit_scavenge, tenured);
+	Oop *result = basicAllocate(size, &k, permit_scavenge, tenured or is_pretenured());
 	if (not result)
 		return nullptr;
 	// allocate
@@ -176,8 +176,8 @@ Oop MemOopKlass::oop_shallow_copy(Oop obj, bool tenured) {
 
 	if (not as_memOop(clone)->is_new()) {
 		// Remember to update the remembered set if the clone is in old Space.
-		// Note: should we do something special for arrays?
-		Universe::remembered_set->record_store(clone);
+		// All cards, since the scavenger only looks at the dirty cards of object arrays.
+		Universe::remembered_set->record_stores(clone, end);
 	}
 
 	return as_memOop(clone);
@@ -17,7 +17,7 @@ Oop ObjectArrayKlass::allocateObjectSize(std::int32_t size, bool permit_scavenge
 	std::int32_t obj_size = ni_size + 1 + size;
 
 	// allocate
-	Oop *result = tenured ? Universe::allocate_tenured(obj_size, permit_scavenge) : Universe::allocate(obj_size, (MemOop *) &k, permit_scavenge);
+	Oop *result = tenured or is_pretenured() ? Universe::allocate_tenured(obj_size, permit_scavenge) : Universe::allocate(obj_size, (MemOop *) &k, permit_scavenge);
 	if (not result)
 		return nullptr;
 
@@ -6,6 +6,7 @@
 
 #include "vm/klass/WeakArrayKlass.hpp"
 #include "vm/memory/MarkSweep.hpp"
+#include "vm/memory/ParallelScavenge.hpp"
 #include "vm/klass/MemOopKlass.hpp"
 
 KlassOop WeakArrayKlass::create_subclass(MixinOop mixin, Format format) {
@@ -110,8 +111,16 @@ void WeakArrayRegister::begin_scavenge() {
 }
 
 bool WeakArrayRegister::scavenge_register(WeakArrayOop obj) {
-	if (during_registration)
-		weakArrays->push(obj);
+	if (during_registration) {
+		if (ParallelScavenge::is_active()) {
+			// the array grows in the resource area
+			std::lock_guard<std::mutex> lock(*ParallelScavenge::allocation_lock());
+			weakArrays->push(obj);
+		}
+		else {
+			weakArrays->push(obj);
+		}
+	}
 	return during_registration;
 }
 
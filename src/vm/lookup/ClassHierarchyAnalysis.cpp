@@ -0,0 +1,103 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/lookup/ClassHierarchyAnalysis.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/klass/Klass.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/oop/AssociationOopDescriptor.hpp"
+#include "vm/oop/ObjectArrayOopDescriptor.hpp"
+#include "vm/oop/SymbolOopDescriptor.hpp"
+
+
+ClassHierarchyAnalysis::Entry *ClassHierarchyAnalysis::_cache = nullptr;
+
+std::uint32_t ClassHierarchyAnalysis::hash_value(SymbolOop selector) {
+	return ((std::uint32_t) selector) / sizeof(Oop);
+}
+
+bool ClassHierarchyAnalysis::add_receiver(KlassOop klass, SymbolOop selector, MethodOop &method, Entry *entry) {
+	MethodOop m = klass->klass_part()->lookup(selector);
+	if (m == nullptr)
+		return true;
+
+	// a customized copy counts as another implementation too
+	if (method == nullptr)
+		method = m;
+	else if (m not_eq method)
+		return false;
+
+	// the same class may be bound to several globals
+	for (std::int32_t i = 0; i < entry->_length; i++) {
+		if (entry->_klasses[i] == klass)
+			return true;
+	}
+
+	// the entries survive scavenges, so new klasses can't be cached
+	if (entry->_length == max_klasses or not klass->is_old())
+		return false;
+
+	entry->_klasses[entry->_length++] = klass;
+	return true;
+}
+
+bool ClassHierarchyAnalysis::compute(SymbolOop selector, Entry *entry) {
+	entry->_length = 0;
+	MethodOop method = nullptr;
+
+	ObjectArrayOop array = Universe::systemDictionaryObject();
+	for (std::size_t i = 1; i <= array->length(); i++) {
+		AssociationOop assoc = AssociationOop(array->obj_at(i));
+		st_assert(assoc->is_association(), "just checking");
+		if (not assoc->is_constant() or not assoc->value()->is_klass())
+			continue;
+
+		KlassOop klass = KlassOop(assoc->value());
+		if (not add_receiver(klass, selector, method, entry) or not add_receiver(klass->klass(), selector, method, entry)) {
+			entry->_length = 0;
+			return false;
+		}
+	}
+	return entry->_length > 0;
+}
+
+GrowableArray<KlassOop> *ClassHierarchyAnalysis::unique_implementation_receivers(SymbolOop selector, std::int32_t limit) {
+	if (_cache == nullptr) {
+		_cache = new_c_heap_array<Entry>(cache_size);
+		flush();
+	}
+
+	Entry *entry = &_cache[hash_value(selector) % cache_size];
+	if (entry->_selector not_eq selector) {
+		Entry result;
+		compute(selector, &result);
+		if (not selector->is_old())
+			return nullptr;
+		result._selector = selector;
+		*entry = result;
+	}
+
+	if (entry->_length == 0 or entry->_length > limit)
+		return nullptr;
+
+	GrowableArray<KlassOop> *klasses = new GrowableArray<KlassOop>(entry->_length);
+	for (std::int32_t i = 0; i < entry->_length; i++)
+		klasses->append(entry->_klasses[i]);
+	return klasses;
+}
+
+bool ClassHierarchyAnalysis::is_cached(SymbolOop selector) {
+	return _cache not_eq nullptr and _cache[hash_value(selector) % cache_size]._selector == selector;
+}
+
+void ClassHierarchyAnalysis::flush() {
+	if (_cache == nullptr)
+		return;
+
+	for (std::int32_t i = 0; i < cache_size; i++) {
+		_cache[i]._selector = nullptr;
+		_cache[i]._length = 0;
+	}
+}
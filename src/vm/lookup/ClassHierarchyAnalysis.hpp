@@ -0,0 +1,64 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+#include "vm/oop/Oop.hpp"
+#include "vm/utility/GrowableArray.hpp"
+
+
+// ClassHierarchyAnalysis tells the compiler which classes can receive a send whose receiver type is unknown,
+// if the selector has only one implementation among the classes of the system dictionary (and their metaclasses)
+// and few classes inherit it. Inliner::typePredict then type-cases these classes, so the send is inlined
+// without type feedback (UseClassHierarchyAnalysis).
+//
+// The answer is a prediction, not a proof: classes outside the system dictionary (or defined later) still get
+// the real send, as for any other type case. The type tests only check the klass, though, so the compiled code
+// records the predicted classes as dependents; changing one of them (e.g. overriding the method in a subclass)
+// invalidates the code through Zone::mark_dependents_for_deoptimization.
+//
+// Limits: the answer enumerates the receivers, so a method inherited by more than max_klasses classes (or more
+// than MaxTypeCaseSize, the limit Inliner::typePredict passes) gets no answer at all. Deep hierarchies, where a
+// method of a framework superclass is inherited by many subclasses, are therefore not helped; that would need
+// binding the send to the single method behind a dependency on the method itself instead of a type case.
+// Computing an answer scans the whole system dictionary, so it is done once per selector and kept.
+//
+// The answers are cached by selector (negative ones too); the cache is flushed with the LookupCache (class
+// changes, full collections), and a selector whose cache entry was taken by another one is computed again.
+
+class ClassHierarchyAnalysis : AllStatic {
+
+public:
+	static constexpr std::int32_t max_klasses = 8;        // most classes an answer can have
+
+private:
+	struct Entry {
+		SymbolOop _selector;
+		std::int32_t _length;                               // # of klasses, 0 if the selector isn't a candidate
+		KlassOop _klasses[max_klasses];
+	};
+
+	static constexpr std::int32_t cache_size = 1024;
+	static Entry *_cache;
+
+	static std::uint32_t hash_value(SymbolOop selector);
+
+	// scans the system dictionary; returns false if the selector has several implementations or too many receivers
+	static bool compute(SymbolOop selector, Entry *entry);
+
+	static bool add_receiver(KlassOop klass, SymbolOop selector, MethodOop &method, Entry *entry);
+
+public:
+	// the klasses that can understand selector, if they all inherit the same method and there are at most limit of them;
+	// returns nullptr otherwise
+	static GrowableArray<KlassOop> *unique_implementation_receivers(SymbolOop selector, std::int32_t limit);
+
+	// tells whether the answer for selector is in the cache
+	static bool is_cached(SymbolOop selector);
+
+	static void flush();
+};
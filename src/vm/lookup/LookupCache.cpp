@@ -6,6 +6,7 @@
 
 #include "vm/lookup/LookupCache.hpp"
 #include "vm/lookup/CacheElement.hpp"
+#include "vm/lookup/ClassHierarchyAnalysis.hpp"
 #include "vm/runtime/VMOperation.hpp"
 #include "vm/lookup/LookupKey.hpp"
 #include "vm/oop/SymbolOopDescriptor.hpp"
@@ -15,10 +16,15 @@
 #include "vm/compiler/Compiler.hpp"
 #include "vm/runtime/Sweeper.hpp"
 #include "vm/compiler/RecompilationScope.hpp"
+#include "vm/code/PolymorphicInlineCache.hpp"
+#include "vm/code/Zone.hpp"
+#include "vm/memory/Universe.hpp"
 
 std::int32_t LookupCache::number_of_primary_hits;
 std::int32_t LookupCache::number_of_secondary_hits;
 std::int32_t LookupCache::number_of_misses;
+std::int32_t LookupCache::number_of_megamorphic_hits;
+std::int32_t LookupCache::number_of_megamorphic_misses;
 
 static std::array<CacheElement, primary_cache_size> primary;
 static std::array<CacheElement, secondary_cache_size> secondary;
@@ -41,6 +47,13 @@ void LookupCache::flush() {
 	for (std::size_t i = 0; i < secondary_cache_size; i++)
 		secondary[i].clear();
 
+	// Clear the tables of the MICs, they cache entries of this cache
+	if (Universe::code not_eq nullptr)
+		Universe::code->flush_megamorphic_tables();
+
+	// The class hierarchy may have changed, and the analysis caches klasses
+	ClassHierarchyAnalysis::flush();
+
 	// Clear counters
 	number_of_primary_hits = 0;
 	number_of_secondary_hits = 0;
@@ -48,7 +61,10 @@ void LookupCache::flush() {
 }
 
 void LookupCache::flush(LookupKey *key) {
-	// Flush the entry associated the the lookup key
+	// Flush the entry associated the the lookup key, and its copies in the MICs
+	if (Universe::code not_eq nullptr)
+		Universe::code->flush_megamorphic_tables(key);
+
 	std::int32_t primary_index = hash_value(key) % primary_cache_size;
 	std::int32_t secondary_index = primary_index % secondary_cache_size;
 
@@ -325,13 +341,15 @@ Oop LookupCache::normal_lookup(KlassOop receiver_klass, SymbolOop selector) {
 }
 
 static void print_counter(const char *title, std::int32_t counter, std::int32_t total) {
-	//SPDLOG_INFO( "%20s: %3.1f%% ({:d})", title, total == 0 ? 0.0 : 100.0 * (double) counter / (double) total, counter );
+	SPDLOG_INFO("{:>20s}: {:3.1f}% ({:d})", title, total == 0 ? 0.0 : 100.0 * (double) counter / (double) total, counter);
 }
 
 void LookupCache::clear_statistics() {
 	number_of_primary_hits = 0;
 	number_of_secondary_hits = 0;
 	number_of_misses = 0;
+	number_of_megamorphic_hits = 0;
+	number_of_megamorphic_misses = 0;
 }
 
 void LookupCache::print_statistics() {
@@ -340,4 +358,9 @@ void LookupCache::print_statistics() {
 	print_counter("Primary Hit Ratio", number_of_primary_hits, total);
 	print_counter("Secondary Hit Ratio", number_of_secondary_hits, total);
 	print_counter("Miss Ratio", number_of_misses, total);
+
+	std::int32_t megamorphic_total = number_of_megamorphic_hits + number_of_megamorphic_misses;
+	SPDLOG_INFO("Megamorphic Inline Caches: size({:d}), {:d} sends", static_cast<std::int32_t>(PolymorphicInlineCache::Constant::MegamorphicInlineCache_table_size), megamorphic_total);
+	print_counter("MIC Hit Ratio", number_of_megamorphic_hits, megamorphic_total);
+	print_counter("MIC Miss Ratio", number_of_megamorphic_misses, megamorphic_total);
 }
@@ -38,6 +38,11 @@ public:
 	static std::int32_t number_of_secondary_hits;
 	static std::int32_t number_of_misses;
 
+	// MEGAMORPHIC sends, counted by the MIC stub routine: hits in the table of the send site's MIC, and
+	// misses that probe the caches above
+	static std::int32_t number_of_megamorphic_hits;
+	static std::int32_t number_of_megamorphic_misses;
+
 	// Lookup probe into the lookup cache
 	static LookupResult lookup_probe(LookupKey *key);
 
@@ -5,11 +5,13 @@
 //
 
 #include "vm/memory/Generation.hpp"
+#include "vm/memory/OldSpaceFreeList.hpp"
 #include "vm/memory/NewGeneration.hpp"
 #include "vm/memory/OldGeneration.hpp"
 #include "vm/memory/Universe.hpp"
 #include "vm/runtime/flags.hpp"
 #include "vm/memory/WaterMark.hpp"
+#include "vm/oop/MemOopDescriptor.hpp"
 
 void Generation::print() {
 	SPDLOG_INFO(" total {} KBytes, {} percent used ", capacity() / 1024, (100 * used()) / capacity());
@@ -35,29 +37,55 @@ void NewGeneration::swap_spaces() {
 	to()->next_space = nullptr;
 }
 
-void NewGeneration::initialize(ReservedSpace rs, std::int32_t eden_size, std::int32_t surv_size) {
-//    std::int32_t new_size = eden_size + surv_size + surv_size;
+void NewGeneration::initialize(ReservedSpace rs, std::int32_t eden_size, std::int32_t surv_size, std::int32_t max_eden_size, std::int32_t max_surv_size) {
 
-	_virtualSpace.initialize(rs, rs.size());
+	// [ eden | survivor | survivor ], each part reserved at its maximum size but committed at the initial one
+	ReservedSpace survivors_rs = rs.last_part(max_eden_size);
 
-	const char *eden_start = _virtualSpace.low();
-	const char *from_start = eden_start + eden_size;
-	const char *to_start = from_start + surv_size;
-	const char *to_end = to_start + surv_size;
+	_virtualSpace.initialize(rs.first_part(max_eden_size), eden_size);
+	_survivorVirtualSpaces[0].initialize(survivors_rs.first_part(max_surv_size), surv_size);
+	_survivorVirtualSpaces[1].initialize(survivors_rs.last_part(max_surv_size).first_part(max_surv_size), surv_size);
 
 	_fromSpace = new SurvivorSpace();
 	_toSpace = new SurvivorSpace();
 
-	eden()->initialize("eden", (Oop *) eden_start, (Oop *) from_start);
-	from()->initialize("from", (Oop *) from_start, (Oop *) to_start);
-	to()->initialize("to", (Oop *) to_start, (Oop *) to_end);
+	eden()->initialize("eden", (Oop *) _virtualSpace.low(), (Oop *) _virtualSpace.high());
+	from()->initialize("from", (Oop *) _survivorVirtualSpaces[0].low(), (Oop *) _survivorVirtualSpaces[0].high());
+	to()->initialize("to", (Oop *) _survivorVirtualSpaces[1].low(), (Oop *) _survivorVirtualSpaces[1].high());
 
 	eden()->next_space = from();
 	from()->next_space = to();
 	to()->next_space = nullptr;
 
-	_lowBoundary = _virtualSpace.low_boundary();
-	_highBoundary = _virtualSpace.high_boundary();
+	_lowBoundary = rs.base();
+	_highBoundary = rs.base() + rs.size();
+}
+
+VirtualSpace *NewGeneration::virtual_space_for(SurvivorSpace *s) {
+	return _survivorVirtualSpaces[0].contains(s->bottom()) ? &_survivorVirtualSpaces[0] : &_survivorVirtualSpaces[1];
+}
+
+static void commit(VirtualSpace *vs, std::int32_t size) {
+	std::int32_t delta = size - vs->committed_size();
+	if (delta > 0) {
+		vs->expand(delta);
+	}
+	else if (delta < 0) {
+		vs->shrink(-delta);
+	}
+}
+
+void NewGeneration::resize(std::int32_t eden_size, std::int32_t survivor_size) {
+	st_assert(eden()->is_empty() and to()->is_empty(), "can only resize empty spaces");
+	st_assert(eden_size > 0 and eden_size <= max_eden_size(), "invalid eden size");
+	st_assert(survivor_size > 0 and survivor_size <= max_survivor_size(), "invalid survivor size");
+
+	commit(&_virtualSpace, eden_size);
+	eden()->initialize("eden", (Oop *) _virtualSpace.low(), (Oop *) _virtualSpace.high());
+
+	VirtualSpace *vs = virtual_space_for(to());
+	commit(vs, survivor_size);
+	to()->initialize("to", (Oop *) vs->low(), (Oop *) vs->high());
 }
 
 void NewGeneration::prepare_for_compaction(OldWaterMark *mark) {
@@ -111,6 +139,7 @@ void NewGeneration::print() {
 }
 
 void NewGeneration::object_iterate(ObjectClosure *blk) {
+	ThreadLocalAllocationBuffer::retire_all();
 	eden()->object_iterate(blk);
 	from()->object_iterate(blk);
 }
@@ -123,6 +152,7 @@ void NewGeneration::verify() {
 		error("mis-connected spaces in new generation");
 	}
 
+	ThreadLocalAllocationBuffer::retire_all();
 	eden()->verify();
 	from()->verify();
 	to()->verify();
@@ -167,7 +197,7 @@ std::int32_t OldGeneration::capacity() {
 std::int32_t OldGeneration::used() {
 	std::int32_t sum = 0;
 	for (OldSpace *s = _firstSpace; s not_eq nullptr; s = s->_nextSpace) {
-		sum += s->used();
+		sum += s->used() - s->free_list()->free_words() * OOP_SIZE;
 	}
 	return sum;
 }
@@ -175,11 +205,36 @@ std::int32_t OldGeneration::used() {
 std::int32_t OldGeneration::free() {
 	std::int32_t sum = 0;
 	for (OldSpace *s = _firstSpace; s not_eq nullptr; s = s->_nextSpace) {
-		sum += s->free();
+		sum += s->free() + s->free_list()->free_words() * OOP_SIZE;
 	}
 	return sum;
 }
 
+Oop *OldGeneration::promote(std::int32_t size) {
+	if (_currentSpace->has_free_chunks()) {
+		Oop *p = _currentSpace->allocate_free(size);
+		if (p not_eq nullptr) {
+			_promoted.push_back(p);
+			return p;
+		}
+	}
+	return _currentSpace->allocate(size);
+}
+
+void OldGeneration::scavenge_promoted_contents() {
+	while (not _promoted.empty()) {
+		Oop *p = _promoted.back();
+		_promoted.pop_back();
+		as_memOop(p)->scavenge_tenured_contents();
+	}
+}
+
+void OldGeneration::clear_free_lists() {
+	for (OldSpace *s = _firstSpace; s not_eq nullptr; s = s->_nextSpace) {
+		s->free_list()->clear();
+	}
+}
+
 void OldGeneration::scavenge_contents_from(OldWaterMark *mark) {
 	mark->_space->scavenge_contents_from(mark);
 	while (mark->_space not_eq _currentSpace) {
@@ -199,6 +254,9 @@ std::int32_t OldGeneration::expand(std::int32_t size) {
 }
 
 std::int32_t OldGeneration::shrink(std::int32_t size) {
+	// the virtual space only backs the first space
+	if (_currentSpace not_eq _firstSpace)
+		return 0;
 	return _currentSpace->shrink(size);
 }
 
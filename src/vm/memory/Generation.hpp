@@ -23,6 +23,10 @@ private:
 
 	friend class MarkSweep;
 
+	friend class MarkCompact;
+
+	friend class IncrementalMarking;
+
 	friend class MemOopDescriptor;
 
 	friend class ByteArrayOopDescriptor;
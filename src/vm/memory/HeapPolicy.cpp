@@ -0,0 +1,200 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/HeapPolicy.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/runtime/flags.hpp"
+#include "vm/memory/util.hpp"
+#include "vm/runtime/DeltaProcess.hpp"
+#include "vm/runtime/VMOperation.hpp"
+#include "vm/runtime/VMProcess.hpp"
+
+
+std::int32_t HeapPolicy::_live_after_last_collection = 0;
+std::int32_t HeapPolicy::_promoted_average = 0;
+std::int32_t HeapPolicy::_scavenges_since_collection = 0;
+std::int32_t HeapPolicy::_collections = 0;
+double HeapPolicy::_pause_average = 0.0;
+double HeapPolicy::_survival_rate_average = 0.0;
+std::int32_t HeapPolicy::_resizes = 0;
+std::int32_t HeapPolicy::_shrinks = 0;
+bool HeapPolicy::_collection_requested = false;
+
+
+std::int32_t HeapPolicy::target_footprint() {
+	if (HeapTargetFootprint > 0)
+		return HeapTargetFootprint * 1024;
+
+	// default: three quarters of the reserved object heap not used by the new generation
+	std::int32_t new_gen_size = Universe::current_sizes._max_eden_size + 2 * Universe::current_sizes._max_surv_size;
+	return (Universe::current_sizes._reserved_object_size - new_gen_size) / 4 * 3;
+}
+
+std::int32_t HeapPolicy::growth_limit() {
+	std::int32_t growth = _live_after_last_collection / 100 * FullGCGrowthPercent;
+	return max(growth, FullGCMinGrowth * 1024);
+}
+
+void HeapPolicy::record_scavenge(std::int32_t old_used_before, std::int32_t old_used_after) {
+
+	// the first scavenge after bootstrapping establishes the baseline (the image itself is live)
+	if (_live_after_last_collection == 0)
+		_live_after_last_collection = old_used_before;
+
+	std::int32_t promoted = max(old_used_after - old_used_before, 0);
+	_promoted_average = (_promoted_average * 3 + promoted) / 4;
+	_scavenges_since_collection++;
+
+	if (PrintHeapPolicy) {
+		SPDLOG_INFO("heap-policy: scavenge promoted [{}K], average [{}K], old generation [{}K], growth since collection [{}K] of [{}K]",
+		            promoted / 1024, _promoted_average / 1024, old_used_after / 1024,
+		            (old_used_after - _live_after_last_collection) / 1024, growth_limit() / 1024);
+	}
+}
+
+void HeapPolicy::record_collection(std::int32_t old_used_after) {
+	_live_after_last_collection = old_used_after;
+	_scavenges_since_collection = 0;
+
+	if (PrintHeapPolicy) {
+		SPDLOG_INFO("heap-policy: live after collection [{}K], next collection at [{}K]",
+		            old_used_after / 1024, (old_used_after + growth_limit()) / 1024);
+	}
+}
+
+void HeapPolicy::shrink_old_generation() {
+	if (not UseHeapShrinking)
+		return;
+
+	OldGeneration *old_gen = &Universe::old_gen;
+	std::int32_t capacity = old_gen->capacity();
+	std::int32_t used = old_gen->used();
+	if (capacity == 0 or (capacity - used) / (capacity / 100) <= MaxHeapFreeRatio)
+		return;
+
+	// rounded up, so that at least MinHeapFreeRatio percent is left free
+	std::int32_t desired = max((used / (100 - MinHeapFreeRatio) + 1) * 100, Universe::current_sizes._old_size);
+	if (desired >= capacity)
+		return;
+
+	// only the tail above top can be uncommitted; OldSpace::shrink rounds up, so round down here
+	std::int32_t unit = ObjectHeapExpandSize * 1024;
+	std::int32_t excess = min(capacity - desired, old_gen->top_mark()._space->free()) / unit * unit;
+	if (excess == 0)
+		return;
+
+	std::int32_t shrunk = old_gen->shrink(excess);
+	if (shrunk == 0)
+		return;
+	_shrinks++;
+
+	if (PrintHeapPolicy or PrintGC) {
+		SPDLOG_INFO("heap-policy: old generation shrunk by [{}K] to [{}K], used [{}K]", shrunk / 1024, old_gen->capacity() / 1024, used / 1024);
+	}
+}
+
+bool HeapPolicy::should_collect_garbage() {
+
+	if (not UseHeapPolicy or _live_after_last_collection == 0)
+		return false;
+
+	std::int32_t used = Universe::old_gen.used();
+	std::int32_t growth = used - _live_after_last_collection;
+
+	// the old generation has grown too much since the last full collection
+	const char *reason = nullptr;
+	if (growth >= growth_limit()) {
+		reason = "growth";
+	}
+	else if (growth >= FullGCMinGrowth * 1024 and used + _promoted_average > target_footprint()) {
+		// the next scavenge(s) would promote past the target footprint; only worth a collection
+		// if there has been some growth, otherwise a heap full of live data collects on every scavenge
+		reason = "footprint";
+	}
+
+	if (reason == nullptr)
+		return false;
+
+	_collections++;
+	if (PrintHeapPolicy or PrintScavenge) {
+		SPDLOG_INFO("heap-policy: full collection #{} ({}): old generation [{}K], live after last collection [{}K], target [{}K], {} scavenges since",
+		            _collections, reason, used / 1024, _live_after_last_collection / 1024, target_footprint() / 1024, _scavenges_since_collection);
+	}
+	return true;
+}
+
+void HeapPolicy::request_collection() {
+	_collection_requested = true;
+	DeltaProcess::request_stack_check();
+}
+
+bool HeapPolicy::collect_if_requested() {
+	if (not _collection_requested or not Universe::can_scavenge())
+		return false;
+
+	_collection_requested = false;
+	DeltaProcess::cancel_stack_check();
+	Oop ignored = nilObject;
+	VM_GarbageCollect gc(&ignored);
+	VMProcess::execute(&gc);
+	return true;
+}
+
+bool HeapPolicy::should_start_marking() {
+
+	if (not UseHeapPolicy or _live_after_last_collection == 0)
+		return false;
+
+	std::int32_t growth = Universe::old_gen.used() - _live_after_last_collection;
+	if (growth < growth_limit() / 100 * IncrementalMarkingThreshold)
+		return false;
+
+	if (PrintHeapPolicy) {
+		SPDLOG_INFO("heap-policy: start incremental marking: growth since collection [{}K] of [{}K]", growth / 1024, growth_limit() / 1024);
+	}
+	return true;
+}
+
+void HeapPolicy::resize_new_generation(double pause, std::int32_t new_used_before, std::int32_t survived) {
+	if (not UseAdaptiveNewGeneration)
+		return;
+
+	double survival_rate = new_used_before == 0 ? 0.0 : double(survived) / new_used_before;
+	_pause_average = (_pause_average * 3 + pause) / 4;
+	_survival_rate_average = (_survival_rate_average * 3 + survival_rate) / 4;
+
+	NewGeneration *new_gen = &Universe::new_gen;
+	std::int32_t page_size = Universe::page_size();
+	std::int32_t old_eden_size = new_gen->eden()->capacity();
+	std::int32_t old_survivor_size = new_gen->to()->capacity();
+
+	std::int32_t eden_size = old_eden_size;
+	if (_pause_average > ScavengePauseGoal) {
+		eden_size = eden_size / 4 * 3;
+	}
+	else if (_pause_average < ScavengePauseGoal / 2.0) {
+		eden_size = eden_size / 2 * 3;
+	}
+	eden_size = min(max(roundTo(eden_size, page_size), Universe::current_sizes._eden_size), new_gen->max_eden_size());
+
+	std::int32_t survivor_size = std::int32_t(_survival_rate_average * eden_size * 2);
+	survivor_size = min(max(roundTo(survivor_size, page_size), Universe::current_sizes._surv_size), new_gen->max_survivor_size());
+
+	if (eden_size == old_eden_size and survivor_size == old_survivor_size)
+		return;
+
+	new_gen->resize(eden_size, survivor_size);
+	_resizes++;
+
+	if (PrintHeapPolicy) {
+		SPDLOG_INFO("heap-policy: pause [{:.2f}ms], average [{:.2f}ms], survival rate [{:.1f}%], eden [{}K] -> [{}K], survivor [{}K] -> [{}K]",
+		            pause, _pause_average, _survival_rate_average * 100, old_eden_size / 1024, eden_size / 1024, old_survivor_size / 1024, survivor_size / 1024);
+	}
+}
+
+void HeapPolicy::print() {
+	SPDLOG_INFO("heap-policy:  live after last collection [{}K], average promotion [{}K], growth limit [{}K], target footprint [{}K], collections [{}]",
+	            _live_after_last_collection / 1024, _promoted_average / 1024, growth_limit() / 1024, target_footprint() / 1024, _collections);
+}
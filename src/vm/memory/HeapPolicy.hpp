@@ -0,0 +1,95 @@
+
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+
+
+// HeapPolicy decides when the full garbage collector (MarkSweep) has to run.
+// The scavenger only reclaims the new generation, so without a policy the old
+// generation grows until the reserved heap is exhausted.
+//
+// The decision is based on
+//   - the growth of the old generation since the last full collection,
+//   - the average number of bytes promoted per scavenge, and
+//   - a target footprint for the old generation (HeapTargetFootprint).
+//
+// With UseAdaptiveNewGeneration it also sizes the new generation after each scavenge:
+//   - eden shrinks while the average scavenge pause exceeds ScavengePauseGoal, and grows (so that
+//     scavenges are less frequent) while the pause is well below it, within [EdenSize, MaxEdenSize];
+//   - the survivor spaces are sized to twice the expected survivors (the average survival rate times
+//     eden), since the tenuring threshold aims at half full survivor spaces.
+//
+// With UseHeapShrinking it returns memory to the OS after each full collection: if more than
+// MaxHeapFreeRatio percent of the old generation is free, the committed tail above the (compacted)
+// live data is uncommitted down to the size leaving MinHeapFreeRatio percent free, but never below OldSize.
+//
+// The allocation slow path only requests the full collection (request_collection): its callers may hold raw
+// pointers to old objects, which were never moved by an allocation before. The collection runs at the next
+// stack check of Delta code (see DeltaProcess::check_stack_overflow), where only the processes' frames refer to objects.
+//
+// Note: all sizes are in bytes
+class HeapPolicy : AllStatic {
+
+private:
+	static std::int32_t _live_after_last_collection;   // old generation used after the last full collection
+	static std::int32_t _promoted_average;             // decaying average of bytes promoted per scavenge
+	static std::int32_t _scavenges_since_collection;   // # of scavenges since the last full collection
+	static std::int32_t _collections;                  // # of full collections triggered by the policy
+	static double _pause_average;                      // decaying average of scavenge pauses (in ms)
+	static double _survival_rate_average;              // decaying average of the fraction of the new generation surviving a scavenge
+	static std::int32_t _resizes;                      // # of new generation resizes
+	static std::int32_t _shrinks;                      // # of old generation shrinks
+	static bool _collection_requested;                 // a full collection waits for the next safe point
+
+	static std::int32_t target_footprint();
+
+	static std::int32_t growth_limit();
+
+public:
+	// called by Universe::scavenge, MarkSweep::collect and MarkCompact::collect
+	static void record_scavenge(std::int32_t old_used_before, std::int32_t old_used_after);
+
+	static void record_collection(std::int32_t old_used_after);
+
+	// called by MarkSweep::collect and MarkCompact::collect after record_collection
+	static void shrink_old_generation();
+
+	// called by Universe::scavenge after swapping the survivor spaces
+	static void resize_new_generation(double pause, std::int32_t new_used_before, std::int32_t survived);
+
+	// Tells whether the allocation slow path should follow the scavenge with a full collection
+	static bool should_collect_garbage();
+
+	// Defers the full collection to the next safe point
+	static void request_collection();
+
+	static bool collection_requested() {
+		return _collection_requested;
+	}
+
+	// called at a safe point; returns whether a collection was done
+	static bool collect_if_requested();
+
+	// Tells whether IncrementalMarking should start a cycle, well before should_collect_garbage would hold
+	static bool should_start_marking();
+
+	static std::int32_t collections() {
+		return _collections;
+	}
+
+	static std::int32_t resizes() {
+		return _resizes;
+	}
+
+	static std::int32_t shrinks() {
+		return _shrinks;
+	}
+
+	static void print();
+};
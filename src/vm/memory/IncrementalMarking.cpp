@@ -0,0 +1,176 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/IncrementalMarking.hpp"
+#include "vm/memory/MarkCompact.hpp"
+#include "vm/memory/HeapPolicy.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/RememberedSet.hpp"
+#include "vm/memory/Space.hpp"
+#include "vm/memory/Closure.hpp"
+#include "vm/oop/MemOopDescriptor.hpp"
+#include "vm/klass/Klass.hpp"
+#include "vm/klass/WeakArrayKlass.hpp"
+#include "vm/runtime/flags.hpp"
+#include "vm/runtime/Frame.hpp"
+#include "vm/runtime/Processes.hpp"
+#include "vm/runtime/VMSymbol.hpp"
+#include "vm/utility/EventLog.hpp"
+
+
+bool IncrementalMarking::_active = false;
+bool IncrementalMarking::_complete = false;
+
+std::vector<MemOop> IncrementalMarking::_stack;
+std::vector<MemOop> IncrementalMarking::_weak_arrays;
+
+std::uint8_t *IncrementalMarking::_dirty_cards = nullptr;
+std::int32_t IncrementalMarking::_number_of_cards = 0;
+
+std::int32_t IncrementalMarking::_slices = 0;
+std::int32_t IncrementalMarking::_scanned = 0;
+
+
+class IncrementalMarkingClosure : public OopClosure {
+public:
+	void do_oop(Oop *p) {
+		Oop obj = *p;
+		// the new objects are left to the remark
+		if (obj->isMemOop() and obj->is_old() and MarkCompact::mark(MemOop(obj)))
+			IncrementalMarking::stack()->push_back(MemOop(obj));
+	}
+};
+
+// The methods executed by interpreted frames are only referred to by the hcode pointers
+class IncrementalMarkingMethodsClosure : public FrameClosure {
+	void do_frame(Frame *f) {
+		if (not f->is_interpreted_frame())
+			return;
+		Oop method = as_memOop(Universe::object_start((Oop *) f->hp()));
+		IncrementalMarkingClosure blk;
+		blk.do_oop(&method);
+	}
+};
+
+void IncrementalMarking::mark_root(Oop *p) {
+	IncrementalMarkingClosure blk;
+	blk.do_oop(p);
+}
+
+void IncrementalMarking::scan(MemOop obj) {
+	IncrementalMarkingClosure blk;
+	if (obj->is_weakArray()) {
+		// like MarkCompact, the indexables are looked at in the remark
+		obj->oop_iterate_header(&blk);
+		obj->oop_iterate_body(&blk, MemOopDescriptor::header_size(), obj->blueprint()->non_indexable_size());
+		_weak_arrays.push_back(obj);
+	}
+	else {
+		obj->oop_iterate(&blk);
+	}
+	_scanned += obj->size();
+}
+
+void IncrementalMarking::start() {
+	EventMarker em("start incremental marking");
+
+	if (_dirty_cards == nullptr) {
+		_number_of_cards = card_index((Oop *) Universe::old_gen._highBoundary) + 1;
+		_dirty_cards = new_c_heap_array<std::uint8_t>(_number_of_cards);
+	}
+	memset(_dirty_cards, 0, _number_of_cards);
+
+	MarkCompact::begin_marking();
+	_stack.clear();
+	_weak_arrays.clear();
+	_slices = 0;
+	_scanned = 0;
+	_active = true;
+	_complete = false;
+
+	// the roots; called right after a scavenge, so eden is empty and only the survivors are scanned
+	Universe::oops_do(&mark_root);
+	IncrementalMarkingClosure blk;
+	Processes::oop_iterate(&blk);
+	IncrementalMarkingMethodsClosure methods;
+	Processes::frame_iterate(&methods);
+	NotificationQueue::oops_do(&mark_root);
+	vmSymbols::oops_do(&mark_root);
+
+	SurvivorSpace *from = Universe::new_gen.from();
+	for (Oop *p = from->bottom(); p < from->top(); p += as_memOop(p)->size()) {
+		as_memOop(p)->oop_iterate(&blk);
+	}
+
+	if (PrintGC) {
+		SPDLOG_INFO("incremental marking: started with {:d} marked roots", static_cast<std::int32_t>(_stack.size()));
+	}
+}
+
+void IncrementalMarking::step() {
+	if (not UseIncrementalMarking)
+		return;
+
+	if (not _active) {
+		if (HeapPolicy::should_start_marking() and Universe::old_gen._firstSpace->_nextSpace == nullptr)
+			start();
+		return;
+	}
+
+	if (not _complete)
+		mark_slice(IncrementalMarkingStepSize * 1024);
+}
+
+bool IncrementalMarking::mark_slice(std::int32_t budget) {
+	st_assert(_active, "no marking cycle");
+	EventMarker em("incremental marking slice");
+
+	std::int32_t limit = _scanned + budget;
+	while (not _stack.empty() and _scanned < limit) {
+		MemOop obj = _stack.back();
+		_stack.pop_back();
+		scan(obj);
+	}
+	_slices++;
+	_complete = _stack.empty();
+
+	if (PrintGC and _complete) {
+		SPDLOG_INFO("incremental marking: complete after {:d} slices, {:d}K words scanned", _slices, _scanned / 1024);
+	}
+	return _complete;
+}
+
+void IncrementalMarking::record_dirty_cards() {
+	OldSpace *space = Universe::old_gen._firstSpace;
+	for (std::int32_t card = card_index(space->bottom()); card_address(card) < space->top(); card++) {
+		if (Universe::remembered_set->is_dirty(card_address(card)))
+			_dirty_cards[card] = 1;
+	}
+}
+
+std::int32_t IncrementalMarking::card_index(Oop *p) {
+	return (((std::uint32_t) p) >> card_shift) - (((std::uint32_t) Universe::old_gen._lowBoundary) >> card_shift);
+}
+
+Oop *IncrementalMarking::card_address(std::int32_t card) {
+	return (Oop *) (((((std::uint32_t) Universe::old_gen._lowBoundary) >> card_shift) + card) << card_shift);
+}
+
+void IncrementalMarking::finish() {
+	_active = false;
+	_complete = false;
+	_stack.clear();
+	_weak_arrays.clear();
+}
+
+void IncrementalMarking::abort() {
+	if (not _active)
+		return;
+
+	if (PrintGC) {
+		SPDLOG_INFO("incremental marking: aborted after {:d} slices", _slices);
+	}
+	finish();
+}
@@ -0,0 +1,110 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+#include "vm/oop/Oop.hpp"
+
+#include <vector>
+
+
+// IncrementalMarking marks the old generation in slices between scavenges (UseIncrementalMarking),
+// so that the full collection only has to finish the marking ("remark") before it compacts.
+// It uses the mark bitmaps of MarkCompact, which does the final pause.
+//
+// A cycle starts when the old generation has grown by IncrementalMarkingThreshold percent of the
+// growth that triggers a full collection (see HeapPolicy::should_start_marking). The roots are marked
+// at the end of that scavenge. Each later scavenge is followed by a slice that scans up to
+// IncrementalMarkingStepSize K words. Only old objects are marked in the slices, since new objects move.
+//
+// The mutator runs between slices, so it can store a pointer to an unmarked object into a scanned one.
+// The card marks of the store checks (RememberedSet::record_store) catch these stores, so they serve as
+// the write barrier. The scavenger cleans cards, so before each scavenge the dirty cards are copied into
+// a table of our own (a "mod union table"). The remark then rescans, in one short pause:
+//   - the marked objects on dirty cards,
+//   - the roots, and
+//   - the new generation.
+// Once a slice finds nothing left to scan, the cycle is complete. The next scavenge then ends with
+// the full collection.
+
+class IncrementalMarking : AllStatic {
+
+private:
+	static bool _active;
+	static bool _complete;
+
+	static std::vector<MemOop> _stack;          // marked objects still to be scanned
+	static std::vector<MemOop> _weak_arrays;    // scanned weak arrays; their indexables are left to the remark
+
+	static std::uint8_t *_dirty_cards;          // mod union table: one byte per card of the old generation
+	static std::int32_t _number_of_cards;
+
+	static std::int32_t _slices;                // # of slices in the current cycle
+	static std::int32_t _scanned;               // # of words scanned in the current cycle
+
+	static void mark_root(Oop *p);
+
+	static void scan(MemOop obj);
+
+public:
+	static bool is_active() {
+		return _active;
+	}
+
+	// all old objects reachable from the roots at the start are marked; time for the remark
+	static bool is_complete() {
+		return _active and _complete;
+	}
+
+	// called at the end of each scavenge: starts a cycle or does a slice of one
+	static void step();
+
+	// marks the roots; must be called right after a scavenge (eden empty)
+	static void start();
+
+	// scans marked objects until about budget words are scanned; returns whether marking is complete
+	static bool mark_slice(std::int32_t budget);
+
+	// called before the scavenger cleans cards, and by the remark
+	static void record_dirty_cards();
+
+	static bool is_card_dirty(std::int32_t card) {
+		return _dirty_cards[card] not_eq 0;
+	}
+
+	static std::int32_t number_of_cards() {
+		return _number_of_cards;
+	}
+
+	// the cards are those of the remembered set, numbered from the start of the old generation
+	static std::int32_t card_index(Oop *p);
+
+	static Oop *card_address(std::int32_t card);
+
+	// the remark takes over the remaining work
+	static std::vector<MemOop> *stack() {
+		return &_stack;
+	}
+
+	static std::vector<MemOop> *weak_arrays() {
+		return &_weak_arrays;
+	}
+
+	// called by MarkCompact after the remark
+	static void finish();
+
+	// gives up the cycle; for collections and heap changes the marks can't survive (MarkSweep, become)
+	static void abort();
+
+	static std::int32_t slices() {
+		return _slices;
+	}
+
+	static std::int32_t scanned() {
+		return _scanned;
+	}
+};
@@ -0,0 +1,838 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/MarkCompact.hpp"
+#include "vm/memory/MarkSweep.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/Generation.hpp"
+#include "vm/memory/Space.hpp"
+#include "vm/memory/SymbolTable.hpp"
+#include "vm/memory/HeapPolicy.hpp"
+#include "vm/memory/IncrementalMarking.hpp"
+#include "vm/memory/Pretenuring.hpp"
+#include "vm/memory/RememberedSet.hpp"
+#include "vm/memory/OldSpaceFreeList.hpp"
+#include "vm/memory/ThreadLocalAllocationBuffer.hpp"
+#include "vm/memory/Closure.hpp"
+#include "vm/memory/util.hpp"
+#include "vm/oop/MemOopDescriptor.hpp"
+#include "vm/oop/ObjectArrayOopDescriptor.hpp"
+#include "vm/klass/WeakArrayKlass.hpp"
+#include "vm/runtime/flags.hpp"
+#include "vm/runtime/Frame.hpp"
+#include "vm/runtime/Processes.hpp"
+#include "vm/runtime/VMSymbol.hpp"
+#include "vm/runtime/Timer.hpp"
+#include "vm/runtime/ResourceMark.hpp"
+#include "vm/utility/EventLog.hpp"
+#include "vm/runtime/DeltaCallCache.hpp"
+#include "vm/lookup/LookupCache.hpp"
+
+#include <bit>
+#include <thread>
+
+
+Oop *MarkCompact::_heap_base = nullptr;
+std::int32_t MarkCompact::_heap_words = 0;
+std::uint32_t *MarkCompact::_begin_map = nullptr;
+std::uint32_t *MarkCompact::_live_map = nullptr;
+
+std::int32_t MarkCompact::_number_of_regions = 0;
+Oop **MarkCompact::_region_destination = nullptr;
+Oop **MarkCompact::_region_source_end = nullptr;
+std::atomic<bool> *MarkCompact::_region_done = nullptr;
+
+std::vector<std::pair<Oop *, Oop *>> MarkCompact::_spaces;
+Oop *MarkCompact::_compaction_top = nullptr;
+
+std::vector<std::int32_t> MarkCompact::_regions;
+std::atomic<std::int32_t> MarkCompact::_next_region{0};
+bool MarkCompact::_wait_for_destination = false;
+
+GrowableArray<std::int32_t> *MarkCompact::_hcode_offsets = nullptr;
+
+std::mutex MarkCompact::_mark_stack_lock;
+std::vector<MemOop> MarkCompact::_mark_stack;
+std::atomic<std::int32_t> MarkCompact::_idle{0};
+
+std::mutex MarkCompact::_weak_arrays_lock;
+std::vector<MemOop> MarkCompact::_weak_arrays;
+
+std::int32_t MarkCompact::_number_of_workers = 0;
+std::mutex MarkCompact::_start_lock;
+std::condition_variable MarkCompact::_start;
+std::condition_variable MarkCompact::_done;
+std::int32_t MarkCompact::_generation = 0;
+std::int32_t MarkCompact::_running = 0;
+void (*MarkCompact::_task)(std::int32_t worker) = nullptr;
+
+double MarkCompact::_mark_time = 0.0;
+double MarkCompact::_summary_time = 0.0;
+double MarkCompact::_adjust_time = 0.0;
+double MarkCompact::_compact_time = 0.0;
+double MarkCompact::_sweep_time = 0.0;
+
+// A worker moves objects between its own and the shared mark stack in chunks of this size
+static constexpr std::int32_t mark_stack_chunk = 64;
+
+static constexpr std::int32_t bits_per_word = 32;
+
+
+// Closures
+
+class MarkCompactMarkClosure : public OopClosure {
+
+private:
+	std::vector<MemOop> *_stack;
+
+public:
+	MarkCompactMarkClosure(std::vector<MemOop> *stack) :
+			_stack{stack} {
+	}
+
+	void do_oop(Oop *p) {
+		Oop obj = *p;
+		if (obj->isMemOop() and MarkCompact::mark(MemOop(obj)))
+			_stack->push_back(MemOop(obj));
+	}
+};
+
+class MarkCompactAdjustClosure : public OopClosure {
+	void do_oop(Oop *p) {
+		Oop obj = *p;
+		if (obj->isMemOop())
+			*p = as_memOop(MarkCompact::forwardee(MemOop(obj)));
+	}
+};
+
+// Interpreted frames point into the bytecodes of their methods; like MarkSweep, the pointers are
+// turned into pointers to the method (a root) for the collection and the offsets are saved.
+class MarkCompactHeapCodeClosure : public FrameClosure {
+
+public:
+	enum class Action {
+		convert, adjust, restore
+	};
+
+private:
+	Action _action;
+	GrowableArray<std::int32_t> *_offsets;
+	std::int32_t _next;
+	void (*_root)(Oop *p);
+
+public:
+	MarkCompactHeapCodeClosure(Action action, GrowableArray<std::int32_t> *offsets, void root(Oop *p) = nullptr) :
+			_action{action},
+			_offsets{offsets},
+			_next{0},
+			_root{root} {
+	}
+
+	void do_frame(Frame *f) {
+		if (not f->is_interpreted_frame())
+			return;
+
+		std::uint8_t *h = f->hp();
+		switch (_action) {
+			case Action::convert: {
+				std::uint8_t *obj = (std::uint8_t *) as_memOop(Universe::object_start((Oop *) h));
+				f->set_hp(obj);
+				_offsets->push(h - obj);
+				Oop method = Oop(obj);
+				_root(&method);
+				break;
+			}
+			case Action::adjust:
+				f->set_hp((std::uint8_t *) as_memOop(MarkCompact::forwardee(MemOop(Oop(h)))));
+				break;
+			case Action::restore:
+				f->set_hp(h + _offsets->at(_next++));
+				break;
+		}
+	}
+};
+
+
+// MarkCompact
+
+void MarkCompact::initialize() {
+	if (_begin_map not_eq nullptr)
+		return;
+
+	st_assert(Universe::new_gen._highBoundary <= Universe::old_gen._lowBoundary, "new generation must be below the old generation");
+	_heap_base = (Oop *) Universe::new_gen._lowBoundary;
+	_heap_words = ((Oop *) Universe::old_gen._highBoundary) - _heap_base;
+
+	std::int32_t map_words = _heap_words / bits_per_word + 1;
+	_begin_map = new_c_heap_array<std::uint32_t>(map_words);
+	_live_map = new_c_heap_array<std::uint32_t>(map_words);
+	set_words((std::int32_t *) _begin_map, map_words);
+	set_words((std::int32_t *) _live_map, map_words);
+
+	_number_of_regions = _heap_words / region_size + 1;
+	_region_destination = new_c_heap_array<Oop *>(_number_of_regions);
+	_region_source_end = new_c_heap_array<Oop *>(_number_of_regions);
+	_region_done = new std::atomic<bool>[_number_of_regions];
+
+	// worker 0 is the VM thread; the others wait in helper_loop for the next parallel phase
+	_number_of_workers = max(MarkCompactThreads, 1);
+	for (std::int32_t i = 1; i < _number_of_workers; i++) {
+		std::thread(helper_loop, i).detach();
+	}
+}
+
+void MarkCompact::helper_loop(std::int32_t worker) {
+	std::int32_t generation = 0;
+	while (true) {
+		void (*task)(std::int32_t);
+		{
+			std::unique_lock<std::mutex> lock(_start_lock);
+			_start.wait(lock, [generation] { return _generation not_eq generation; });
+			generation = _generation;
+			task = _task;
+		}
+
+		task(worker);
+
+		{
+			std::lock_guard<std::mutex> lock(_start_lock);
+			if (--_running == 0)
+				_done.notify_one();
+		}
+	}
+}
+
+void MarkCompact::run_parallel(void task(std::int32_t worker)) {
+	_idle = 0;
+	{
+		std::lock_guard<std::mutex> lock(_start_lock);
+		_task = task;
+		_running = _number_of_workers - 1;
+		_generation++;
+	}
+	_start.notify_all();
+
+	task(0);
+
+	std::unique_lock<std::mutex> lock(_start_lock);
+	_done.wait(lock, [] { return _running == 0; });
+}
+
+bool MarkCompact::can_compact() {
+	// the compaction slides everything into one old space
+	return Universe::old_gen._firstSpace->_nextSpace == nullptr;
+}
+
+Oop MarkCompact::collect(Oop p) {
+	if (not can_compact())
+		return MarkSweep::collect(p);
+
+	FlagSetting fl(garbageCollectionInProgress, true);
+	EventMarker em("Mark Compact");
+	ResourceMark resourceMark;
+	TraceTime t("Garbage collection (mark-compact)", PrintGC);
+
+	std::int32_t old_used = Universe::old_gen.used();
+
+	// eden is compacted as well
+	ThreadLocalAllocationBuffer::retire_all();
+
+	// the lifetimes are measured again after the collection
+	Pretenuring::reset();
+
+	if (VerifyBeforeScavenge or VerifyBeforeGC)
+		Universe::verify();
+
+	// Clear all vm inline caches
+	DeltaCallCache::clearAll();
+
+	initialize();
+
+	mark_phase(&p);
+
+	bool compacted = should_compact();
+	if (compacted) {
+		Universe::old_gen.clear_free_lists();
+		summary_phase();
+		adjust_phase(&p);
+		compact_phase();
+
+		// we have no pointers from old to new
+		Universe::remembered_set->clear();
+	}
+	else {
+		sweep_phase();
+	}
+
+	LookupCache::flush();
+
+	IncrementalMarking::finish();
+
+	if (VerifyAfterScavenge or VerifyAfterGC)
+		Universe::verify();
+
+	HeapPolicy::record_collection(Universe::old_gen.used());
+	HeapPolicy::shrink_old_generation();
+
+	if (PrintGC and compacted) {
+		SPDLOG_INFO("mark-compact:  before [{:3f}M], after [{:3f}M], mark {:.3f} ms, summary {:.3f} ms, adjust {:.3f} ms, compact {:.3f} ms ({:d} threads)", (double) old_used / (double) (1024 * 1024), (double) Universe::old_gen.used() / (double) (1024 * 1024), _mark_time, _summary_time, _adjust_time, _compact_time, _number_of_workers);
+	}
+	if (PrintGC and not compacted) {
+		SPDLOG_INFO("mark-compact:  before [{:3f}M], after [{:3f}M], mark {:.3f} ms, sweep {:.3f} ms, {:d} free chunks ({:d} threads)", (double) old_used / (double) (1024 * 1024), (double) Universe::old_gen.used() / (double) (1024 * 1024), _mark_time, _sweep_time, Universe::old_gen._firstSpace->free_list()->number_of_chunks(), _number_of_workers);
+	}
+
+	return p;
+}
+
+
+// Bitmaps
+
+bool MarkCompact::mark(MemOop obj) {
+	std::int32_t index = index_of((Oop *) obj->addr());
+	st_assert(0 <= index and index < _heap_words, "not in heap");
+
+	std::uint32_t bit = 1u << (index % bits_per_word);
+	std::atomic_ref<std::uint32_t> begin(_begin_map[index / bits_per_word]);
+	if ((begin.load(std::memory_order_relaxed) & bit) or (begin.fetch_or(bit) & bit))
+		return false;
+
+	// the object is ours; only its first and last word of the live map may be shared with other objects
+	std::int32_t end = index + obj->size();
+	std::int32_t first_word = index / bits_per_word;
+	std::int32_t last_word = (end - 1) / bits_per_word;
+	std::uint32_t first_bits = ~0u << (index % bits_per_word);
+	std::uint32_t last_bits = ~0u >> (bits_per_word - 1 - (end - 1) % bits_per_word);
+	if (first_word == last_word) {
+		std::atomic_ref<std::uint32_t>(_live_map[first_word]).fetch_or(first_bits & last_bits);
+	}
+	else {
+		std::atomic_ref<std::uint32_t>(_live_map[first_word]).fetch_or(first_bits);
+		for (std::int32_t i = first_word + 1; i < last_word; i++) {
+			_live_map[i] = ~0u;
+		}
+		std::atomic_ref<std::uint32_t>(_live_map[last_word]).fetch_or(last_bits);
+	}
+	return true;
+}
+
+bool MarkCompact::is_marked(MemOop obj) {
+	std::int32_t index = index_of((Oop *) obj->addr());
+	return (_begin_map[index / bits_per_word] >> (index % bits_per_word)) & 1;
+}
+
+std::int32_t MarkCompact::find(const std::uint32_t *map, bool value, std::int32_t from, std::int32_t to) {
+	// returns the index of the first bit in [from, to[ with the given value, or to
+	if (from >= to)
+		return to;
+
+	std::int32_t i = from / bits_per_word;
+	std::uint32_t bits = (value ? map[i] : ~map[i]) & (~0u << (from % bits_per_word));
+	while (bits == 0) {
+		i++;
+		if (i * bits_per_word >= to)
+			return to;
+		bits = value ? map[i] : ~map[i];
+	}
+	return min(i * bits_per_word + std::countr_zero(bits), to);
+}
+
+std::int32_t MarkCompact::object_end(std::int32_t index, std::int32_t limit) {
+	// an object ends where the next one begins or at the first dead word, whichever comes first
+	std::int32_t from = index + 1;
+	if (from >= limit)
+		return limit;
+
+	std::int32_t i = from / bits_per_word;
+	std::uint32_t bits = (_begin_map[i] | ~_live_map[i]) & (~0u << (from % bits_per_word));
+	while (bits == 0) {
+		i++;
+		if (i * bits_per_word >= limit)
+			return limit;
+		bits = _begin_map[i] | ~_live_map[i];
+	}
+	return min(i * bits_per_word + std::countr_zero(bits), limit);
+}
+
+std::int32_t MarkCompact::count_live(std::int32_t from, std::int32_t to) {
+	if (from >= to)
+		return 0;
+
+	std::int32_t first_word = from / bits_per_word;
+	std::int32_t last_word = (to - 1) / bits_per_word;
+	std::uint32_t first_bits = ~0u << (from % bits_per_word);
+	std::uint32_t last_bits = ~0u >> (bits_per_word - 1 - (to - 1) % bits_per_word);
+	if (first_word == last_word)
+		return std::popcount(_live_map[first_word] & first_bits & last_bits);
+
+	std::int32_t count = std::popcount(_live_map[first_word] & first_bits);
+	for (std::int32_t i = first_word + 1; i < last_word; i++) {
+		count += std::popcount(_live_map[i]);
+	}
+	return count + std::popcount(_live_map[last_word] & last_bits);
+}
+
+Oop *MarkCompact::forwardee(MemOop obj) {
+	std::int32_t index = index_of((Oop *) obj->addr());
+	std::int32_t region = index / region_size;
+	st_assert(is_marked(obj), "forwarding a dead object");
+	return _region_destination[region] + count_live(region * region_size, index);
+}
+
+
+// Phase 1: marking
+
+void MarkCompact::mark_root(Oop *p) {
+	Oop obj = *p;
+	if (obj->isMemOop() and mark(MemOop(obj)))
+		_mark_stack.push_back(MemOop(obj));
+}
+
+void MarkCompact::scan(MemOop obj, std::vector<MemOop> *stack) {
+	MarkCompactMarkClosure blk(stack);
+	if (obj->is_weakArray()) {
+		// the indexables are weak; they are looked at once everything else is marked
+		obj->oop_iterate_header(&blk);
+		obj->oop_iterate_body(&blk, MemOopDescriptor::header_size(), obj->blueprint()->non_indexable_size());
+		std::lock_guard<std::mutex> lock(_weak_arrays_lock);
+		_weak_arrays.push_back(obj);
+	}
+	else {
+		obj->oop_iterate(&blk);
+	}
+}
+
+bool MarkCompact::offer_termination() {
+	// Work is only shared by workers that are not idle, so once all of them are idle, all is done.
+	_idle.fetch_add(1);
+	while (true) {
+		if (_idle.load() == _number_of_workers)
+			return true;
+
+		bool has_work;
+		{
+			std::lock_guard<std::mutex> lock(_mark_stack_lock);
+			has_work = not _mark_stack.empty();
+		}
+		if (has_work) {
+			_idle.fetch_sub(1);
+			return false;
+		}
+		std::this_thread::yield();
+	}
+}
+
+void MarkCompact::mark_task(std::int32_t worker) {
+	st_unused(worker); // unused
+	std::vector<MemOop> stack;
+	while (true) {
+		if (stack.empty()) {
+			std::lock_guard<std::mutex> lock(_mark_stack_lock);
+			std::int32_t n = min(static_cast<std::int32_t>(_mark_stack.size()), mark_stack_chunk);
+			stack.insert(stack.end(), _mark_stack.end() - n, _mark_stack.end());
+			_mark_stack.resize(_mark_stack.size() - n);
+		}
+		if (stack.empty()) {
+			if (offer_termination())
+				break;
+			continue;
+		}
+
+		MemOop obj = stack.back();
+		stack.pop_back();
+		scan(obj, &stack);
+
+		// feed the idle workers
+		if (_idle.load() > 0 and stack.size() > 1) {
+			std::int32_t n = min(static_cast<std::int32_t>(stack.size() / 2), mark_stack_chunk);
+			std::lock_guard<std::mutex> lock(_mark_stack_lock);
+			_mark_stack.insert(_mark_stack.end(), stack.begin(), stack.begin() + n);
+			stack.erase(stack.begin(), stack.begin() + n);
+		}
+	}
+}
+
+void MarkCompact::check_weak_arrays() {
+	// same as WeakArrayRegister::mark_sweep_check_for_dying_objects: objects only reachable through
+	// weak arrays are marked as dying and the weak arrays are queued for notification. The objects
+	// survive this collection.
+	for (MemOop obj : _weak_arrays) {
+		WeakArrayOop w = WeakArrayOop(obj);
+		bool encountered_near_death_objects = false;
+		for (std::size_t j = 1; j <= w->length(); j++) {
+			Oop element = w->obj_at(j);
+			if (element->isMemOop() and not is_marked(MemOop(element))) {
+				encountered_near_death_objects = true;
+				MemOop(element)->mark_as_dying();
+			}
+		}
+		if (encountered_near_death_objects)
+			NotificationQueue::put_if_absent(w);
+	}
+
+	for (MemOop obj : _weak_arrays) {
+		WeakArrayOop w = WeakArrayOop(obj);
+		for (std::size_t j = 1; j <= w->length(); j++) {
+			mark_root(w->objs(j));
+		}
+	}
+	_weak_arrays.clear();
+}
+
+void MarkCompact::begin_marking() {
+	initialize();
+
+	// the whole maps, since the old space may have been larger at the last collection
+	std::int32_t map_words = _heap_words / bits_per_word + 1;
+	set_words((std::int32_t *) _begin_map, map_words);
+	set_words((std::int32_t *) _live_map, map_words);
+}
+
+void MarkCompact::rescan_dirty_cards() {
+	// The marked objects on cards stored into since the start of the incremental marking may point to
+	// unmarked objects; they are scanned again. Objects crossing into a card are found via the offsets.
+	IncrementalMarking::record_dirty_cards();
+
+	OldSpace *space = Universe::old_gen._firstSpace;
+	MemOop last = nullptr;
+	for (std::int32_t card = IncrementalMarking::card_index(space->bottom()); IncrementalMarking::card_address(card) < space->top(); card++) {
+		if (not IncrementalMarking::is_card_dirty(card))
+			continue;
+
+		Oop *card_end = min(IncrementalMarking::card_address(card + 1), space->top());
+		Oop *q = max(IncrementalMarking::card_address(card), space->bottom());
+		q = Universe::old_gen.object_start(q);
+		while (q < card_end) {
+			MemOop obj = as_memOop(q);
+			if (obj not_eq last and is_marked(obj)) {
+				_mark_stack.push_back(obj);
+				last = obj;
+			}
+			q += obj->size();
+		}
+	}
+}
+
+void MarkCompact::mark_phase(Oop *p) {
+	EventMarker em("1 mark");
+	ElapsedTimer timer;
+	timer.start();
+
+	_mark_stack.clear();
+	_weak_arrays.clear();
+
+	if (IncrementalMarking::is_active()) {
+		// remark: the old objects marked so far stay marked; what is left to do is
+		//  - the objects the incremental marking has not scanned yet,
+		//  - the marked objects that were stored into since (an incremental update barrier), and
+		//  - the roots and the new generation, which were never scanned for good.
+		_mark_stack.swap(*IncrementalMarking::stack());
+		_weak_arrays.swap(*IncrementalMarking::weak_arrays());
+		rescan_dirty_cards();
+	}
+	else {
+		// the bits are only set below the tops, so that is all that needs clearing
+		std::int32_t used_words = index_of(Universe::old_gen._firstSpace->top()) / bits_per_word + 1;
+		set_words((std::int32_t *) _begin_map, used_words);
+		set_words((std::int32_t *) _live_map, used_words);
+	}
+
+	mark_root(p);
+	Universe::oops_do(&mark_root);
+
+	_hcode_offsets = new GrowableArray<std::int32_t>(100);
+	MarkCompactHeapCodeClosure convert(MarkCompactHeapCodeClosure::Action::convert, _hcode_offsets, &mark_root);
+	Processes::frame_iterate(&convert);
+
+	MarkCompactMarkClosure roots(&_mark_stack);
+	Processes::oop_iterate(&roots);
+
+	run_parallel(mark_task);
+
+	check_weak_arrays();
+	NotificationQueue::oops_do(&mark_root);
+	vmSymbols::oops_do(&mark_root);
+	run_parallel(mark_task);
+	st_assert(_weak_arrays.empty(), "weak arrays must have been marked before");
+
+	// throw out the unreachable symbols - must be after all other marking!
+	Universe::symbol_table->remove_unmarked_symbols(&is_marked);
+
+	timer.stop();
+	_mark_time = timer.seconds() * 1000.0;
+}
+
+
+// Phase 2: computing the new addresses
+
+Oop *MarkCompact::summarize(Oop *bottom, Oop *top, Oop *destination) {
+	st_assert(index_of(bottom) % region_size == 0, "spaces must start at a region boundary");
+	std::int32_t limit = index_of(top);
+	std::int32_t first_region = index_of(bottom) / region_size;
+	std::int32_t end_region = (limit + region_size - 1) / region_size;
+
+	for (std::int32_t r = first_region; r < end_region; r++) {
+		_region_destination[r] = destination;
+		destination += count_live(r * region_size, min((r + 1) * region_size, limit));
+	}
+
+	// the objects starting in a region end before the next object after the region
+	Oop *next_start = top;
+	for (std::int32_t r = end_region - 1; r >= first_region; r--) {
+		std::int32_t end = min((r + 1) * region_size, limit);
+		std::int32_t start = find(_begin_map, true, r * region_size, end);
+		_region_source_end[r] = next_start;
+		_region_done[r] = start == end;
+		if (start < end)
+			next_start = address_of(start);
+	}
+	return destination;
+}
+
+void MarkCompact::summary_phase() {
+	EventMarker em("2 summary");
+	ElapsedTimer timer;
+	timer.start();
+
+	OldSpace *space = Universe::old_gen._firstSpace;
+
+	// %note same order as MarkSweep
+	_spaces.clear();
+	_spaces.push_back(std::make_pair(space->bottom(), space->top()));
+	_spaces.push_back(std::make_pair(Universe::new_gen.from()->bottom(), Universe::new_gen.from()->top()));
+	_spaces.push_back(std::make_pair(Universe::new_gen.eden()->bottom(), Universe::new_gen.eden()->top()));
+
+	Oop *destination = space->bottom();
+	for (std::pair<Oop *, Oop *> s : _spaces) {
+		destination = summarize(s.first, s.second, destination);
+	}
+	_compaction_top = destination;
+
+	// make sure we don't run out of old space
+	if (_compaction_top > space->end())
+		space->expand((_compaction_top - space->end()) * OOP_SIZE);
+
+	timer.stop();
+	_summary_time = timer.seconds() * 1000.0;
+}
+
+
+// Phase 3: adjusting the pointers
+
+void MarkCompact::adjust_root(Oop *p) {
+	Oop obj = *p;
+	if (obj->isMemOop())
+		*p = as_memOop(forwardee(MemOop(obj)));
+}
+
+void MarkCompact::add_regions(Oop *bottom, Oop *top) {
+	std::int32_t end_region = (index_of(top) + region_size - 1) / region_size;
+	for (std::int32_t r = index_of(bottom) / region_size; r < end_region; r++) {
+		_regions.push_back(r);
+	}
+}
+
+bool MarkCompact::claim_region(std::int32_t &region) {
+	std::int32_t index = _next_region.fetch_add(1);
+	if (index >= static_cast<std::int32_t>(_regions.size()))
+		return false;
+	region = _regions[index];
+	return true;
+}
+
+std::pair<Oop *, Oop *> MarkCompact::space_of(std::int32_t region) {
+	Oop *p = address_of(region * region_size);
+	for (std::pair<Oop *, Oop *> s : _spaces) {
+		if (s.first <= p and p < s.second)
+			return s;
+	}
+	st_fatal("region not in a compacted space");
+	return std::make_pair(nullptr, nullptr);
+}
+
+void MarkCompact::adjust_task(std::int32_t worker) {
+	st_unused(worker); // unused
+	MarkCompactAdjustClosure blk;
+	std::int32_t region;
+	while (claim_region(region)) {
+		std::int32_t limit = index_of(space_of(region).second);
+		std::int32_t end = min((region + 1) * region_size, limit);
+		std::int32_t index = find(_begin_map, true, region * region_size, end);
+		while (index < end) {
+			std::int32_t next = object_end(index, limit);
+			as_memOop(address_of(index))->oop_iterate(&blk);
+			index = find(_begin_map, true, next, end);
+		}
+	}
+}
+
+void MarkCompact::adjust_phase(Oop *p) {
+	EventMarker em("3 adjust pointers");
+	ElapsedTimer timer;
+	timer.start();
+
+	adjust_root(p);
+	Universe::oops_do(&adjust_root);
+
+	MarkCompactHeapCodeClosure adjust(MarkCompactHeapCodeClosure::Action::adjust, _hcode_offsets);
+	Processes::frame_iterate(&adjust);
+
+	MarkCompactAdjustClosure roots;
+	Processes::oop_iterate(&roots);
+
+	NotificationQueue::oops_do(&adjust_root);
+	vmSymbols::oops_do(&adjust_root);
+	Universe::symbol_table->oops_do(&adjust_root);
+
+	_regions.clear();
+	for (std::pair<Oop *, Oop *> s : _spaces) {
+		add_regions(s.first, s.second);
+	}
+	_next_region = 0;
+	run_parallel(adjust_task);
+
+	timer.stop();
+	_adjust_time = timer.seconds() * 1000.0;
+}
+
+
+// Phase 4: moving the objects
+
+void MarkCompact::compact_region(std::int32_t region) {
+	std::pair<Oop *, Oop *> space = space_of(region);
+	std::int32_t limit = index_of(space.second);
+	std::int32_t end = min((region + 1) * region_size, limit);
+	std::int32_t index = find(_begin_map, true, region * region_size, end);
+
+	if (index < end) {
+		Oop *destination = _region_destination[region] + count_live(region * region_size, index);
+
+		// wait for the regions whose objects are still where ours go
+		if (_wait_for_destination) {
+			std::int32_t first_region = index_of(space.first) / region_size;
+			for (std::int32_t q = region - 1; q >= first_region and _region_source_end[q] > destination; q--) {
+				while (not _region_done[q].load(std::memory_order_acquire))
+					std::this_thread::yield();
+			}
+		}
+
+		while (index < end) {
+			std::int32_t size = object_end(index, limit) - index;
+			Oop *source = address_of(index);
+			if (source not_eq destination)
+				copy_oops(source, destination, size);
+			destination += size;
+			index = find(_begin_map, true, index + size, end);
+		}
+	}
+	_region_done[region].store(true, std::memory_order_release);
+}
+
+void MarkCompact::compact_task(std::int32_t worker) {
+	st_unused(worker); // unused
+	std::int32_t region;
+	while (claim_region(region)) {
+		compact_region(region);
+	}
+}
+
+void MarkCompact::compact_phase() {
+	EventMarker em("4 compact heap");
+	ElapsedTimer timer;
+	timer.start();
+
+	// the old space slides down within itself, so a region may have to wait for lower ones ...
+	_regions.clear();
+	add_regions(_spaces[0].first, _spaces[0].second);
+	_next_region = 0;
+	_wait_for_destination = true;
+	run_parallel(compact_task);
+
+	// ... while the new generation goes above all of it
+	_regions.clear();
+	add_regions(_spaces[1].first, _spaces[1].second);
+	add_regions(_spaces[2].first, _spaces[2].second);
+	_next_region = 0;
+	_wait_for_destination = false;
+	run_parallel(compact_task);
+
+	OldSpace *space = Universe::old_gen._firstSpace;
+	space->set_top(_compaction_top);
+	space->initialize_threshold();
+	Oop *q = space->bottom();
+	while (q < _compaction_top) {
+		std::int32_t size = as_memOop(q)->size();
+		space->update_offsets(q, q + size);
+		q += size;
+	}
+
+	Universe::new_gen.from()->clear();
+	Universe::new_gen.eden()->clear();
+
+	// All hcode pointers can now be restored.
+	MarkCompactHeapCodeClosure restore(MarkCompactHeapCodeClosure::Action::restore, _hcode_offsets);
+	Processes::frame_iterate(&restore);
+	_hcode_offsets = nullptr;
+
+	timer.stop();
+	_compact_time = timer.seconds() * 1000.0;
+}
+
+
+// Sweeping instead of phases 2-4 (UseOldSpaceFreeLists)
+
+bool MarkCompact::should_compact() {
+	if (not UseOldSpaceFreeLists)
+		return true;
+
+	// the free chunks are unmarked, so they count as dead
+	OldSpace *space = Universe::old_gen._firstSpace;
+	std::int32_t used = space->top() - space->bottom();
+	std::int32_t dead = used - count_live(index_of(space->bottom()), index_of(space->top()));
+	return used > 0 and dead * 100.0 / used >= OldSpaceFragmentationLimit;
+}
+
+void MarkCompact::sweep(Oop *bottom, Oop *top, OldSpace *space) {
+	std::int32_t limit = index_of(top);
+	std::int32_t index = index_of(bottom);
+	while (index < limit) {
+		std::int32_t live = find(_begin_map, true, index, limit);
+		if (live > index) {
+			if (space == nullptr) {
+				Universe::fill(address_of(index), address_of(live));
+			}
+			else if (live == limit) {
+				space->retract_top(address_of(index));
+			}
+			else {
+				space->add_free_chunk(address_of(index), address_of(live));
+			}
+		}
+		if (live == limit)
+			break;
+		index = live + as_memOop(address_of(live))->size();
+	}
+}
+
+void MarkCompact::sweep_phase() {
+	EventMarker em("2 sweep");
+	ElapsedTimer timer;
+	timer.start();
+
+	// The objects stay where they are. The dead ones in the old space become free chunks; those in the
+	// new generation are overwritten as well, so that no object is left pointing into a free chunk.
+	OldSpace *space = Universe::old_gen._firstSpace;
+	space->free_list()->clear();
+	sweep(space->bottom(), space->top(), space);
+	sweep(Universe::new_gen.from()->bottom(), Universe::new_gen.from()->top(), nullptr);
+	sweep(Universe::new_gen.eden()->bottom(), Universe::new_gen.eden()->top(), nullptr);
+
+	// All hcode pointers can now be restored.
+	MarkCompactHeapCodeClosure restore(MarkCompactHeapCodeClosure::Action::restore, _hcode_offsets);
+	Processes::frame_iterate(&restore);
+	_hcode_offsets = nullptr;
+
+	timer.stop();
+	_sweep_time = timer.seconds() * 1000.0;
+}
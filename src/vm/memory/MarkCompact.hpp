@@ -0,0 +1,202 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+#include "vm/oop/Oop.hpp"
+#include "vm/utility/GrowableArray.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <condition_variable>
+
+class OldSpace;
+
+// MarkCompact is a sliding full collector, used instead of MarkSweep if UseMarkCompact is set.
+//
+// Unlike MarkSweep it leaves the objects alone until it moves them: the marks are kept in two
+// bitmaps covering the whole heap, one with a bit for the first word of each live object and one
+// with a bit for every word of it. The collection runs in four phases:
+//
+//   1 mark:    the roots are marked by the VM thread and pushed onto a shared mark stack, from which
+//              MarkCompactThreads workers (the VM thread being worker 0) take and push chunks,
+//   2 summary: the heap is divided into regions of region_size words; for each region the address
+//              its first live word moves to is recorded,
+//   3 adjust:  the workers claim regions and update every pointer in their objects; the new address
+//              of an object is the address of its region plus the number of live words before it
+//              in the region (counted in the bitmap), and
+//   4 compact: the workers claim regions in address order and slide their objects down; a region
+//              waits until the regions its objects are moved over have been moved themselves.
+//
+// The old space is compacted first, then the from space and eden are appended to it, leaving the
+// new generation empty (as MarkSweep does). With more than one old space MarkSweep is used instead.
+//
+// If IncrementalMarking has marked the old generation, the mark phase only finishes its work (see there).
+//
+// With UseOldSpaceFreeLists, phases 2-4 are replaced by a sweep unless more than
+// OldSpaceFragmentationLimit percent of the old space is dead: nothing moves, the dead objects of the
+// old space become free chunks (see OldSpaceFreeList) and the new generation is left to the scavenger.
+
+class MarkCompact : AllStatic {
+
+public:
+	static constexpr std::int32_t region_size = 512; // in words
+
+	static Oop collect(Oop p = nullptr);
+
+	// false if the old generation has more than one space; collect then does a MarkSweep
+	static bool can_compact();
+
+	// bitmap operations, valid during a collection; mark returns false if obj was marked already
+	static bool mark(MemOop obj);
+
+	static bool is_marked(MemOop obj);
+
+	static Oop *forwardee(MemOop obj);
+
+	// clears the marks; IncrementalMarking marks into the bitmaps between collections
+	static void begin_marking();
+
+	// times (in ms) of the phases of the last collection
+	static double mark_time() {
+		return _mark_time;
+	}
+
+	static double summary_time() {
+		return _summary_time;
+	}
+
+	static double adjust_time() {
+		return _adjust_time;
+	}
+
+	static double compact_time() {
+		return _compact_time;
+	}
+
+	static double sweep_time() {
+		return _sweep_time;
+	}
+
+private:
+	// the heap covered by the bitmaps: the new generation and the old generation above it
+	static Oop *_heap_base;
+	static std::int32_t _heap_words;
+	static std::uint32_t *_begin_map;
+	static std::uint32_t *_live_map;
+
+	// per region: the new address of its first live word, and the end of the objects starting in it
+	static std::int32_t _number_of_regions;
+	static Oop **_region_destination;
+	static Oop **_region_source_end;
+	static std::atomic<bool> *_region_done;
+
+	// the spaces being compacted (bottom, top), in the order they are compacted
+	static std::vector<std::pair<Oop *, Oop *>> _spaces;
+	static Oop *_compaction_top;
+
+	// the regions handed out to the workers by the adjust and compact phases, in address order
+	static std::vector<std::int32_t> _regions;
+	static std::atomic<std::int32_t> _next_region;
+	static bool _wait_for_destination;
+
+	// the offsets of the interpreted frames' hcode pointers into their methods
+	static GrowableArray<std::int32_t> *_hcode_offsets;
+
+	// shared mark stack
+	static std::mutex _mark_stack_lock;
+	static std::vector<MemOop> _mark_stack;
+	static std::atomic<std::int32_t> _idle;
+
+	// weak arrays found during marking; their indexables are marked after everything else
+	static std::mutex _weak_arrays_lock;
+	static std::vector<MemOop> _weak_arrays;
+
+	// starting and joining the helper threads
+	static std::int32_t _number_of_workers;
+	static std::mutex _start_lock;
+	static std::condition_variable _start;
+	static std::condition_variable _done;
+	static std::int32_t _generation;
+	static std::int32_t _running;
+	static void (*_task)(std::int32_t worker);
+
+	static double _mark_time;
+	static double _summary_time;
+	static double _adjust_time;
+	static double _compact_time;
+	static double _sweep_time;
+
+	static void initialize();
+
+	static void helper_loop(std::int32_t worker);
+
+	static void run_parallel(void task(std::int32_t worker));
+
+	// bitmaps
+	static std::int32_t index_of(Oop *p) {
+		return p - _heap_base;
+	}
+
+	static Oop *address_of(std::int32_t index) {
+		return _heap_base + index;
+	}
+
+	static std::int32_t find(const std::uint32_t *map, bool value, std::int32_t from, std::int32_t to);
+
+	static std::int32_t count_live(std::int32_t from, std::int32_t to);
+
+	static std::int32_t object_end(std::int32_t index, std::int32_t limit);
+
+	// phase 1
+	static void mark_root(Oop *p);
+
+	static void mark_task(std::int32_t worker);
+
+	static bool offer_termination();
+
+	static void scan(MemOop obj, std::vector<MemOop> *stack);
+
+	static void check_weak_arrays();
+
+	static void rescan_dirty_cards();
+
+	// phase 2
+	static Oop *summarize(Oop *bottom, Oop *top, Oop *destination);
+
+	// phase 3
+	static void adjust_root(Oop *p);
+
+	static void adjust_task(std::int32_t worker);
+
+	// phase 4
+	static void compact_task(std::int32_t worker);
+
+	static void compact_region(std::int32_t region);
+
+	static std::pair<Oop *, Oop *> space_of(std::int32_t region);
+
+	static void add_regions(Oop *bottom, Oop *top);
+
+	static bool claim_region(std::int32_t &region);
+
+	static void mark_phase(Oop *p);
+
+	static void summary_phase();
+
+	static void adjust_phase(Oop *p);
+
+	static void compact_phase();
+
+	// instead of phases 2-4
+	static bool should_compact();
+
+	static void sweep(Oop *bottom, Oop *top, OldSpace *space);
+
+	static void sweep_phase();
+};
@@ -5,6 +5,8 @@
 //
 
 #include "vm/memory/MarkSweep.hpp"
+#include "vm/memory/IncrementalMarking.hpp"
+#include "vm/memory/Pretenuring.hpp"
 #include "vm/runtime/flags.hpp"
 #include "vm/memory/Universe.hpp"
 #include "vm/utility/EventLog.hpp"
@@ -19,6 +21,8 @@
 #include "vm/runtime/ResourceMark.hpp"
 #include "vm/oop/KlassOopDescriptor.hpp"
 #include "vm/memory/WaterMark.hpp"
+#include "vm/memory/HeapPolicy.hpp"
+#include "vm/memory/ThreadLocalAllocationBuffer.hpp"
 
 typedef struct {
 	Oop anOop;
@@ -123,6 +127,18 @@ Oop MarkSweep::collect(Oop p) {
 
 	std::int32_t old_used = Universe::old_gen.used();
 
+	// eden is compacted as well
+	ThreadLocalAllocationBuffer::retire_all();
+
+	// the marks of an incremental marking cycle are of no use here
+	IncrementalMarking::abort();
+
+	// the free chunks are compacted away
+	Universe::old_gen.clear_free_lists();
+
+	// the lifetimes are measured again after the collection
+	Pretenuring::reset();
+
 	if (VerifyBeforeScavenge or VerifyBeforeGC)
 		Universe::verify();
 
@@ -150,6 +166,9 @@ Oop MarkSweep::collect(Oop p) {
 		Universe::code->oops_do(&oopVerify);
 	}
 
+	HeapPolicy::record_collection(Universe::old_gen.used());
+	HeapPolicy::shrink_old_generation();
+
 	if (PrintGC) {
 		SPDLOG_INFO("garbage-collection:  before [{:3f}M], after [{:3f}M]", (double) old_used / (double) (1024 * 1024), (double) Universe::old_gen.used() / (double) (1024 * 1024));
 	}
@@ -9,6 +9,8 @@
 #include "vm/memory/Space.hpp"
 #include "vm/oop/OopDescriptor.hpp"
 #include "vm/memory/WaterMark.hpp"
+#include "vm/memory/ThreadLocalAllocationBuffer.hpp"
+#include "vm/runtime/flags.hpp"
 
 class NewGeneration : public Generation {
 
@@ -25,13 +27,17 @@ private:
 	SurvivorSpace *_fromSpace;
 	SurvivorSpace *_toSpace;
 
+	// eden lives in Generation::_virtualSpace; each survivor space has its own, so that all three can be resized
+	VirtualSpace _survivorVirtualSpaces[2];
+
 public:
 
 	NewGeneration() :
 			Generation(),
 			_edenSpace{},
 			_fromSpace{nullptr},
-			_toSpace{nullptr} {
+			_toSpace{nullptr},
+			_survivorVirtualSpaces{} {
 
 	}
 
@@ -94,7 +100,7 @@ public:
 	Oop *object_start(Oop *p);
 
 	Oop *allocate(std::int32_t size) {
-		return eden()->allocate(size);
+		return UseTLAB ? ThreadLocalAllocationBuffer::allocate(size) : eden()->allocate(size);
 	}
 
 	Oop *allocate_in_survivor_space(std::int32_t size) {
@@ -105,6 +111,18 @@ public:
 		return _highBoundary;
 	}
 
+	std::int32_t max_eden_size() const {
+		return _virtualSpace.reserved_size();
+	}
+
+	std::int32_t max_survivor_size() const {
+		return _survivorVirtualSpaces[0].reserved_size();
+	}
+
+	// Commits eden and the to space with the given sizes (in bytes, page aligned); both must be empty,
+	// i.e. this is done right after a scavenge. The from space gets its new size after the next one.
+	void resize(std::int32_t eden_size, std::int32_t survivor_size);
+
 protected:
 //        inline bool is_new( MemOop p, char *boundary ); // inlined in generation.dcl.h
 //        inline bool is_new( Oop p, char *boundary ); // ditto
@@ -119,7 +137,9 @@ protected:
 
 private:
 	// called by Universe
-	void initialize(ReservedSpace rs, std::int32_t eden_size, std::int32_t surv_size);
+	void initialize(ReservedSpace rs, std::int32_t eden_size, std::int32_t surv_size, std::int32_t max_eden_size, std::int32_t max_surv_size);
+
+	VirtualSpace *virtual_space_for(SurvivorSpace *s);
 
 	// phase2 of mark sweep
 	void prepare_for_compaction(OldWaterMark *mark);
@@ -11,6 +11,8 @@
 #include "vm/memory/Space.hpp"
 #include "vm/memory/WaterMark.hpp"
 
+#include <vector>
+
 class OldGeneration : public Generation {
 	friend class RememberedSet;
 
@@ -18,9 +20,16 @@ class OldGeneration : public Generation {
 
 	friend class MarkSweep;
 
+	friend class MarkCompact;
+
+	friend class IncrementalMarking;
+
+	friend class ParallelScavenge;
+
 	friend class OldSpace;
 
 	friend class symbolKlass;
+	friend class SnapshotDescriptor;
 
 	Oop *allocate_in_next_space(std::int32_t size);
 
@@ -34,6 +43,9 @@ private:
 	OldSpace *_currentSpace;
 	OldSpace *_oldSpace;
 
+	// objects promoted into free chunks by the current scavenge, still to be scanned
+	std::vector<Oop *> _promoted;
+
 public:
 	std::int32_t expand(std::int32_t size);
 
@@ -42,7 +54,8 @@ public:
 	OldGeneration() :
 			_firstSpace{nullptr},
 			_currentSpace{nullptr},
-			_oldSpace{nullptr} {
+			_oldSpace{nullptr},
+			_promoted{} {
 	}
 
 	auto operator<=>(const OldGeneration &) const = default;
@@ -52,9 +65,34 @@ public:
 	OldGeneration &operator=(const OldGeneration &) = default;
 
 	Oop *allocate(std::int32_t size, bool allow_expansion = true) {
+		if (_currentSpace->has_free_chunks()) {
+			Oop *p = _currentSpace->allocate_free(size);
+			if (p not_eq nullptr)
+				return p;
+		}
 		return _currentSpace->allocate(size, allow_expansion);
 	}
 
+	Oop *allocate_large(std::int32_t size, bool allow_expansion = true) {
+		return _currentSpace->allocate_large(size, allow_expansion);
+	}
+
+	// allocation by the scavenger; the objects not allocated at the top are remembered for scanning
+	Oop *promote(std::int32_t size);
+
+	bool has_promoted() const {
+		return not _promoted.empty();
+	}
+
+	void scavenge_promoted_contents();
+
+	std::vector<Oop *> *promoted() {
+		return &_promoted;
+	}
+
+	// called by the compacting collectors
+	void clear_free_lists();
+
 	// called by Universe
 	void initialize(ReservedSpace rs, std::int32_t initial_size);
 
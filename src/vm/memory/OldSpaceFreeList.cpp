@@ -0,0 +1,80 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/OldSpaceFreeList.hpp"
+#include "vm/oop/MemOopDescriptor.hpp"
+
+
+OldSpaceFreeList::OldSpaceFreeList() :
+		_small{},
+		_large{},
+		_free_words{0},
+		_chunks{0} {
+}
+
+bool OldSpaceFreeList::fits(std::int32_t chunk_size, std::int32_t size) {
+	// never leave less than a header behind
+	return chunk_size == size or chunk_size >= size + MemOopDescriptor::header_size();
+}
+
+void OldSpaceFreeList::add(Oop *chunk, std::int32_t size) {
+	st_assert(size >= MemOopDescriptor::header_size(), "chunk too small");
+	if (size <= small_chunk_size) {
+		_small[size].push_back(chunk);
+	}
+	else {
+		_large.push_back(std::make_pair(chunk, size));
+	}
+	_free_words += size;
+	_chunks++;
+}
+
+Oop *OldSpaceFreeList::remove(std::int32_t size, std::int32_t &chunk_size) {
+	if (_chunks == 0)
+		return nullptr;
+
+	Oop *chunk = nullptr;
+	if (size <= small_chunk_size and not _small[size].empty()) {
+		// exact fit
+		chunk = _small[size].back();
+		_small[size].pop_back();
+		chunk_size = size;
+	}
+	else {
+		for (std::size_t i = 0; i < _large.size(); i++) {
+			if (fits(_large[i].second, size)) {
+				chunk = _large[i].first;
+				chunk_size = _large[i].second;
+				_large[i] = _large.back();
+				_large.pop_back();
+				break;
+			}
+		}
+		// split a small chunk as a last resort
+		for (std::int32_t s = size + MemOopDescriptor::header_size(); chunk == nullptr and s <= small_chunk_size; s++) {
+			if (not _small[s].empty()) {
+				chunk = _small[s].back();
+				_small[s].pop_back();
+				chunk_size = s;
+			}
+		}
+	}
+
+	if (chunk == nullptr)
+		return nullptr;
+
+	_free_words -= chunk_size;
+	_chunks--;
+	return chunk;
+}
+
+void OldSpaceFreeList::clear() {
+	for (std::int32_t s = 0; s <= small_chunk_size; s++) {
+		_small[s].clear();
+	}
+	_large.clear();
+	_free_words = 0;
+	_chunks = 0;
+}
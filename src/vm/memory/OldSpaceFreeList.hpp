@@ -0,0 +1,57 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+#include "vm/oop/Oop.hpp"
+
+#include <vector>
+
+
+// An OldSpaceFreeList holds the free chunks of an old space (UseOldSpaceFreeLists). The chunks are the runs
+// of dead objects found by the sweep of MarkCompact; each is a filler object (see Universe::fill),
+// so the space stays parsable.
+//
+// Chunks of up to small_chunk_size words are kept in one list per size; larger ones in a single
+// list searched first-fit. A chunk handed out is either of the requested size or leaves a
+// remainder of at least a header, which the space turns into a new chunk.
+
+class OldSpaceFreeList : public CHeapAllocatedObject {
+
+public:
+	static constexpr std::int32_t small_chunk_size = 64; // in words
+
+private:
+	std::vector<Oop *> _small[small_chunk_size + 1];
+	std::vector<std::pair<Oop *, std::int32_t>> _large;
+	std::int32_t _free_words;
+	std::int32_t _chunks;
+
+	static bool fits(std::int32_t chunk_size, std::int32_t size);
+
+public:
+	OldSpaceFreeList();
+
+	void add(Oop *chunk, std::int32_t size);
+
+	// removes a chunk for an object of size words and returns it, or nullptr; chunk_size is set to its size
+	Oop *remove(std::int32_t size, std::int32_t &chunk_size);
+
+	void clear();
+
+	bool is_empty() const {
+		return _chunks == 0;
+	}
+
+	std::int32_t free_words() const {
+		return _free_words;
+	}
+
+	std::int32_t number_of_chunks() const {
+		return _chunks;
+	}
+};
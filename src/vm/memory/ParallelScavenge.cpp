@@ -0,0 +1,407 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/ParallelScavenge.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/Generation.hpp"
+#include "vm/memory/Pretenuring.hpp"
+#include "vm/memory/RememberedSet.hpp"
+#include "vm/memory/Space.hpp"
+#include "vm/memory/util.hpp"
+#include "vm/oop/MemOopDescriptor.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/runtime/flags.hpp"
+#include "vm/utility/OutputStream.hpp"
+
+#include <thread>
+
+
+// ScavengeQueue
+
+void ScavengeQueue::push(MemOop obj) {
+	std::lock_guard<std::mutex> lock(_lock);
+	_objects.push_back(obj);
+}
+
+bool ScavengeQueue::pop(MemOop &obj) {
+	std::lock_guard<std::mutex> lock(_lock);
+	if (_objects.empty())
+		return false;
+	obj = _objects.back();
+	_objects.pop_back();
+	return true;
+}
+
+bool ScavengeQueue::steal(MemOop &obj) {
+	std::lock_guard<std::mutex> lock(_lock);
+	if (_objects.empty())
+		return false;
+	obj = _objects.front();
+	_objects.pop_front();
+	return true;
+}
+
+bool ScavengeQueue::is_empty() {
+	std::lock_guard<std::mutex> lock(_lock);
+	return _objects.empty();
+}
+
+
+// ScavengeWorker
+
+ScavengeWorker::ScavengeWorker(std::int32_t id) :
+		_id{id},
+		_queue{},
+		_age_table{},
+		_survivor_top{nullptr},
+		_survivor_end{nullptr},
+		_promotion_top{nullptr},
+		_promotion_end{nullptr},
+		_copied{0},
+		_stolen{0} {
+}
+
+void ScavengeWorker::begin() {
+	_age_table.clear();
+	_survivor_top = _survivor_end = nullptr;
+	_promotion_top = _promotion_end = nullptr;
+	_copied = 0;
+	_stolen = 0;
+}
+
+Oop *ScavengeWorker::allocate_in_buffer(Oop *&top, Oop *end, std::int32_t size) {
+	// never leave a single word behind; the smallest filler object is a header
+	std::int32_t remaining = end - top;
+	if (remaining == size or remaining >= size + MemOopDescriptor::header_size()) {
+		Oop *result = top;
+		top += size;
+		return result;
+	}
+	return nullptr;
+}
+
+Oop *ScavengeWorker::allocate_in_survivor_space(std::int32_t size) {
+	Oop *result = allocate_in_buffer(_survivor_top, _survivor_end, size);
+	if (result not_eq nullptr)
+		return result;
+
+	std::int32_t buffer_size = ScavengeBufferSize >= size + MemOopDescriptor::header_size() ? ScavengeBufferSize : size;
+	Oop *buffer;
+	{
+		std::lock_guard<std::mutex> lock(*ParallelScavenge::allocation_lock());
+		buffer = Universe::new_gen.to()->allocate(buffer_size);
+	}
+	if (buffer == nullptr)
+		return nullptr;
+
+	Universe::fill(_survivor_top, _survivor_end);
+	_survivor_top = buffer;
+	_survivor_end = buffer + buffer_size;
+	return allocate_in_buffer(_survivor_top, _survivor_end, size);
+}
+
+Oop *ScavengeWorker::allocate_in_old_space(std::int32_t size) {
+	Oop *result = allocate_in_buffer(_promotion_top, _promotion_end, size);
+	if (result not_eq nullptr)
+		return result;
+
+	std::int32_t buffer_size = ScavengeBufferSize >= size + MemOopDescriptor::header_size() ? ScavengeBufferSize : size;
+	Oop *buffer;
+	{
+		std::lock_guard<std::mutex> lock(*ParallelScavenge::allocation_lock());
+		buffer = Universe::old_gen.allocate(buffer_size);
+	}
+	if (buffer == nullptr)
+		st_fatal("old generation exhausted during scavenge");
+
+	Universe::fill(_promotion_top, _promotion_end);
+	_promotion_top = buffer;
+	_promotion_end = buffer + buffer_size;
+	return allocate_in_buffer(_promotion_top, _promotion_end, size);
+}
+
+void ScavengeWorker::record_copy(MemOop obj) {
+	_copied++;
+	_queue.push(obj);
+}
+
+void ScavengeWorker::retire_buffers() {
+	Universe::fill(_survivor_top, _survivor_end);
+	Universe::fill(_promotion_top, _promotion_end);
+	_survivor_top = _survivor_end = nullptr;
+	_promotion_top = _promotion_end = nullptr;
+}
+
+
+// ParallelScavenge
+
+bool ParallelScavenge::_active = false;
+std::int32_t ParallelScavenge::_number_of_workers = 0;
+ScavengeWorker **ParallelScavenge::_workers = nullptr;
+thread_local ScavengeWorker *ParallelScavenge::_current = nullptr;
+
+std::mutex ParallelScavenge::_allocation_lock;
+
+std::mutex ParallelScavenge::_start_lock;
+std::condition_variable ParallelScavenge::_start;
+std::condition_variable ParallelScavenge::_done;
+std::int32_t ParallelScavenge::_generation = 0;
+std::int32_t ParallelScavenge::_running = 0;
+
+std::vector<std::pair<Oop *, Oop *>> ParallelScavenge::_regions;
+std::atomic<std::int32_t> ParallelScavenge::_next_region{0};
+std::atomic<std::int32_t> ParallelScavenge::_idle{0};
+
+// The mark of an object being copied; it is neither a MarkOop nor a forward pointer.
+static const MarkOop busy_mark = MarkOop(smiOopFromValue(1));
+
+// Dirty card runs are split into chunks of about this many words
+static constexpr std::int32_t region_chunk_size = 16 * card_size_in_oops;
+
+void ParallelScavenge::initialize() {
+	if (_workers not_eq nullptr)
+		return;
+
+	_number_of_workers = max(ParallelScavengeThreads, 1);
+	_workers = new_c_heap_array<ScavengeWorker *>(_number_of_workers);
+	for (std::int32_t i = 0; i < _number_of_workers; i++) {
+		_workers[i] = new ScavengeWorker(i);
+	}
+
+	// worker 0 is the VM thread; the others wait in helper_loop for the next scavenge
+	for (std::int32_t i = 1; i < _number_of_workers; i++) {
+		std::thread(helper_loop, _workers[i]).detach();
+	}
+}
+
+void ParallelScavenge::helper_loop(ScavengeWorker *w) {
+	std::int32_t generation = 0;
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(_start_lock);
+			_start.wait(lock, [generation] { return _generation not_eq generation; });
+			generation = _generation;
+		}
+
+		work(w);
+
+		{
+			std::lock_guard<std::mutex> lock(_start_lock);
+			if (--_running == 0)
+				_done.notify_one();
+		}
+	}
+}
+
+void ParallelScavenge::scavenge(NewWaterMark *to_mark, OldWaterMark *old_mark) {
+	initialize();
+	for (std::int32_t i = 0; i < _number_of_workers; i++) {
+		_workers[i]->begin();
+	}
+
+	// hand out the objects the roots were copied to
+	std::int32_t next = 0;
+	distribute(to_mark->_point, Universe::new_gen.to()->top(), next);
+	for (OldSpace *s = old_mark->_space; s not_eq nullptr; s = s->_nextSpace) {
+		distribute(s == old_mark->_space ? old_mark->_point : s->bottom(), s->top(), next);
+	}
+	for (Oop *p : *Universe::old_gen.promoted()) {
+		_workers[next]->queue()->push(as_memOop(p));
+		next = (next + 1) % _number_of_workers;
+	}
+	Universe::old_gen.promoted()->clear();
+
+	// the old objects with recorded stores; the ones promoted above are already queued
+	_regions.clear();
+	_next_region = 0;
+	FOR_EACH_OLD_SPACE(s) {
+		bool last = s == old_mark->_space;
+		Universe::remembered_set->dirty_regions_do(s, last ? old_mark->_point : s->top(), add_region);
+		if (last)
+			break;
+	}
+
+	_idle = 0;
+	_active = true;
+	{
+		std::lock_guard<std::mutex> lock(_start_lock);
+		_running = _number_of_workers - 1;
+		_generation++;
+	}
+	_start.notify_all();
+
+	work(_workers[0]);
+
+	{
+		std::unique_lock<std::mutex> lock(_start_lock);
+		_done.wait(lock, [] { return _running == 0; });
+	}
+	_active = false;
+
+	std::int32_t copied = 0;
+	std::int32_t stolen = 0;
+	for (std::int32_t i = 0; i < _number_of_workers; i++) {
+		ScavengeWorker *w = _workers[i];
+		for (std::int32_t age = 0; age < AgeTable::table_size; age++) {
+			Universe::age_table->_sizes[age] += w->age_table()->_sizes[age];
+		}
+		copied += w->copied();
+		stolen += w->stolen();
+	}
+
+	if (PrintScavenge) {
+		SPDLOG_INFO("parallel scavenge: {:d} threads, {:d} card regions, {:d} objects copied, {:d} stolen", _number_of_workers, static_cast<std::int32_t>(_regions.size()), copied, stolen);
+	}
+
+	*to_mark = Universe::new_gen.to()->top_mark();
+	*old_mark = Universe::old_gen.top_mark();
+}
+
+void ParallelScavenge::distribute(Oop *from, Oop *to, std::int32_t &next) {
+	Oop *p = from;
+	while (p < to) {
+		MemOop m = as_memOop(p);
+		_workers[next]->queue()->push(m);
+		next = (next + 1) % _number_of_workers;
+		p += m->size();
+	}
+}
+
+void ParallelScavenge::add_region(Oop *from, Oop *to) {
+	// split long runs at object boundaries so they can be shared
+	Oop *start = from;
+	Oop *p = from;
+	while (p < to) {
+		p += as_memOop(p)->size();
+		if (p - start >= region_chunk_size or p >= to) {
+			_regions.push_back(std::make_pair(start, p));
+			start = p;
+		}
+	}
+}
+
+bool ParallelScavenge::scan_region() {
+	std::int32_t index = _next_region.fetch_add(1);
+	if (index >= static_cast<std::int32_t>(_regions.size()))
+		return false;
+
+	Oop *p = _regions[index].first;
+	Oop *end = _regions[index].second;
+	while (p < end) {
+		p += as_memOop(p)->scavenge_tenured_contents();
+	}
+	return true;
+}
+
+void ParallelScavenge::scan(MemOop obj) {
+	if (obj->is_old()) {
+		obj->scavenge_tenured_contents();
+	}
+	else {
+		obj->scavenge_contents();
+	}
+}
+
+bool ParallelScavenge::steal(ScavengeWorker *w, MemOop &obj) {
+	for (std::int32_t i = 1; i < _number_of_workers; i++) {
+		ScavengeWorker *victim = _workers[(w->id() + i) % _number_of_workers];
+		if (victim->queue()->steal(obj)) {
+			w->record_steal();
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ParallelScavenge::has_work() {
+	if (_next_region.load() < static_cast<std::int32_t>(_regions.size()))
+		return true;
+
+	for (std::int32_t i = 0; i < _number_of_workers; i++) {
+		if (not _workers[i]->queue()->is_empty())
+			return true;
+	}
+	return false;
+}
+
+bool ParallelScavenge::offer_termination() {
+	// Work is only created by workers that are not idle, so once all of them are idle, all is done.
+	_idle.fetch_add(1);
+	while (true) {
+		if (_idle.load() == _number_of_workers)
+			return true;
+
+		if (has_work()) {
+			_idle.fetch_sub(1);
+			return false;
+		}
+		std::this_thread::yield();
+	}
+}
+
+void ParallelScavenge::work(ScavengeWorker *w) {
+	_current = w;
+	MemOop obj;
+	while (true) {
+		if (w->queue()->pop(obj)) {
+			scan(obj);
+		}
+		else if (scan_region()) {
+			// nothing else to do
+		}
+		else if (steal(w, obj)) {
+			scan(obj);
+		}
+		else if (offer_termination()) {
+			break;
+		}
+	}
+	w->retire_buffers();
+	_current = nullptr;
+}
+
+Oop ParallelScavenge::copy(MemOop obj) {
+	st_assert(_current not_eq nullptr, "not a scavenge worker");
+
+	// claim the object, or wait for the worker that did
+	std::atomic_ref<MarkOop> header(*obj->mark_addr());
+	MarkOop mark = header.load(std::memory_order_acquire);
+	while (true) {
+		if (Oop(mark)->isMemOop())
+			return Oop(mark);
+
+		if (mark == busy_mark) {
+			std::this_thread::yield();
+			mark = header.load(std::memory_order_acquire);
+		}
+		else if (header.compare_exchange_weak(mark, busy_mark, std::memory_order_acquire)) {
+			break;
+		}
+	}
+
+	std::int32_t size = obj->size();
+	bool is_new = mark->age() < Universe::tenuring_threshold;
+	Oop *x = is_new ? _current->allocate_in_survivor_space(size) : nullptr;
+	if (x == nullptr) {
+		is_new = false;
+		x = _current->allocate_in_old_space(size);
+	}
+
+	MemOop p = as_memOop(x);
+	copy_oops(obj->oops(), x, size);
+	if (is_new) {
+		p->set_mark(mark->incr_age());
+		_current->age_table()->add(p, size);
+	}
+	else {
+		p->set_mark(mark);
+		if (Pretenuring::is_sampling())
+			Pretenuring::record_promotion(p, size);
+	}
+
+	header.store(MarkOop(p), std::memory_order_release);
+	_current->record_copy(p);
+	return p;
+}
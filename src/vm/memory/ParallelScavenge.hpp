@@ -0,0 +1,167 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+#include "vm/memory/AgeTable.hpp"
+#include "vm/memory/WaterMark.hpp"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <vector>
+#include <condition_variable>
+
+
+// ParallelScavenge copies the new generation with several threads (UseParallelScavenge).
+//
+// The roots (including the process stacks) are still evacuated by the VM thread, since walking
+// frames uses the resource area. Everything after that is shared by ParallelScavengeThreads workers,
+// the VM thread being worker 0:
+//
+//   - the objects the roots were copied to,
+//   - the runs of dirty cards in the old generation, split into chunks, and
+//   - every object a worker copies, which goes onto that worker's queue.
+//
+// An object is claimed by swapping its mark for a busy marker; the winner copies it and then installs
+// the forward pointer, other workers wait for it. Copies are allocated in per worker buffers carved
+// from the survivor space and the old generation; the unused rest of a buffer is turned into a filler
+// object at the end, so both spaces stay parsable. A worker without work steals from the other queues.
+
+class ScavengeQueue : public CHeapAllocatedObject {
+
+private:
+	std::mutex _lock;
+	std::deque<MemOop> _objects;
+
+public:
+	// the owner pushes and pops at the back, thieves take from the front
+	void push(MemOop obj);
+
+	bool pop(MemOop &obj);
+
+	bool steal(MemOop &obj);
+
+	bool is_empty();
+};
+
+class ScavengeWorker : public CHeapAllocatedObject {
+
+private:
+	std::int32_t _id;
+	ScavengeQueue _queue;
+	AgeTable _age_table;
+
+	Oop *_survivor_top;         // survivor space buffer
+	Oop *_survivor_end;
+	Oop *_promotion_top;        // old generation buffer
+	Oop *_promotion_end;
+
+	std::int32_t _copied;       // # of objects copied in the current scavenge
+	std::int32_t _stolen;       // # of objects taken from other queues
+
+	static Oop *allocate_in_buffer(Oop *&top, Oop *end, std::int32_t size);
+
+public:
+	ScavengeWorker(std::int32_t id);
+
+	std::int32_t id() const {
+		return _id;
+	}
+
+	ScavengeQueue *queue() {
+		return &_queue;
+	}
+
+	AgeTable *age_table() {
+		return &_age_table;
+	}
+
+	std::int32_t copied() const {
+		return _copied;
+	}
+
+	std::int32_t stolen() const {
+		return _stolen;
+	}
+
+	void begin();
+
+	// returns nullptr if the survivor space is full
+	Oop *allocate_in_survivor_space(std::int32_t size);
+
+	Oop *allocate_in_old_space(std::int32_t size);
+
+	void record_copy(MemOop obj);
+
+	void record_steal() {
+		_stolen++;
+	}
+
+	// turns the unused part of the buffers into filler objects
+	void retire_buffers();
+};
+
+class ParallelScavenge : AllStatic {
+
+private:
+	static bool _active;
+	static std::int32_t _number_of_workers;
+	static ScavengeWorker **_workers;
+	static thread_local ScavengeWorker *_current;
+
+	static std::mutex _allocation_lock;     // protects the tops of the spaces and the resource area
+
+	// starting and joining the helper threads
+	static std::mutex _start_lock;
+	static std::condition_variable _start;
+	static std::condition_variable _done;
+	static std::int32_t _generation;
+	static std::int32_t _running;
+
+	// old generation regions (runs of dirty cards), claimed in order
+	static std::vector<std::pair<Oop *, Oop *>> _regions;
+	static std::atomic<std::int32_t> _next_region;
+
+	static std::atomic<std::int32_t> _idle;
+
+	static void initialize();
+
+	static void helper_loop(ScavengeWorker *w);
+
+	static void work(ScavengeWorker *w);
+
+	static void add_region(Oop *from, Oop *to);
+
+	static void distribute(Oop *from, Oop *to, std::int32_t &next);
+
+	static bool scan_region();
+
+	static bool steal(ScavengeWorker *w, MemOop &obj);
+
+	static bool has_work();
+
+	static bool offer_termination();
+
+	static void scan(MemOop obj);
+
+public:
+	static bool is_active() {
+		return _active;
+	}
+
+	static std::mutex *allocation_lock() {
+		return &_allocation_lock;
+	}
+
+	// Scavenges everything reachable from the objects copied since the marks and from the dirty cards
+	// below old_mark; advances the marks to the current tops.
+	static void scavenge(NewWaterMark *to_mark, OldWaterMark *old_mark);
+
+	// Copies obj (in from space or eden) on behalf of the current worker and returns the copy
+	static Oop copy(MemOop obj);
+};
@@ -0,0 +1,85 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/Pretenuring.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/klass/Klass.hpp"
+#include "vm/runtime/flags.hpp"
+
+#include <atomic>
+
+
+std::unordered_map<KlassOop, Pretenuring::Statistics> Pretenuring::_statistics;
+std::vector<KlassOop> Pretenuring::_pretenured;
+bool Pretenuring::_sampling = false;
+std::int32_t Pretenuring::_scavenges = 0;
+
+
+void Pretenuring::begin_scavenge() {
+	_sampling = UsePretenuring and ++_scavenges % PretenureSampleInterval == 0;
+	if (not _sampling)
+		return;
+
+	// eden is parsable; the allocation buffers have been retired
+	EdenSpace *eden = Universe::new_gen.eden();
+	for (Oop *p = eden->bottom(); p < eden->top();) {
+		MemOop obj = as_memOop(p);
+		std::int32_t size = obj->size();
+		KlassOop klass = obj->klass();
+		if (klass->is_old())
+			_statistics[klass]._allocated += size;
+		p += size;
+	}
+}
+
+void Pretenuring::record_promotion(MemOop obj, std::int32_t size) {
+	// the table isn't changed during a scavenge, so the threads only have to update the counts atomically
+	auto entry = _statistics.find(obj->klass());
+	if (entry not_eq _statistics.end())
+		std::atomic_ref<std::int32_t>(entry->second._promoted).fetch_add(size, std::memory_order_relaxed);
+}
+
+void Pretenuring::end_scavenge() {
+	if (not _sampling)
+		return;
+	_sampling = false;
+	decide();
+}
+
+void Pretenuring::decide() {
+	for (auto entry = _statistics.begin(); entry not_eq _statistics.end();) {
+		KlassOop klass = entry->first;
+		Statistics *s = &entry->second;
+
+		Klass::Format format = klass->klass_part()->format();
+		bool supported = format == Klass::Format::mem_klass or format == Klass::Format::object_array_klass or format == Klass::Format::byte_array_klass;
+		bool long_lived = std::int64_t(s->_promoted) * 100 >= std::int64_t(s->_allocated) * PretenureThreshold;
+		if (supported and long_lived and s->_allocated >= PretenureMinSize * 1024 and not klass->klass_part()->is_pretenured()) {
+			klass->klass_part()->set_pretenured(true);
+			_pretenured.push_back(klass);
+			if (PrintHeapPolicy or PrintScavenge) {
+				const char *name = klass->klass_part()->delta_name();
+				SPDLOG_INFO("pretenuring: {} ({}K words allocated, {}K words promoted)", name ? name : "?", s->_allocated / 1024, s->_promoted / 1024);
+			}
+		}
+
+		s->_allocated /= 2;
+		s->_promoted /= 2;
+		if (s->_allocated == 0)
+			entry = _statistics.erase(entry);
+		else
+			entry++;
+	}
+}
+
+void Pretenuring::reset() {
+	for (KlassOop klass : _pretenured) {
+		klass->klass_part()->set_pretenured(false);
+	}
+	_pretenured.clear();
+	_statistics.clear();
+	_sampling = false;
+}
@@ -0,0 +1,68 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+#include "vm/oop/Oop.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+
+// Pretenuring allocates the instances of a class directly in the old generation (UsePretenuring)
+// once nearly all of them have turned out to be long-lived, so that they aren't copied through the
+// survivor spaces first.
+//
+// The feedback is gathered per class by every PretenureSampleInterval'th scavenge:
+//   - before it, the objects in eden are counted (the words allocated), and
+//   - while it runs, the objects it tenures are counted (the words promoted).
+// A class whose promoted words reach PretenureThreshold percent of its allocated words, with at
+// least PretenureMinSize K words allocated, is marked (Klass::set_pretenured). The counts decay by
+// half after each sample, so that old behaviour is forgotten.
+//
+// The decision is used by the allocation of plain objects, object arrays and byte arrays. The
+// generated primitiveNew stubs fail for a marked class, so that compiled code falls back to the
+// allocation primitives. Every full collection forgets all decisions, since the lifetimes of the
+// objects can be measured again afterwards; this also keeps the table of classes, which uses their
+// addresses, from having to follow them when they move.
+
+class Pretenuring : AllStatic {
+
+private:
+	struct Statistics {
+		std::int32_t _allocated;        // words in eden at the sampled scavenges
+		std::int32_t _promoted;         // words tenured by the sampled scavenges
+	};
+
+	// only old classes are counted; they don't move in a scavenge
+	static std::unordered_map<KlassOop, Statistics> _statistics;
+	static std::vector<KlassOop> _pretenured;
+	static bool _sampling;
+	static std::int32_t _scavenges;
+
+	static void decide();
+
+public:
+	// called by Universe::scavenge, before and after the scavenge
+	static void begin_scavenge();
+
+	static void end_scavenge();
+
+	static bool is_sampling() {
+		return _sampling;
+	}
+
+	// called for each object tenured by a sampled scavenge; may be called by several scavenge threads
+	static void record_promotion(MemOop obj, std::int32_t size);
+
+	// called by the full collectors and before changes to the heap; unmarks all classes
+	static void reset();
+
+	static std::int32_t number_of_pretenured_klasses() {
+		return static_cast<std::int32_t>(_pretenured.size());
+	}
+};
@@ -177,7 +177,8 @@ void Reflection::apply_change(MixinOop new_mixin, MixinOop old_mixin, ObjectArra
 
 		setup_schema_change();
 
-		// Do the transformation
+		// Do the transformation; the converted objects are allocated directly in eden, so that it can be walked from eden_mark
+		FlagSetting noTLAB(UseTLAB, false);
 		ConvertOopClosure blk;
 		ConvertClosure bl;
 		Universe::roots_do(&convert);
@@ -17,6 +17,10 @@
 #include "vm/runtime/runtime.hpp"
 #include "vm/oop/KlassOopDescriptor.hpp"
 #include "vm/memory/MarkSweep.hpp"
+#include "vm/oop/ObjectArrayOopDescriptor.hpp"
+#include "vm/runtime/flags.hpp"
+
+#include <emmintrin.h>
 
 
 //
@@ -34,16 +38,19 @@
 //
 
 //
-// To do list for the remembered set
-//
-// 1. Optimization suggested by Urs 9/30/95
-//    Speed up card scanning by comparing words for frequent case
-//    (A profile of Mark Sweep is necessary to make the call).
+// Scanning the cards during a scavenge
 //
-// 2. Handle objectArrays in a more efficient way. Scavenge only parts of the objectArray with dirty cards.
-//    The current implementation is REALLY slow for huge tenured objectArrays with few new pointers.
+// Clean cards are skipped a word (with UseSSE2, 16 bytes) at a time. For each run of dirty cards,
+// the objects on it are scanned and the cards cleared; scavenge_tenured_oop dirties the card of
+// each field still pointing into new space afterwards, so cards only pointing into old space end
+// up clean. Since the indexables of object arrays are marked precisely, only the part of a
+// large object array on the run is scanned (plus its header and instance variables, whose
+// stores mark the object's first card).
 //
 
+std::int32_t RememberedSet::_cards_dirty = 0;
+std::int32_t RememberedSet::_cards_scanned = 0;
+
 RememberedSet::RememberedSet() :
 		_lowBoundary{Universe::new_gen._lowBoundary},
 		_highBoundary{Universe::old_gen._highBoundary},
@@ -86,7 +93,7 @@ RememberedSet::RememberedSet(RememberedSet *old, const char *start, const char *
 	*/
 }
 
-char *RememberedSet::scavenge_contents(OldSpace *sp, char *begin, char *limit) {
+char *RememberedSet::claim_dirty_cards(OldSpace *sp, char *begin, char *limit, Oop *top, Oop **from, Oop **to) {
 
 	// make sure we are staring with a dirty page
 	st_assert(!*begin, "check for dirty page");
@@ -95,7 +102,8 @@ char *RememberedSet::scavenge_contents(OldSpace *sp, char *begin, char *limit) {
 	Oop *s = oop_for(begin);
 
 	// Return if we're at the end.
-	if (s >= sp->top()) {
+	if (s >= top) {
+		*from = *to = top;
 		return begin + 1;
 	}
 
@@ -110,9 +118,9 @@ char *RememberedSet::scavenge_contents(OldSpace *sp, char *begin, char *limit) {
 		}
 
 		// We now have a string of dirty pages [begin..end[
-		Oop *e = min(oop_for(end), (Oop *) sp->top());
+		Oop *e = min(oop_for(end), top);
 
-		if (e < (Oop *) sp->top()) {
+		if (e < top) {
 			// Find the object crossing the last dirty page
 			object_end = sp->object_start(e);
 			if (object_end not_eq e) {
@@ -130,16 +138,94 @@ char *RememberedSet::scavenge_contents(OldSpace *sp, char *begin, char *limit) {
 		*i = -1;
 	}
 
-	// Find the end
-	Oop *e = min(oop_for(end), (Oop *) sp->top());
+	*from = s;
+	*to = min(oop_for(end), top);
+	return end;
+}
 
-	while (s < e) {
+__attribute__((target("sse2")))
+static char *sse2_skip_clean_cards(char *p) {
+	while ((std::int32_t(p) & 15) not_eq 0) {
+		if (not *p)
+			return p;
+		p++;
+	}
+	// aligned loads never cross into a page beyond the sentinel
+	const __m128i clean = _mm_set1_epi8(-1);
+	while (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i *) p), clean)) == 0xFFFF)
+		p += 16;
+	while (*p)
+		p++;
+	return p;
+}
+
+char *RememberedSet::skip_clean_cards(char *p) {
+	if (UseSSE2)
+		return sse2_skip_clean_cards(p);
+
+	while ((std::int32_t(p) & (sizeof(std::uint32_t) - 1)) not_eq 0) {
+		if (not *p)
+			return p;
+		p++;
+	}
+	while (*(std::uint32_t *) p == 0xFFFFFFFF)
+		p += sizeof(std::uint32_t);
+	while (*p)
+		p++;
+	return p;
+}
+
+void RememberedSet::scavenge_array_contents(ObjectArrayOop array, Oop *from, Oop *to) {
+	array->scavenge_tenured_header();
+	array->scavenge_tenured_body(MemOopDescriptor::header_size(), array->blueprint()->non_indexable_size());
+
+	Oop *base = max(array->objs(1), from);
+	Oop *end = min(array->objs(1) + array->length(), to);
+	while (base < end)
+		scavenge_tenured_oop(base++);
+}
+
+char *RememberedSet::scavenge_contents(OldSpace *sp, char *begin, char *limit) {
+	st_assert(!*begin, "check for dirty page");
+	Oop *top = sp->top();
+
+	// the run of dirty cards [begin..end[
+	char *end = begin + 1;
+	while (!*end and end < limit)
+		end++;
+
+	Oop *from = oop_for(begin);
+	if (from >= top)
+		return begin + 1;
+
+	Oop *to = min(oop_for(end), top);
+	_cards_dirty += end - begin;
+	memset(begin, -1, end - begin);
+
+	Oop *s = sp->object_start(from);
+	while (s < to) {
 		MemOop m = as_memOop(s);
-		std::int32_t size = m->scavenge_tenured_contents();
-		st_assert(size = m->size(), "just checking");
+		std::int32_t size = m->size();
+		if ((s < from or s + size > to) and m->isObjectArray() and not m->is_weakArray()) {
+			// only the part on the dirty cards
+			scavenge_array_contents(ObjectArrayOop(m), from, to);
+		}
+		else {
+			if (s + size > to) {
+				// the rest of the object is scanned as well, so its cards need no second look; they are
+				// cleaned before the scan, which dirties them again where the object still points to new objects
+				char *object_end = byte_for(min(s + size, top));
+				if (object_end > end) {
+					memset(end, -1, object_end - end);
+					end = object_end;
+				}
+			}
+			m->scavenge_tenured_contents();
+		}
 		s += size;
 	}
 
+	_cards_scanned += end - begin;
 	return end;
 }
 
@@ -150,16 +236,40 @@ void RememberedSet::scavenge_contents(OldSpace *sp) {
 	*(end_byte + 1) = 0;
 
 	// scan over clean pages
-	while (*current_byte)
-		current_byte++;
+	current_byte = skip_clean_cards(current_byte);
 
 	while (current_byte <= end_byte) {
 		// Pass the dirty page on to scavenge_contents
 		current_byte = scavenge_contents(sp, current_byte, end_byte);
 
 		// scan over clean pages
-		while (*current_byte)
-			current_byte++;
+		current_byte = skip_clean_cards(current_byte);
+	}
+}
+
+void RememberedSet::dirty_regions_do(OldSpace *sp, Oop *top, void f(Oop *from, Oop *to)) {
+	char *current_byte = byte_for(sp->bottom());
+	char *end_byte = byte_for(top);
+	// set sentinel for scan (dirty page)
+	*(end_byte + 1) = 0;
+
+	// scan over clean pages
+	current_byte = skip_clean_cards(current_byte);
+
+	while (current_byte <= end_byte) {
+		Oop *from;
+		Oop *to;
+		char *begin = current_byte;
+		current_byte = claim_dirty_cards(sp, current_byte, end_byte, top, &from, &to);
+		if (from < to) {
+			// the claimed cards include those of the objects crossing the end of the run
+			_cards_dirty += current_byte - begin;
+			_cards_scanned += current_byte - begin;
+			f(from, to);
+		}
+
+		// scan over clean pages
+		current_byte = skip_clean_cards(current_byte);
 	}
 }
 
@@ -277,6 +387,11 @@ void RememberedSet::print_set_for_object(MemOop obj) {
 	}
 }
 
+void RememberedSet::record_stores(Oop *from, Oop *to) {
+	if (from < to)
+		memset(byte_for(from), 0, byte_for(to - 1) - byte_for(from) + 1);
+}
+
 bool RememberedSet::is_object_dirty(MemOop obj) {
 	st_assert(not obj->is_new(), "just checking");
 	char *current_byte = byte_for(obj->addr());
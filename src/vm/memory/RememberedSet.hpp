@@ -46,6 +46,10 @@ private:
 
 	char *byte_map_end() const;
 
+	// statistics of the last scavenge
+	static std::int32_t _cards_dirty;     // # of dirty cards found
+	static std::int32_t _cards_scanned;   // # of cards scanned, including those of objects crossing the end of a run
+
 public:
 	std::int32_t byte_map_size() const {
 		return (_highBoundary - _lowBoundary) / card_size;
@@ -71,6 +75,22 @@ public:
 		return *byte_for(p) == 0;
 	}
 
+	// Dirties all cards of [from..to[, for objects filled without store checks
+	void record_stores(Oop *from, Oop *to);
+
+	static void reset_statistics() {
+		_cards_dirty = 0;
+		_cards_scanned = 0;
+	}
+
+	static std::int32_t cards_dirty() {
+		return _cards_dirty;
+	}
+
+	static std::int32_t cards_scanned() {
+		return _cards_scanned;
+	}
+
 	// Tells is any card for obj is dirty
 	bool is_object_dirty(MemOop obj);
 
@@ -78,6 +98,15 @@ public:
 
 	char *scavenge_contents(OldSpace *s, char *begin, char *limit);
 
+	// Scavenges the header and instance variables of an object array and the indexables in [from..to[
+	void scavenge_array_contents(ObjectArrayOop array, Oop *from, Oop *to);
+
+	// Returns the first dirty card at or after p; the scans put a dirty sentinel after their last card
+	static char *skip_clean_cards(char *p);
+
+	// Calls f with the objects [from..to[ covered by each run of dirty cards below top, clearing the cards (used by the parallel scavenger)
+	void dirty_regions_do(OldSpace *s, Oop *top, void f(Oop *from, Oop *to));
+
 	bool verify(bool postScavenge);
 
 	void print_set_for_space(OldSpace *sp);
@@ -103,4 +132,7 @@ private:
 	RememberedSet(RememberedSet *old, const char *start, const char *end);
 
 	bool has_page_dirty_objects(OldSpace *sp, char *page);
+
+	// Clears the run of dirty cards starting at begin and returns the objects it covers in [*from..*to[
+	char *claim_dirty_cards(OldSpace *sp, char *begin, char *limit, Oop *top, Oop **from, Oop **to);
 };
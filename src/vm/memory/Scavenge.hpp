@@ -67,10 +67,12 @@ public:
 class VerifyNoAllocation : public VerifyNoScavenge {
 private:
 	Oop *_top_of_eden;
+	Oop *_top_of_buffer;
 
 public:
 	VerifyNoAllocation() :
-			_top_of_eden{Universe::new_gen.eden()->top()} {
+			_top_of_eden{Universe::new_gen.eden()->top()},
+			_top_of_buffer{tlab_top} {
 	}
 
 	VerifyNoAllocation(const VerifyNoAllocation &) = default;
@@ -81,7 +83,7 @@ public:
 	}
 
 	virtual ~VerifyNoAllocation() {
-		if (_top_of_eden not_eq Universe::new_gen.eden()->top()) {
+		if (_top_of_eden not_eq Universe::new_gen.eden()->top() or _top_of_buffer not_eq tlab_top) {
 			st_fatal("allocation should not have happened");
 		}
 	}
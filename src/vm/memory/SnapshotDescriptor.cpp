@@ -1,4 +1,3 @@
-
 //
 //  (C) 1994 - 2021, The Strongtalk authors and contributors
 //  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
@@ -8,12 +7,88 @@
 #include "vm/memory/Closure.hpp"
 #include "vm/memory/SnapshotDescriptor.hpp"
 #include "vm/memory/Universe.hpp"
+#include "vm/memory/SymbolTable.hpp"
+#include "vm/memory/RememberedSet.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/memory/Pretenuring.hpp"
+#include "vm/runtime/ReservedSpace.hpp"
+#include "vm/runtime/ResourceMark.hpp"
+#include "vm/platform/os.hpp"
+#include "vm/utility/GrowableArray.hpp"
+#include "vm/interpreter/CodeIterator.hpp"
+#include "vm/system/dll.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/oop/MethodOopDescriptor.hpp"
+#include "vm/oop/ProcessOopDescriptor.hpp"
+#include "vm/oop/ProxyOopDescriptor.hpp"
+#include "vm/klass/KlassKlass.hpp"
+#include "vm/klass/SmallIntegerKlass.hpp"
+#include "vm/klass/MemOopKlass.hpp"
+#include "vm/klass/ByteArrayKlass.hpp"
+#include "vm/klass/DoubleByteArrayKlass.hpp"
+#include "vm/klass/ObjectArrayKlass.hpp"
+#include "vm/klass/SymbolKlass.hpp"
+#include "vm/klass/DoubleKlass.hpp"
+#include "vm/klass/AssociationKlass.hpp"
+#include "vm/klass/MethodKlass.hpp"
+#include "vm/klass/BlockClosureKlass.hpp"
+#include "vm/klass/ContextKlass.hpp"
+#include "vm/klass/ProxyKlass.hpp"
+#include "vm/klass/MixinKlass.hpp"
+#include "vm/klass/WeakArrayKlass.hpp"
+#include "vm/klass/ProcessKlass.hpp"
+#include "vm/klass/DoubleValueArrayKlass.hpp"
+#include "vm/klass/VirtualFrameKlass.hpp"
+
+
+static constexpr std::int32_t snapshot_magic = 0x50414e53; // "SNAP"
+
+// All kinds of Klass found in the heap, in the same order as the class type bytes of the bootstrap file.
+// The vtbl values of the writing vm are stored in the header and mapped onto the ones of the reading vm.
+static void (*const vtbl_setters[])(Klass *) = {
+		setKlassVirtualTableFromKlassKlass,
+		setKlassVirtualTableFromSmiKlass,
+		setKlassVirtualTableFromMemOopKlass,
+		setKlassVirtualTableFromByteArrayKlass,
+		setKlassVirtualTableFromDoubleByteArrayKlass,
+		setKlassVirtualTableFromObjectArrayKlass,
+		setKlassVirtualTableFromSymbolKlass,
+		setKlassVirtualTableFromDoubleKlass,
+		setKlassVirtualTableFromAssociationKlass,
+		setKlassVirtualTableFromMethodKlass,
+		setKlassVirtualTableFromBlockClosureKlass,
+		setKlassVirtualTableFromContextKlass,
+		setKlassVirtualTableFromProxyKlass,
+		setKlassVirtualTableFromMixinKlass,
+		setKlassVirtualTableFromWeakArrayKlass,
+		setKlassVirtualTableFromProcessKlass,
+		setKlassVirtualTableFromDoubleValueArrayKlass,
+		setKlassVirtualTableFromVirtualFrameKlass,
+};
+
+static constexpr std::int32_t number_of_vtbls = sizeof(vtbl_setters) / sizeof(vtbl_setters[0]);
+
+static std::int32_t saved_vtbls[number_of_vtbls];
+
+static std::int32_t current_vtbl(std::int32_t index) {
+	std::int32_t vtbl[1];
+	Klass *k = (Klass *) vtbl;
+	vtbl_setters[index](k);
+	return k->vtbl_value();
+}
+
+OldSpace *SnapshotDescriptor::snapshot_space() {
+	OldSpace *space = Universe::old_gen._firstSpace;
+	st_assert(space->_nextSpace == nullptr, "snapshots support a single old space only");
+	return space;
+}
+
 
 class ReadClosure : public OopClosure {
 
 private:
 	void do_oop(Oop *o) {
-		st_unused(o); // unused
+		*o = _snapshotDescriptor->relocate(Oop(_snapshotDescriptor->read_word()));
 	}
 
 	SnapshotDescriptor *_snapshotDescriptor;
@@ -38,7 +113,7 @@ class WriteClosure : public OopClosure {
 
 private:
 	void do_oop(Oop *o) {
-		fprintf(_snapshotDescriptor->_file, "%#X\n", reinterpret_cast<unsigned int>(o));
+		_snapshotDescriptor->write_word(reinterpret_cast<std::int32_t>(*o));
 	}
 
 	SnapshotDescriptor *_snapshotDescriptor;
@@ -59,34 +134,123 @@ public:
 
 };
 
+// Relocates all oops of an object except the klass field (done when walking the space).
+class RelocateClosure : public OopClosure {
+
+private:
+	void do_oop(Oop *o) {
+		if (o not_eq _klass_addr)
+			*o = _snapshotDescriptor->relocate(*o);
+	}
+
+	SnapshotDescriptor *_snapshotDescriptor;
+
+public:
+	Oop *_klass_addr;
+
+	RelocateClosure(SnapshotDescriptor *s) :
+			_snapshotDescriptor{s},
+			_klass_addr{nullptr} {
+	}
+
+	RelocateClosure() = default;
+	virtual ~RelocateClosure() = default;
+	RelocateClosure(const RelocateClosure &) = default;
+	RelocateClosure &operator=(const RelocateClosure &) = default;
+
+	void operator delete(void *ptr) {
+		(void) (ptr);
+	}
+
+};
+
+// Universe::roots_do and SymbolTable::oops_do take plain functions
+static OopClosure *the_closure = nullptr;
+
+static void do_root(Oop *p) {
+	the_closure->do_oop(p);
+}
+
+
+// Native pointers stored in the heap are meaningless in a new vm
+static void clear_native_state(MemOop obj) {
+	if (obj->is_process()) {
+		ProcessOop(obj)->set_process(nullptr);
+	}
+	else if (obj->is_proxy()) {
+		ProxyOop(obj)->null_pointer();
+	}
+	else if (obj->is_method()) {
+		CodeIterator c{MethodOop(obj)};
+		do {
+			if (c.is_dll_call())
+				c.dll_cache()->set_entry_point(nullptr);
+		} while (c.advance());
+	}
+}
+
+
+std::int32_t SnapshotDescriptor::read_word() {
+	std::int32_t value = 0;
+	if (not _has_error and fread(&value, sizeof(value), 1, _file) not_eq 1)
+		error("unexpected end of snapshot");
+	return value;
+}
+
+void SnapshotDescriptor::write_word(std::int32_t value) {
+	if (not _has_error and fwrite(&value, sizeof(value), 1, _file) not_eq 1)
+		error("writing snapshot");
+}
+
+Oop SnapshotDescriptor::relocate(Oop value) {
+	if (_delta == 0 or not value->isMemOop())
+		return value;
+	const char *p = (const char *) value;
+	if (p < _bottom or p >= _bottom + _used)
+		return value;
+	return Oop(p + _delta);
+}
+
+
 void SnapshotDescriptor::read_header() {
 	read_revision();
+	if (_has_error)
+		return;
 	read_sizes();
+	read_vtbls();
 }
 
 void SnapshotDescriptor::write_header() {
 	write_revision();
 	write_sizes();
+	write_vtbls();
 }
 
 void SnapshotDescriptor::read_sizes() {
-
+	_bottom = (const char *) read_word();
+	_used = read_word();
+	std::int32_t page_size = read_word();
+	if (page_size not_eq os::vm_page_size())
+		SPDLOG_INFO("snapshot-read: written with page size {}", page_size);
 }
 
 void SnapshotDescriptor::write_sizes() {
-
+	OldSpace *space = snapshot_space();
+	_bottom = (const char *) space->bottom();
+	_used = (const char *) space->top() - _bottom;
+	write_word((std::int32_t) _bottom);
+	write_word(_used);
+	write_word(os::vm_page_size());
 }
 
-static const char *revision_format = "Delta snapshot revision: %d.%d\n";
-
 void SnapshotDescriptor::read_revision() {
-	fprintf(_file, revision_format, Universe::major_version(), Universe::snapshot_version());
-}
+	if (read_word() not_eq snapshot_magic) {
+		error("not a snapshot");
+		return;
+	}
 
-void SnapshotDescriptor::write_revision() {
-	std::int32_t major, snap;
-	if (fscanf(_file, revision_format, &major, &snap) not_eq 2)
-		error("reading revision");
+	std::int32_t major = read_word();
+	std::int32_t snap = read_word();
 
 	if (Universe::major_version() not_eq major)
 		error("major revision number conflict");
@@ -95,54 +259,271 @@ void SnapshotDescriptor::write_revision() {
 		error("snapshot revision number conflict");
 }
 
+void SnapshotDescriptor::write_revision() {
+	write_word(snapshot_magic);
+	write_word(Universe::major_version());
+	write_word(Universe::snapshot_version());
+}
+
+void SnapshotDescriptor::read_vtbls() {
+	if (read_word() not_eq number_of_vtbls) {
+		error("klass kinds conflict");
+		return;
+	}
+	for (std::int32_t i = 0; i < number_of_vtbls; i++) {
+		saved_vtbls[i] = read_word();
+	}
+}
+
+void SnapshotDescriptor::write_vtbls() {
+	write_word(number_of_vtbls);
+	for (std::int32_t i = 0; i < number_of_vtbls; i++) {
+		write_word(current_vtbl(i));
+	}
+}
+
 void SnapshotDescriptor::read_roots() {
 	ReadClosure blk(this);
-	Universe::root_iterate(&blk);
+	the_closure = &blk;
+	Universe::roots_do(do_root);
+	the_closure = nullptr;
 }
 
 void SnapshotDescriptor::write_roots() {
 	WriteClosure blk(this);
-	Universe::root_iterate(&blk);
+	the_closure = &blk;
+	Universe::roots_do(do_root);
+	the_closure = nullptr;
+}
+
+void SnapshotDescriptor::read_symbols() {
+	// the symbol list is terminated by 0 (never an Oop)
+	for (std::int32_t value = read_word(); value not_eq 0 and not _has_error; value = read_word()) {
+		SymbolOop s = SymbolOop(relocate(Oop(value)));
+		Universe::symbol_table->insert(s, hash((const char *) s->bytes(), s->length()));
+	}
+}
+
+void SnapshotDescriptor::write_symbols() {
+	WriteClosure blk(this);
+	the_closure = &blk;
+	Universe::symbol_table->oops_do(do_root);
+	the_closure = nullptr;
+	write_word(0);
 }
 
 void SnapshotDescriptor::read_spaces() {
+	// klassOops have their vtbl fixed before anything else; the size of an object depends on it
+	std::int32_t number_of_klasses = read_word();
+	std::int32_t *klasses = new_resource_array<std::int32_t>(number_of_klasses);
+	for (std::int32_t i = 0; i < number_of_klasses; i++) {
+		klasses[i] = read_word();
+	}
+	_data_offset = read_word();
+	std::int32_t data_size = read_word();
+	if (_has_error)
+		return;
+
+	map_space(data_size);
+	if (_has_error)
+		return;
+	fseek(_file, _data_offset + data_size, SEEK_SET);
+
+	std::int32_t vtbls[number_of_vtbls];
+	for (std::int32_t i = 0; i < number_of_vtbls; i++) {
+		vtbls[i] = current_vtbl(i);
+	}
+
+	Oop *bottom = snapshot_space()->bottom();
+	for (std::int32_t i = 0; i < number_of_klasses; i++) {
+		Klass *k = KlassOop(as_memOop(bottom + klasses[i]))->klass_part();
+		std::int32_t j = 0;
+		while (j < number_of_vtbls and saved_vtbls[j] not_eq k->vtbl_value())
+			j++;
+		if (j == number_of_vtbls) {
+			error("unknown klass vtbl");
+			return;
+		}
+		k->set_vtbl_value(vtbls[j]);
+	}
 
+	relocate_space();
 }
 
 void SnapshotDescriptor::write_spaces() {
+	OldSpace *space = snapshot_space();
+	Oop *bottom = space->bottom();
 
+	GrowableArray<std::int32_t> *klasses = new GrowableArray<std::int32_t>(1024);
+	for (Oop *p = bottom; p < space->top(); p += as_memOop(p)->size()) {
+		if (as_memOop(p)->is_klass())
+			klasses->append(p - bottom);
+	}
+
+	write_word(klasses->length());
+	for (std::size_t i = 0; i < klasses->length(); i++) {
+		write_word(klasses->at(i));
+	}
+
+	// the words of the space start on a page boundary so they can be mapped directly
+	_data_offset = ReservedSpace::page_align_size(ftell(_file) + 2 * sizeof(std::int32_t));
+	std::int32_t data_size = ReservedSpace::page_align_size(_used);
+	write_word(_data_offset);
+	write_word(data_size);
+	while (not _has_error and ftell(_file) < _data_offset)
+		write_word(0);
+
+	if (not _has_error and fwrite(bottom, 1, _used, _file) not_eq (std::size_t) _used)
+		error("writing snapshot");
+	while (not _has_error and ftell(_file) < _data_offset + data_size)
+		write_word(0);
 }
 
-void SnapshotDescriptor::read_zone() {
+void SnapshotDescriptor::map_space(std::int32_t data_size) {
+	OldSpace *space = snapshot_space();
+	char *bottom = (char *) space->bottom();
+
+	if (_used > Universe::old_gen._virtualSpace.reserved_size()) {
+		error("old generation too small for snapshot");
+		return;
+	}
+
+	std::int32_t committed = (char *) space->end() - bottom;
+	if (committed < _used and space->expand(_used - committed) < _used - committed) {
+		error("cannot expand old generation for snapshot");
+		return;
+	}
 
+	// map when the file layout matches our page size, otherwise read
+	std::int32_t size = ReservedSpace::page_align_size(_used);
+	bool mapped = _data_offset % os::vm_page_size() == 0 and size <= data_size and os::map_memory(bottom, size, fileno(_file), _data_offset);
+	if (not mapped) {
+		fseek(_file, _data_offset, SEEK_SET);
+		if (fread(bottom, 1, _used, _file) not_eq (std::size_t) _used) {
+			error("reading snapshot spaces");
+			return;
+		}
+	}
+	space->set_top((Oop *) (bottom + _used));
+	_delta = bottom - _bottom;
+
+	SPDLOG_INFO("snapshot-read: {} bytes {} at {}", _used, mapped ? "mapped" : "read", static_cast<const void *>( bottom ));
+}
+
+void SnapshotDescriptor::relocate_space() {
+	OldSpace *space = snapshot_space();
+
+	// first pass: klass fields and the object start table
+	space->initialize_threshold();
+	for (Oop *p = space->bottom(); p < space->top();) {
+		MemOop obj = as_memOop(p);
+		*obj->klass_addr() = relocate(obj->klass_field());
+		std::int32_t size = obj->size();
+		space->update_offsets(p, p + size);
+		p += size;
+	}
+
+	// second pass: everything else
+	RelocateClosure blk(this);
+	for (Oop *p = space->bottom(); p < space->top(); p += as_memOop(p)->size()) {
+		MemOop obj = as_memOop(p);
+		if (_delta not_eq 0) {
+			blk._klass_addr = obj->klass_addr();
+			obj->oop_iterate(&blk);
+		}
+		clear_native_state(obj);
+	}
+
+	// the new generation is empty; there are no old-to-new pointers
+	Universe::remembered_set->clear();
+}
+
+void SnapshotDescriptor::read_zone() {
+	// compiled code is not part of a snapshot; the zone starts out empty
+	if (read_word() not_eq 0)
+		error("snapshot contains compiled code");
 }
 
 void SnapshotDescriptor::write_zone() {
+	write_word(0);
+}
 
+bool SnapshotDescriptor::is_snapshot(const char *name) {
+	FILE *file = fopen(name, "rb");
+	if (file == nullptr)
+		return false;
+	std::int32_t magic = 0;
+	bool result = fread(&magic, sizeof(magic), 1, file) == 1 and magic == snapshot_magic;
+	fclose(file);
+	return result;
 }
 
 void SnapshotDescriptor::read_from(const char *name) {
-	st_unused(name); // unused
+	ResourceMark resourceMark;
+
+	_file = fopen(name, "rb");
+	if (_file == nullptr) {
+		error("cannot open snapshot");
+		return;
+	}
 
 	read_header();
-	read_spaces();
-	read_roots();
-	read_zone();
+	if (not _has_error)
+		read_spaces();
+	if (not _has_error)
+		read_roots();
+	if (not _has_error)
+		read_symbols();
+	if (not _has_error)
+		read_zone();
+
+	fclose(_file);
+	_file = nullptr;
 }
 
 void SnapshotDescriptor::write_on(const char *name) {
-	st_unused(name); // unused
+	ResourceMark resourceMark;
+
+	// only the old generation is written; see SystemPrimitives::writeSnapshot
+	if (Universe::new_gen.used() not_eq 0) {
+		error("new generation is not empty");
+		return;
+	}
+	if (Universe::old_gen._firstSpace->_nextSpace not_eq nullptr) {
+		error("more than one old space");
+		return;
+	}
+
+	// interpreter inline caches refer to compiled code, which is not saved
+	Universe::flush_inline_caches_in_methods();
+
+	// the pretenuring decisions are bits of the classes, but their statistics are not saved; forget
+	// them as a full collection does, so that the restored system measures the lifetimes again
+	Pretenuring::reset();
+
+	_file = fopen(name, "wb");
+	if (_file == nullptr) {
+		error("cannot open snapshot");
+		return;
+	}
 
 	write_header();
 	write_spaces();
 	write_roots();
+	write_symbols();
 	write_zone();
+
+	fclose(_file);
+	_file = nullptr;
 }
 
 void SnapshotDescriptor::error(const char *msg) {
-	st_fatal(msg);
+	SPDLOG_INFO("snapshot-error: {}", msg);
+	_has_error = true;
+	if (_error_message == nullptr)
+		_error_message = msg;
 }
 
 SymbolOop SnapshotDescriptor::error_symbol() {
-	return nullptr;
+	return OopFactory::new_symbol(_error_message == nullptr ? "snapshot error" : _error_message);
 }
@@ -10,11 +10,29 @@
 
 
 // SnapshotDescriptor is the class handling reading and writing of snapshots
+//
+// A snapshot is a binary image of the old generation taken after a full collection (the new generation is empty):
+//
+//   header   magic, major and snapshot revision, space sizes and the vtbl values of all Klass kinds
+//   spaces   offsets of all klassOops followed by the raw words of the old space, page aligned in the file
+//   roots    the values of Universe::roots_do, in order
+//   symbols  offsets of all symbols in the symbol table
+//   zone     always empty; compiled code is not saved
+//
+// On startup the old space words are mapped (copy on write) at the bottom of the reserved old generation.
+// Oops only have to be relocated when that address differs from the one the snapshot was written at.
 
 class SnapshotDescriptor : StackAllocatedObject {
 private:
 	FILE *_file;
 	bool _has_error;
+	const char *_error_message;
+
+	// values describing the snapshot being read or written
+	const char *_bottom;            // bottom of the old space when the snapshot was written
+	std::int32_t _used;             // size of the old space in bytes
+	std::int32_t _data_offset;      // file offset of the (page aligned) old space words
+	std::int32_t _delta;            // difference between the mapped and the original address of the old space
 
 	// HEADER
 	void read_header();
@@ -29,24 +47,53 @@ private:
 
 	void write_revision();
 
+	void read_vtbls();
+
+	void write_vtbls();
+
 	// ROOTS
 	void read_roots();
 
 	void write_roots();
 
+	// SYMBOLS
+	void read_symbols();
+
+	void write_symbols();
+
 	// OBJECTS
+	static OldSpace *snapshot_space();
+
 	void read_spaces();
 
 	void write_spaces();
 
+	void map_space(std::int32_t data_size);
+
+	void relocate_space();
+
 	// ZONE
 	void read_zone();
 
 	void write_zone();
 
+	// primitive io
+	std::int32_t read_word();
+
+	void write_word(std::int32_t value);
+
+	Oop relocate(Oop value);
+
 public:
 
-	SnapshotDescriptor() : _file{nullptr}, _has_error{false} {
+	SnapshotDescriptor() :
+			_file{nullptr},
+			_has_error{false},
+			_error_message{nullptr},
+			_bottom{nullptr},
+			_used{0},
+			_data_offset{0},
+			_delta{0} {
 
 	}
 
@@ -58,6 +105,9 @@ public:
 		(void) (ptr);
 	}
 
+	// Tells whether the file is a snapshot (as opposed to a bootstrap file)
+	static bool is_snapshot(const char *name);
+
 	void read_from(const char *name);
 
 	void write_on(const char *name);
@@ -73,4 +123,6 @@ public:
 	friend class WriteClosure;
 
 	friend class ReadClosure;
+
+	friend class RelocateClosure;
 };
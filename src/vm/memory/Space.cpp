@@ -5,11 +5,13 @@
 //
 
 #include "vm/memory/Space.hpp"
+#include "vm/memory/OldSpaceFreeList.hpp"
 #include "vm/memory/Universe.hpp"
 #include "vm/oop/MemOopDescriptor.hpp"
 #include "vm/memory/Closure.hpp"
 #include "vm/runtime/ResourceArea.hpp"
 #include "vm/runtime/flags.hpp"
+#include "vm/platform/os.hpp"
 
 extern "C" {
 Oop *eden_bottom = nullptr;
@@ -208,6 +210,7 @@ OldSpace::OldSpace(const char *name, std::int32_t &size) :
 		_top{nullptr},
 		_end{nullptr},
 		_nextSpace{nullptr},
+		_freeList{new OldSpaceFreeList()},
 		_offsetArray{nullptr},
 		_nextOffsetThreshold{nullptr},
 		_nextOffsetIndex{0} {
@@ -239,13 +242,106 @@ void OldSpace::update_offset_array(Oop *p, Oop *p_end) {
 	}
 }
 
+void OldSpace::set_offsets(Oop *begin, Oop *end) {
+	//  [    ][    ][    ]       "card pages"
+	//    ^begin        ^end      the entries of the 2nd and 3rd card point back to begin
+
+	std::int32_t index = (begin - _bottom) / card_size_in_oops + 1;
+	for (Oop *t = _bottom + index * card_size_in_oops; t <= end and t < _nextOffsetThreshold; t += card_size_in_oops) {
+		_offsetArray[index++] = min(t - begin, card_size_in_oops);
+	}
+}
+
+void OldSpace::retract_top(Oop *value) {
+	st_assert(_bottom <= value and value <= _top, "must be in space");
+	_top = value;
+
+	// the offsets above the new top are written again as the space fills up
+	_nextOffsetIndex = (value - _bottom + card_size_in_oops - 1) / card_size_in_oops;
+	if (_nextOffsetIndex == 0) {
+		initialize_threshold();
+	}
+	else {
+		_nextOffsetThreshold = _bottom + _nextOffsetIndex * card_size_in_oops;
+	}
+}
+
+bool OldSpace::has_free_chunks() {
+	return not _freeList->is_empty();
+}
+
+void OldSpace::add_free_chunk(Oop *chunk, Oop *chunk_end, bool clear_body) {
+	Universe::fill(chunk, chunk_end, clear_body);
+	set_offsets(chunk, chunk_end);
+	_freeList->add(chunk, chunk_end - chunk);
+
+	if (clear_body and Universe::is_large_object_size(chunk_end - chunk)) {
+		// give the pages of a dead large object back; they read as SmallInteger 0 afterwards, which is a valid filler body
+		std::uint32_t page_size = os::vm_page_size();
+		std::uint32_t from = ((std::uint32_t) (chunk + MemOopDescriptor::header_size() + 1) + page_size - 1) / page_size * page_size;
+		std::uint32_t to = ((std::uint32_t) chunk_end) / page_size * page_size;
+		if (from < to and not os::discard_memory((const char *) from, to - from)) {
+			st_fatal("os::discard_memory failed");
+		}
+	}
+}
+
+Oop *OldSpace::allocate_free(std::int32_t size) {
+	std::int32_t chunk_size;
+	Oop *p = _freeList->remove(size, chunk_size);
+	if (p == nullptr)
+		return nullptr;
+
+	set_offsets(p, p + size);
+	if (chunk_size > size)
+		add_free_chunk(p + size, p + chunk_size, false);
+	return p;
+}
+
+std::int32_t OldSpace::page_padding(Oop *p) {
+	std::int32_t page_words = os::vm_page_size() / OOP_SIZE;
+	std::int32_t padding = (page_words - ((std::uint32_t) p / OOP_SIZE) % page_words) % page_words;
+	if (padding not_eq 0 and padding < MemOopDescriptor::header_size())
+		padding += page_words;
+	return padding;
+}
+
+Oop *OldSpace::allocate_large(std::int32_t size, bool allow_expansion) {
+	Oop *p;
+
+	// a free chunk the object fits in at any alignment, leaving room for a filler behind it
+	std::int32_t page_words = os::vm_page_size() / OOP_SIZE;
+	std::int32_t chunk_size;
+	Oop *chunk = _freeList->remove(size + page_words + 2 * MemOopDescriptor::header_size(), chunk_size);
+	if (chunk not_eq nullptr) {
+		p = chunk + page_padding(chunk);
+		if (p > chunk)
+			add_free_chunk(chunk, p, false);
+		add_free_chunk(p + size, chunk + chunk_size, false);
+	}
+	else {
+		std::int32_t padding = page_padding(_top);
+		chunk = allocate(padding + size, allow_expansion);
+		if (chunk == nullptr)
+			return nullptr;
+		p = chunk + padding;
+		if (p > chunk)
+			add_free_chunk(chunk, p);
+	}
+
+	set_offsets(p, p + size);
+	return p;
+}
+
 extern "C" {
 std::int32_t expansion_count = 0;
 }
 
 std::int32_t OldSpace::expand(std::int32_t size) {
 	std::int32_t min_size = ReservedSpace::page_align_size(size);
-	std::int32_t expand_size = ReservedSpace::align_size(min_size, ObjectHeapExpandSize * 1024);
+	if (min_size > Universe::old_gen._virtualSpace.uncommitted_size())
+		return 0;
+	std::int32_t expand_size = min(ReservedSpace::align_size(min_size, ObjectHeapExpandSize * 1024), Universe::old_gen._virtualSpace.uncommitted_size());
 	Universe::old_gen._virtualSpace.expand(expand_size);
 	set_end((Oop *) Universe::old_gen._virtualSpace.high());
 	expansion_count++;
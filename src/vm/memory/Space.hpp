@@ -250,11 +250,19 @@ public:
 
 class OldSpaceMark;
 
+class OldSpaceFreeList;
+
 class OldSpace : public Space {
 	friend class Space;
 
 	friend class OldSpaceMark;
 
+	friend class SnapshotDescriptor;
+
+	friend class MarkCompact;
+
+	friend class IncrementalMarking;
+
 private:
 	Oop *_bottom;
 	Oop *_top;
@@ -305,12 +313,40 @@ public:
 
 	void update_offset_array(Oop *p, Oop *p_end);
 
-	std::int32_t expand(std::int32_t size);
+	std::int32_t expand(std::int32_t size);             // returns the # of bytes committed, 0 if the reserved space is exhausted
 
 	Oop *expand_and_allocate(std::int32_t size);
 
 	std::int32_t shrink(std::int32_t size);
 
+	// Sets the offsets of the cards starting in ]begin, end] to begin, for objects not allocated at the top
+	void set_offsets(Oop *begin, Oop *end);
+
+	// Gives up the (dead) objects above value
+	void retract_top(Oop *value);
+
+	// Free chunks between the objects, found by the sweep of MarkCompact (UseOldSpaceFreeLists)
+	OldSpaceFreeList *_freeList;
+
+	OldSpaceFreeList *free_list() {
+		return _freeList;
+	}
+
+	bool has_free_chunks();
+
+	// Turns [chunk, chunk_end[ into a filler object and adds it to the free list;
+	// a piece of a free chunk keeps the body of the old filler (see Universe::fill)
+	void add_free_chunk(Oop *chunk, Oop *chunk_end, bool clear_body = true);
+
+	// Allocates in a free chunk, or returns nullptr
+	Oop *allocate_free(std::int32_t size);
+
+	// Allocates a large object (UseLargeObjectAllocation) at a page boundary, in a free chunk or at the top
+	Oop *allocate_large(std::int32_t size, bool allow_expansion = true);
+
+	// the words from p to the next page boundary, with room for a filler object
+	static std::int32_t page_padding(Oop *p);
+
 	// Keeps offset for retrieving object start given a card_page
 	std::uint8_t *_offsetArray;
 	Oop *_nextOffsetThreshold;
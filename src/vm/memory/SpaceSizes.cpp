@@ -17,6 +17,8 @@ void SpaceSizes::initialize() {
 	_reserved_object_size = scale_and_adjust(ReservedHeapSize);
 	_eden_size = scale_and_adjust(EdenSize);
 	_surv_size = scale_and_adjust(SurvivorSize);
+	_max_eden_size = UseAdaptiveNewGeneration ? max(_eden_size, scale_and_adjust(MaxEdenSize)) : _eden_size;
+	_max_surv_size = UseAdaptiveNewGeneration ? max(_surv_size, scale_and_adjust(MaxSurvivorSize)) : _surv_size;
 	_old_size = scale_and_adjust(OldSize);
 	_reserved_codes_size = scale_and_adjust(ReservedCodeSize); // not used?
 	_code_size = scale_and_adjust(CodeSize);
@@ -16,6 +16,8 @@ public:
 	std::int32_t _reserved_object_size;   // reserved space for all objects
 	std::int32_t _eden_size;              // size of eden
 	std::int32_t _surv_size;              // size of from & to spaces
+	std::int32_t _max_eden_size;          // reserved space for eden (UseAdaptiveNewGeneration)
+	std::int32_t _max_surv_size;          // reserved space for each survivor space
 	std::int32_t _old_size;               // size of old Space
 
 	// compiled code
@@ -32,6 +34,8 @@ public:
 			_reserved_object_size{0},
 			_eden_size{0},
 			_surv_size{0},
+			_max_eden_size{0},
+			_max_surv_size{0},
 			_old_size{0},
 			_reserved_codes_size{0},
 			_code_size{0},
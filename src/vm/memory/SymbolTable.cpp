@@ -149,6 +149,11 @@ SymbolOop SymbolTable::basic_add(SymbolOop s, std::int32_t hashValue) {
 	s->set_mark(s->mark()->set_hash(s->hash_value()));
 	st_assert(s->mark()->has_valid_hash(), "should have a hash now");
 
+	insert(s, hashValue);
+	return s;
+}
+
+void SymbolTable::insert(SymbolOop s, std::int32_t hashValue) {
 	SymbolTableEntry *bucket = bucketFor(hashValue);
 
 	if (bucket->is_empty()) {
@@ -164,7 +169,6 @@ SymbolOop SymbolTable::basic_add(SymbolOop s, std::int32_t hashValue) {
 		}
 		bucket->set_link(Universe::symbol_table->new_link(s, old_link));
 	}
-	return s;
 }
 
 void SymbolTable::switch_pointers(Oop from, Oop to) {
@@ -228,6 +232,42 @@ void SymbolTable::follow_used_symbols() {
 	}
 }
 
+void SymbolTable::remove_unmarked_symbols(bool is_marked(MemOop)) {
+	// same as follow_used_symbols, but the surviving symbols are left alone
+	SymbolTableEntry *e{nullptr};
+	FOR_ALL_ENTRIES(e) {
+		if (e->get_link() and not e->get_link()->_next) {
+			SymbolTableLink *old = e->get_link();
+			e->set_symbol(old->_symbol);
+			delete_link(old);
+		}
+
+		if (e->is_symbol()) {
+			if (not is_marked(e->get_symbol())) {
+				e->clear(); // unreachable; clear entry
+			}
+		}
+		else {
+			SymbolTableLink **p = (SymbolTableLink **) e;
+			SymbolTableLink *link = e->get_link();
+			while (link) {
+				if (is_marked(link->_symbol)) {
+					p = &link->_next;
+					link = link->_next;
+				}
+				else {
+					// unreachable; remove from table
+					SymbolTableLink *old = link;
+					*p = link->_next;
+					link = link->_next;
+					old->_next = nullptr;
+					delete_link(old);
+				}
+			}
+		}
+	}
+}
+
 void SymbolTableEntry::deallocate() {
 
 	if (not is_symbol() and get_link()) {
@@ -272,6 +312,14 @@ void SymbolTable::relocate() {
 	}
 }
 
+void SymbolTable::oops_do(void f(Oop *)) {
+	SymbolTableEntry *e;
+	FOR_ALL_ENTRIES(e) {
+		SymbolOop *addr;
+		FOR_ALL_SYMBOL_ADDR(e, addr, f((Oop *) addr));
+	}
+}
+
 bool SymbolTableLink::verify(std::int32_t i) {
 	bool flag = true;
 
@@ -115,6 +115,8 @@ protected:
 
 	SymbolOop basic_add(SymbolOop s, std::int32_t hashValue);
 
+	void insert(SymbolOop s, std::int32_t hashValue); // Also used when reading a snapshot
+
 	SymbolTableEntry *bucketFor(std::int32_t hashValue);
 
 	SymbolTableEntry *firstBucket();
@@ -127,10 +129,14 @@ public:
 	// memory operations
 	void follow_used_symbols(); // Used during phase1 of garbage collection
 
+	void remove_unmarked_symbols(bool is_marked(MemOop)); // Used by MarkCompact, which keeps its marks outside the objects
+
 	void switch_pointers(Oop from, Oop to);
 
 	void relocate();
 
+	void oops_do(void f(Oop *));
+
 	void verify();
 
 	// memory management for symbolTableLinks
@@ -142,4 +148,6 @@ public:
 	void print_histogram();
 
 	friend class Bootstrap;
+
+	friend class SnapshotDescriptor;
 };
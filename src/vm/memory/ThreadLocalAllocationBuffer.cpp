@@ -0,0 +1,76 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/ThreadLocalAllocationBuffer.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/oop/MemOopDescriptor.hpp"
+#include "vm/runtime/Processes.hpp"
+#include "vm/runtime/flags.hpp"
+
+
+// For the active Delta process, the allocation buffer is stored in these global vars, not in the process
+Oop *tlab_top = nullptr;
+Oop *tlab_end = nullptr;
+
+std::int32_t ThreadLocalAllocationBuffer::_refills = 0;
+
+
+void ThreadLocalAllocationBuffer::save() {
+	st_assert(is_empty(), "process already has a buffer");
+	_top = tlab_top;
+	_end = tlab_end;
+	tlab_top = tlab_end = nullptr;
+}
+
+void ThreadLocalAllocationBuffer::restore() {
+	st_assert(tlab_top == nullptr, "active buffer must be saved or retired first");
+	tlab_top = _top;
+	tlab_end = _end;
+	_top = _end = nullptr;
+}
+
+void ThreadLocalAllocationBuffer::retire() {
+	if (_top == nullptr)
+		return;
+
+	// the space behind _end is reserved for the filler
+	Universe::fill(_top, _end + MemOopDescriptor::header_size());
+	_top = _end = nullptr;
+}
+
+void ThreadLocalAllocationBuffer::retire_active() {
+	ThreadLocalAllocationBuffer active;
+	active.save();
+	active.retire();
+}
+
+void ThreadLocalAllocationBuffer::retire_all() {
+	retire_active();
+	Processes::retire_allocation_buffers();
+}
+
+Oop *ThreadLocalAllocationBuffer::allocate_slow(std::int32_t size) {
+	EdenSpace *eden = Universe::new_gen.eden();
+	std::int32_t buffer_size = TLABSize * 1024 / OOP_SIZE;
+
+	// large objects don't go through the buffer, so that it isn't retired half empty
+	if (not UseTLAB or size > buffer_size / 4)
+		return eden->allocate(size);
+
+	Oop *buffer = eden->allocate(buffer_size + MemOopDescriptor::header_size());
+	if (buffer == nullptr) {
+		// use up the rest of eden without a buffer
+		return eden->allocate(size);
+	}
+
+	retire_active();
+	tlab_top = buffer;
+	tlab_end = buffer + buffer_size;
+	_refills++;
+
+	Oop *result = tlab_top;
+	tlab_top += size;
+	return result;
+}
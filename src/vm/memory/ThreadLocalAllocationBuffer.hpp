@@ -0,0 +1,74 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+#include "vm/oop/Oop.hpp"
+
+
+// A ThreadLocalAllocationBuffer is a chunk of eden (TLABSize Kbytes) owned by one DeltaProcess,
+// in which the process bump-allocates without touching eden's top (UseTLAB).
+//
+// Like last_delta_fp, the buffer of the active process lives in the globals tlab_top/tlab_end,
+// which the generated allocation code (see PrimitivesGenerator) uses directly; an inactive process
+// keeps it in its DeltaProcess. DeltaProcess::set_active saves and restores it.
+//
+// Each buffer is carved with room for a filler object behind tlab_end, so that its unused part can
+// be made parsable again ("retired") whenever eden is walked.
+
+extern "C" Oop *tlab_top;
+extern "C" Oop *tlab_end;
+
+class ThreadLocalAllocationBuffer : public ValueObject {
+
+private:
+	Oop *_top;
+	Oop *_end;
+
+	static std::int32_t _refills;
+
+	static Oop *allocate_slow(std::int32_t size);
+
+public:
+	ThreadLocalAllocationBuffer() :
+			_top{nullptr},
+			_end{nullptr} {
+	}
+
+	bool is_empty() const {
+		return _top == nullptr;
+	}
+
+	// moves the active buffer into this one
+	void save();
+
+	// makes this buffer the active one
+	void restore();
+
+	// fills the unused part and forgets the buffer
+	void retire();
+
+	// allocation in the active buffer; refills it from eden if needed, returns nullptr if eden is full
+	static Oop *allocate(std::int32_t size) {
+		Oop *oops = tlab_top;
+		Oop *oops_end = oops + size;
+		if (oops_end <= tlab_end) {
+			tlab_top = oops_end;
+			return oops;
+		}
+		return allocate_slow(size);
+	}
+
+	static void retire_active();
+
+	// retires the buffers of all processes; called before eden is walked, compacted or cleared
+	static void retire_all();
+
+	static std::int32_t refills() {
+		return _refills;
+	}
+};
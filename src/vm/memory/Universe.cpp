@@ -13,6 +13,11 @@
 #include "vm/interpreter/InterpretedInlineCache.hpp"
 #include "vm/interpreter/PrettyPrinter.hpp"
 #include "vm/memory/AgeTable.hpp"
+#include "vm/memory/HeapPolicy.hpp"
+#include "vm/memory/IncrementalMarking.hpp"
+#include "vm/memory/Pretenuring.hpp"
+#include "vm/memory/ParallelScavenge.hpp"
+#include "vm/recompiler/CompileQueue.hpp"
 #include "vm/memory/SymbolTable.hpp"
 #include "vm/memory/PrintObjectClosure.hpp"
 #include "vm/memory/OopFactory.hpp"
@@ -116,12 +121,12 @@ void Universe::genesis() {
 		st_fatal("could not reserve enough space for object heap");
 	}
 
-	std::int32_t new_size = ReservedSpace::page_align_size(current_sizes._eden_size + 2 * current_sizes._surv_size);
+	std::int32_t new_size = ReservedSpace::page_align_size(current_sizes._max_eden_size + 2 * current_sizes._max_surv_size);
 
 	ReservedSpace new_rs = rs.first_part(new_size);
 	ReservedSpace old_rs = rs.last_part(new_size);
 
-	new_gen.initialize(new_rs, current_sizes._eden_size, current_sizes._surv_size);
+	new_gen.initialize(new_rs, current_sizes._eden_size, current_sizes._surv_size, current_sizes._max_eden_size, current_sizes._max_surv_size);
 	old_gen.initialize(old_rs, current_sizes._old_size);
 
 	st_assert(new_gen._highBoundary <= old_gen._lowBoundary, "old Space allocated lower than new Space");
@@ -164,6 +169,10 @@ void Universe::switch_pointers(Oop from, Oop to) {
 	// st_assert(not from->is_old() or to->is_old(), "shouldn't be switching an old Oop to a new Oop");
 	// APPLY_TO_VM_OOPS( SWITCH_POINTERS_TEMPLATE );
 
+	// the marks of an incremental marking cycle don't know about the switch
+	IncrementalMarking::abort();
+	Pretenuring::reset();
+
 	new_gen.switch_pointers(from, to);
 	old_gen.switch_pointers(from, to);
 
@@ -635,6 +644,8 @@ void Universe::oops_do(void f(Oop *)) {
 	Handles::oops_do(f);
 	// Iterate over the oops in the inlining database
 	InliningDatabase::oops_do(f);
+	// Iterate over the queued compilations
+	CompileQueue::oops_do(f);
 }
 
 void Universe::add_global(Oop value) {
@@ -669,7 +680,7 @@ Oop *Universe::allocate_in_survivor_space(MemOop p, std::int32_t size, bool &is_
 	}
 	else {
 		is_new = false;
-		return old_gen.allocate(size);
+		return old_gen.promote(size);
 	}
 }
 
@@ -702,13 +713,12 @@ bool Universe::can_scavenge() {
 	return true;
 }
 
-extern "C" void scavenge_and_allocate(std::int32_t size) {
-	Universe::scavenge_and_allocate(size, nullptr);
+// slow path of the generated allocation code: refills the allocation buffer, or scavenges if eden is full
+extern "C" Oop *scavenge_and_allocate(std::int32_t size) {
+	return Universe::allocate(size);
 }
 
 Oop *Universe::scavenge_and_allocate(std::int32_t size, Oop *p) {
-	// Fix this:
-	//  If it is a huge object we are allocating we should allocate it in old_space and return without doing a scavenge
 	if (not can_scavenge()) {
 		_scavenge_blocked = true;
 		return allocate_tenured(size);
@@ -716,6 +726,11 @@ Oop *Universe::scavenge_and_allocate(std::int32_t size, Oop *p) {
 
 	VM_Scavenge op(p);
 	VMProcess::execute(&op);
+
+	// the scavenger never reclaims the old generation; let the heap policy decide whether it is time for a full collection
+	// (requested again while pending, so that a process switch doesn't lose it)
+	if (HeapPolicy::collection_requested() or IncrementalMarking::is_complete() or HeapPolicy::should_collect_garbage())
+		HeapPolicy::request_collection();
 //  The following assertions break the tests
 //  assert(DeltaProcess::active()->last_delta_fp() not_eq nullptr, "last Delta fp should be present");
 //  assert(DeltaProcess::active()->last_delta_sp() not_eq nullptr, "last Delta fp should be present");
@@ -723,6 +738,41 @@ Oop *Universe::scavenge_and_allocate(std::int32_t size, Oop *p) {
 	return allocate_without_scavenge(size);
 }
 
+Oop *Universe::allocate_large(std::int32_t size, MemOop *p, bool permit_scavenge) {
+	st_unused(p); // unused
+
+	// large objects bypass the scavenges that would otherwise ask the heap policy; as those, only request
+	// the collection (the caller may hold raw pointers to old objects) and expand the old generation meanwhile
+	if (permit_scavenge and not HeapPolicy::collection_requested() and HeapPolicy::should_collect_garbage())
+		HeapPolicy::request_collection();
+	return old_gen.allocate_large(size);
+}
+
+void Universe::fill(Oop *start, Oop *end, bool clear_body) {
+	std::int32_t size = end - start;
+	if (size == 0)
+		return;
+
+	KlassOop k = objectArrayKlassObject();
+	std::int32_t ni_size = k->klass_part()->non_indexable_size();
+	bool is_array = size > ni_size;
+	if (not is_array) {
+		// too small for an array
+		k = memOopKlassObject();
+		ni_size = k->klass_part()->non_indexable_size();
+		st_assert(size == ni_size, "no filler object of this size");
+	}
+
+	MemOop obj = as_memOop(start);
+	obj->initialize_header(k->klass_part()->has_untagged_contents(), k);
+	obj->initialize_body(MemOopDescriptor::header_size(), ni_size);
+	if (is_array) {
+		start[ni_size] = smiOopFromValue(size - ni_size - 1);
+		if (clear_body)
+			obj->initialize_body(ni_size + 1, size);
+	}
+}
+
 void Universe::scavenge_oop(Oop *p) {
 	*p = (*p)->scavenge();
 }
@@ -751,6 +801,15 @@ void Universe::scavenge(Oop *p) {
 			SPDLOG_INFO(" {}", tenuring_threshold);
 		}
 
+		// eden is cleared at the end, so all buffers are given up
+		ThreadLocalAllocationBuffer::retire_all();
+
+		// the scavenge cleans the cards the incremental marking needs to see
+		if (IncrementalMarking::is_active())
+			IncrementalMarking::record_dirty_cards();
+
+		Pretenuring::begin_scavenge();
+
 		if (VerifyBeforeScavenge) {
 			verify();
 		}
@@ -758,9 +817,15 @@ void Universe::scavenge(Oop *p) {
 
 		// Getting ready for scavenge
 		age_table->clear();
+		RememberedSet::reset_statistics();
 
 		new_gen._toSpace->clear();
 
+		std::int32_t old_used = old_gen.used();
+		std::int32_t new_used = new_gen.eden()->used() + new_gen.from()->used();
+		ElapsedTimer pause;
+		pause.start();
+
 		// Save top of to_space and old_gen
 		NewWaterMark to_mark = new_gen._toSpace->top_mark();
 		OldWaterMark old_mark = old_gen.top_mark();
@@ -774,7 +839,8 @@ void Universe::scavenge(Oop *p) {
 		//Universe::roots_do(scavenge_oop);
 		//Handles::oops_do(scavenge_oop);
 
-		{
+		// with UseParallelScavenge, the recorded stores are shared by the workers
+		if (not UseParallelScavenge) {
 			FOR_EACH_OLD_SPACE(s) {
 				s->scavenge_recorded_stores();
 			}
@@ -783,10 +849,15 @@ void Universe::scavenge(Oop *p) {
 		Processes::scavenge_contents();
 		NotificationQueue::oops_do(&Universe::scavenge_oop);
 
+		if (UseParallelScavenge) {
+			ParallelScavenge::scavenge(&to_mark, &old_mark);
+		}
+
 		// Scavenge promoted contents in to_space and old_gen until done.
 
-		while ((old_mark not_eq old_gen.top_mark()) or (to_mark not_eq new_gen._toSpace->top_mark())) {
+		while ((old_mark not_eq old_gen.top_mark()) or (to_mark not_eq new_gen._toSpace->top_mark()) or old_gen.has_promoted()) {
 			old_gen.scavenge_contents_from(&old_mark);
+			old_gen.scavenge_promoted_contents();
 			new_gen._toSpace->scavenge_contents_from(&to_mark);
 		}
 
@@ -794,10 +865,22 @@ void Universe::scavenge(Oop *p) {
 
 		new_gen.swap_spaces();
 
+		pause.stop();
+		HeapPolicy::resize_new_generation(pause.seconds() * 1000.0, new_used, new_gen.from()->used());
+
 		// Set the desired survivor size to half the real survivor Space
 		std::int32_t desired_survivor_size = new_gen.to()->capacity() / 2;
 		tenuring_threshold = age_table->tenuring_threshold(desired_survivor_size / OOP_SIZE);
 
+		HeapPolicy::record_scavenge(old_used, old_gen.used());
+		Pretenuring::end_scavenge();
+
+		if (PrintScavenge) {
+			SPDLOG_INFO("scavenge: {:d} dirty cards, {:d} cards scanned", RememberedSet::cards_dirty(), RememberedSet::cards_scanned());
+		}
+
+		IncrementalMarking::step();
+
 		if (VerifyAfterScavenge) {
 			verify(true);
 		}
@@ -234,6 +234,9 @@ public:
 	// allocators
 	static Oop *allocate(std::int32_t size, MemOop *p = nullptr, bool permit_scavenge = true) {
 
+		if (is_large_object_size(size))
+			return allocate_large(size, p, permit_scavenge);
+
 		if (_scavenge_blocked and can_scavenge() and permit_scavenge)
 			return scavenge_and_allocate(size, (Oop *) p);
 
@@ -250,9 +253,23 @@ public:
 	}
 
 	static Oop *allocate_tenured(std::int32_t size, bool permit_expansion = true) {
+		if (is_large_object_size(size))
+			return old_gen.allocate_large(size, permit_expansion);
 		return old_gen.allocate(size, permit_expansion);
 	}
 
+	// Large objects (UseLargeObjectAllocation) are allocated in the old generation, at a page boundary,
+	// so that the scavenger never copies them and the pages of a dead one can be given back individually
+	static bool is_large_object_size(std::int32_t size) {
+		return UseLargeObjectAllocation and size >= LargeObjectThreshold * (1024 / OOP_SIZE);
+	}
+
+	static Oop *allocate_large(std::int32_t size, MemOop *p = nullptr, bool permit_scavenge = true);
+
+	// Fills [start..end[ with an unreferenced object, so that the space stays parsable;
+	// clear_body can be false if the words after the filler's header are valid oops already
+	static void fill(Oop *start, Oop *end, bool clear_body = true);
+
 	// Tells whether we should force a garbage collection
 	static bool needs_garbage_collection();
 
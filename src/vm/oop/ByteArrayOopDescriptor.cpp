@@ -137,33 +137,8 @@ static std::int32_t sub_sign(std::int32_t a, std::int32_t b) {
 	return 0;
 }
 
-std::int32_t compare_as_bytes(const std::uint8_t *a, const std::uint8_t *b) {
-	// machine dependent code; little endian code
-	if (a[0] - b[0])
-		return sub_sign(a[0], b[0]);
-	if (a[1] - b[1])
-		return sub_sign(a[1], b[1]);
-	if (a[2] - b[2])
-		return sub_sign(a[2], b[2]);
-
-	return sub_sign(a[3], b[3]);
-}
-
 std::int32_t ByteArrayOopDescriptor::compare(ByteArrayOop arg) {
-	// Get the addresses of the length fields
-	const std::uint32_t *a = (std::uint32_t *) length_addr();
-	const std::uint32_t *b = (std::uint32_t *) arg->length_addr();
-
-	// Get the word sizes of the arays
-	std::int32_t a_size = roundTo(SmallIntegerOop(*a++)->value() * sizeof(char), sizeof(std::int32_t)) / sizeof(std::int32_t);
-	std::int32_t b_size = roundTo(SmallIntegerOop(*b++)->value() * sizeof(char), sizeof(std::int32_t)) / sizeof(std::int32_t);
-
-	const std::uint32_t *a_end = a + min(a_size, b_size);
-	while (a < a_end) {
-		if (*b++ not_eq *a++)
-			return compare_as_bytes((const std::uint8_t *) (a - 1), (const std::uint8_t *) (b - 1));
-	}
-	return sub_sign(a_size, b_size);
+	return StringOps::compare(bytes(), length(), arg->bytes(), arg->length());
 }
 
 std::int32_t ByteArrayOopDescriptor::compare_doubleBytes(DoubleByteArrayOop arg) {
@@ -11,6 +11,7 @@
 #include "vm/runtime/Bootstrap.hpp"
 #include "vm/klass/Klass.hpp"
 #include "vm/utility/Integer.hpp"
+#include "vm/utility/StringOps.hpp"
 
 #include <cstring>
 
@@ -115,7 +116,7 @@ public:
 	}
 
 	bool equals(const char *name, std::size_t len) {
-		return len == length() and strncmp(chars(), name, len) == 0;
+		return len == length() and StringOps::equals(bytes(), (const std::uint8_t *) name, len);
 	}
 
 	bool equals(ByteArrayOop s) {
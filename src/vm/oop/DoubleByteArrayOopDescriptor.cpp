@@ -7,6 +7,7 @@
 #include "vm/klass/DoubleByteArrayKlass.hpp"
 #include "vm/oop/DoubleByteArrayOopDescriptor.hpp"
 #include "vm/runtime/ResourceArea.hpp"
+#include "vm/utility/StringOps.hpp"
 
 bool DoubleByteArrayOopDescriptor::verify() {
 	bool flag = MemOopDescriptor::verify();
@@ -30,39 +31,8 @@ void DoubleByteArrayOopDescriptor::bootstrap_object(Bootstrap *stream) {
 
 }
 
-static std::int32_t sub_sign(std::int32_t a, std::int32_t b) {
-	if (a < b)
-		return -1;
-
-	if (a > b)
-		return 1;
-
-	return 0;
-}
-
-std::int32_t compare_as_doubleBytes(const std::uint16_t *a, const std::uint16_t *b) {
-	// machine dependent code; little endian code
-	if (a[0] - b[0])
-		return sub_sign(a[0], b[0]);
-
-	return sub_sign(a[1], b[1]);
-}
-
 std::int32_t DoubleByteArrayOopDescriptor::compare(DoubleByteArrayOop arg) {
-	// Get the addresses of the length fields
-	const std::uint32_t *a = (const std::uint32_t *) length_addr();
-	const std::uint32_t *b = (const std::uint32_t *) arg->length_addr();
-
-	// Get the word sizes of the arays
-	std::int32_t a_size = roundTo(SmallIntegerOop(*a++)->value() * sizeof(std::uint16_t), sizeof(std::int32_t)) / sizeof(std::int32_t);
-	std::int32_t b_size = roundTo(SmallIntegerOop(*b++)->value() * sizeof(std::uint16_t), sizeof(std::int32_t)) / sizeof(std::int32_t);
-
-	const std::uint32_t *a_end = a + min(a_size, b_size);
-	while (a < a_end) {
-		if (*b++ not_eq *a++)
-			return compare_as_doubleBytes((const std::uint16_t *) (a - 1), (const std::uint16_t *) (b - 1));
-	}
-	return sub_sign(a_size, b_size);
+	return StringOps::compare(doubleBytes(), length(), arg->doubleBytes(), arg->length());
 }
 
 /*
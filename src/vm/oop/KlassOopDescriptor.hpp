@@ -64,4 +64,8 @@ public:
 	static std::int32_t nonIndexableSizeOffset() {
 		return (std::int32_t) (&KlassOop(nullptr)->klass_part()->_non_indexable_size);
 	}
+
+	static std::int32_t hasUntaggedContentsOffset() {
+		return (std::int32_t) (&KlassOop(nullptr)->klass_part()->_has_untagged_contents);
+	}
 };
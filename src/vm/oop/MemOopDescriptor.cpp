@@ -6,8 +6,10 @@
 #include "vm/oop/MemOopDescriptor.hpp"
 #include "vm/oop/KlassOopDescriptor.hpp"
 #include "vm/memory/AgeTable.hpp"
+#include "vm/memory/Pretenuring.hpp"
 #include "vm/memory/Closure.hpp"
 #include "vm/memory/MarkSweep.hpp"
+#include "vm/memory/ParallelScavenge.hpp"
 #include "vm/utility/ObjectIDTable.hpp"
 #include "vm/utility/StringOutputStream.hpp"
 #include "vm/utility/ConsoleOutputStream.hpp"
@@ -45,6 +47,9 @@ Oop MemOopDescriptor::scavenge() {
 	if (((const char *) this > Universe::old_gen._lowBoundary) or Universe::new_gen.to()->contains(this)) {
 		return this;
 	}
+	else if (ParallelScavenge::is_active()) {
+		return ParallelScavenge::copy(this);
+	}
 	else if (this->is_forwarded()) {
 		return Oop(this->forwardee());
 	}
@@ -80,6 +85,8 @@ Oop MemOopDescriptor::copy_to_survivor_space() {
 # ifdef VERBOSE_SCAVENGING
 		SPDLOG_INFO("{tenuring {} 0x{0:x} -> 0x{0:x} ({:d})}", blueprint()->name(), oops(), x, s);
 # endif
+		if (Pretenuring::is_sampling())
+			Pretenuring::record_promotion(p, s);
 	}
 	forward_to(p);
 	return p;
@@ -81,6 +81,10 @@ public:
 		set_mark(MarkOop(p));
 	}
 
+	MarkOop *mark_addr() const {
+		return &addr()->_mark;
+	}
+
 	Oop *klass_addr() const {
 		st_assert(addr() != nullptr, "MemOopDescriptor::klass_addr():  addr() returned nullptr");
 		return (Oop *) &addr()->_klass_field;
@@ -92,10 +92,16 @@ public:
 
     static bool uncommit_memory( const char *addr, std::int32_t size );
 
+    // Gives the pages of committed memory back to the OS; they read as zeros when touched again
+    static bool discard_memory( const char *addr, std::int32_t size );
+
     static bool release_memory( const char *addr, std::int32_t size );
 
     static bool guard_memory( const char *addr, std::int32_t size );
 
+    // Maps size bytes of the file at offset privately (copy on write) onto committed memory at addr
+    static bool map_memory( const char *addr, std::int32_t size, std::int32_t fd, std::int32_t offset );
+
     static const char *exec_memory( std::int32_t size );
 
     // OS interface to C memory routines - used for small allocations
@@ -278,7 +278,14 @@ bool os::commit_memory(const char *addr, std::int32_t size) {
 }
 
 bool os::uncommit_memory(const char *addr, std::int32_t size) {
-	return !mprotect(const_cast<char *>(addr), size, PROT_NONE);
+	// mapping fresh pages over the range gives the old ones back to the OS; mprotect alone would keep them
+	void *result = mmap(const_cast<char *>( addr ), size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_NORESERVE, -1, 0);
+	return result == (void *) addr;
+}
+
+bool os::discard_memory(const char *addr, std::int32_t size) {
+	void *result = mmap(const_cast<char *>( addr ), size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+	return result == (void *) addr;
 }
 
 bool os::release_memory(const char *addr, std::int32_t size) {
@@ -289,6 +296,11 @@ bool os::guard_memory(const char *addr, std::int32_t size) {
 	return false;
 }
 
+bool os::map_memory(const char *addr, std::int32_t size, std::int32_t fd, std::int32_t offset) {
+	void *result = mmap(const_cast<char *>( addr ), size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, offset);
+	return result == (void *) addr;
+}
+
 void *os::malloc(std::int32_t size) {
 	return ::malloc(size);
 }
@@ -19,6 +19,7 @@
 #include "vm/runtime/ResourceMark.hpp"
 #include "vm/platform/os.hpp"
 #include "vm/code/StubRoutines.hpp"
+#include "vm/utility/StringOps.hpp"
 
 TRACE_FUNC(TraceByteArrayPrims, "byteArray")
 
@@ -198,12 +199,89 @@ PRIM_DECL_2(ByteArrayPrimitives::at_all_put, Oop receiver, Oop value) {
 	if (v >= (1 << 8))
 		return markSymbol(vmSymbols::value_out_of_range());
 
-	std::size_t length = ByteArrayOop(receiver)->length();
+	StringOps::fill(ByteArrayOop(receiver)->bytes(), ByteArrayOop(receiver)->length(), v);
+	return receiver;
+}
+
+PRIM_DECL_3(ByteArrayPrimitives::indexOf, Oop receiver, Oop value, Oop start) {
+	PROLOGUE_3("indexOf", receiver, value, start);
+	ASSERT_RECEIVER;
+
+	// check argument types
+	if (not value->isSmallIntegerOop())
+		return markSymbol(vmSymbols::first_argument_has_wrong_type());
+
+	if (not start->isSmallIntegerOop())
+		return markSymbol(vmSymbols::second_argument_has_wrong_type());
+
+	// check value range (must be byte)
+	std::uint32_t v = (std::uint32_t) SmallIntegerOop(value)->value();
+	if (v >= (1 << 8))
+		return markSymbol(vmSymbols::value_out_of_range());
+
+	// the search may start just past the end
+	std::int32_t length = ByteArrayOop(receiver)->length();
+	std::int32_t s = SmallIntegerOop(start)->value();
+	if (s < 1 or s > length + 1)
+		return markSymbol(vmSymbols::out_of_bounds());
+
+	std::int32_t index = StringOps::index_of(ByteArrayOop(receiver)->bytes() + s - 1, length - s + 1, (std::uint8_t) v);
+	return smiOopFromValue(index < 0 ? 0 : s + index);
+}
+
+PRIM_DECL_3(ByteArrayPrimitives::indexOfBytes, Oop receiver, Oop pattern, Oop start) {
+	PROLOGUE_3("indexOfBytes", receiver, pattern, start);
+	ASSERT_RECEIVER;
 
-	for (std::size_t i = 1; i <= length; i++) {
-		ByteArrayOop(receiver)->byte_at_put(i, v);
-	}
+	// check argument types
+	if (not pattern->isByteArray())
+		return markSymbol(vmSymbols::first_argument_has_wrong_type());
+
+	if (not start->isSmallIntegerOop())
+		return markSymbol(vmSymbols::second_argument_has_wrong_type());
+
+	// the search may start just past the end
+	std::int32_t length = ByteArrayOop(receiver)->length();
+	std::int32_t s = SmallIntegerOop(start)->value();
+	if (s < 1 or s > length + 1)
+		return markSymbol(vmSymbols::out_of_bounds());
+
+	std::int32_t index = StringOps::index_of(ByteArrayOop(receiver)->bytes() + s - 1, length - s + 1, ByteArrayOop(pattern)->bytes(), ByteArrayOop(pattern)->length());
+	return smiOopFromValue(index < 0 ? 0 : s + index);
+}
+
+PRIM_DECL_5(ByteArrayPrimitives::replaceFromTo, Oop receiver, Oop from, Oop to, Oop source, Oop start) {
+	PROLOGUE_5("replaceFromTo", receiver, from, to, source, start);
+	ASSERT_RECEIVER;
+
+	// check argument types
+	if (not from->isSmallIntegerOop())
+		return markSymbol(vmSymbols::first_argument_has_wrong_type());
+
+	if (not to->isSmallIntegerOop())
+		return markSymbol(vmSymbols::second_argument_has_wrong_type());
+
+	if (not source->isByteArray())
+		return markSymbol(vmSymbols::third_argument_has_wrong_type());
+
+	if (not start->isSmallIntegerOop())
+		return markSymbol(vmSymbols::fourth_argument_has_wrong_type());
+
+	// check ranges; an empty range (to = from - 1) is allowed
+	std::int32_t f = SmallIntegerOop(from)->value();
+	std::int32_t t = SmallIntegerOop(to)->value();
+	std::int32_t s = SmallIntegerOop(start)->value();
+	std::int32_t count = t - f + 1;
+	std::int32_t length = ByteArrayOop(receiver)->length();
+	std::int32_t sourceLength = ByteArrayOop(source)->length();
+	if (f < 1 or count < 0 or t > length)
+		return markSymbol(vmSymbols::out_of_bounds());
+
+	if (s < 1 or s + count - 1 > sourceLength)
+		return markSymbol(vmSymbols::out_of_bounds());
 
+	// source and receiver may be the same object
+	memmove(ByteArrayOop(receiver)->bytes() + f - 1, ByteArrayOop(source)->bytes() + s - 1, count);
 	return receiver;
 }
 
@@ -117,6 +117,41 @@ public:
 	//%
 	static PRIM_DECL_2(at_all_put, Oop receiver, Oop c);
 
+	//%prim
+	// <IndexedByteInstanceVariables>
+	//   primitiveIndexedByteIndexOf: c         <SmallInteger>
+	//                    startingAt: start     <SmallInteger>
+	//                        ifFail: failBlock <PrimFailBlock> ^<SmallInteger> =
+	//   Internal { error = #(OutOfBounds ValueOutOfBounds)
+	//              flags = #(Function)
+	//              name  = 'ByteArrayPrimitives::indexOf' }
+	//%
+	static PRIM_DECL_3(indexOf, Oop receiver, Oop c, Oop start);
+
+	//%prim
+	// <IndexedByteInstanceVariables>
+	//   primitiveIndexedByteIndexOfBytes: pattern   <IndexedByteInstanceVariables>
+	//                         startingAt: start     <SmallInteger>
+	//                             ifFail: failBlock <PrimFailBlock> ^<SmallInteger> =
+	//   Internal { error = #(OutOfBounds)
+	//              flags = #(Function)
+	//              name  = 'ByteArrayPrimitives::indexOfBytes' }
+	//%
+	static PRIM_DECL_3(indexOfBytes, Oop receiver, Oop pattern, Oop start);
+
+	//%prim
+	// <IndexedByteInstanceVariables>
+	//   primitiveIndexedByteReplaceFrom: from      <SmallInteger>
+	//                                to: to        <SmallInteger>
+	//                              with: source    <IndexedByteInstanceVariables>
+	//                        startingAt: start     <SmallInteger>
+	//                            ifFail: failBlock <PrimFailBlock> ^<Self> =
+	//   Internal { error = #(OutOfBounds)
+	//              flags = #(Function)
+	//              name  = 'ByteArrayPrimitives::replaceFromTo' }
+	//%
+	static PRIM_DECL_5(replaceFromTo, Oop receiver, Oop from, Oop to, Oop source, Oop start);
+
 
 	// SUPPORT FOR LARGE INTEGER
 
@@ -11,6 +11,7 @@
 #include "vm/oop/DoubleByteArrayOopDescriptor.hpp"
 #include "vm/runtime/ResourceMark.hpp"
 #include "vm/memory/SymbolTable.hpp"
+#include "vm/utility/StringOps.hpp"
 //#include "<cfloat>
 
 TRACE_FUNC(TraceDoubleByteArrayPrims, "doubleByteArray")
@@ -149,13 +150,8 @@ PRIM_DECL_1(DoubleByteArrayPrimitives::intern, Oop receiver) {
 	std::int32_t len = DoubleByteArrayOop(receiver)->length();
 	char *buffer = new_resource_array<char>(len);
 
-	for (std::size_t i = 0; i < len; i++) {
-		std::int32_t c = DoubleByteArrayOop(receiver)->doubleByte_at(i + 1);
-		if (c >= (1 << 8)) {
-			return markSymbol(vmSymbols::value_out_of_range());
-		}
-		buffer[i] = c;
-	}
+	if (not StringOps::narrow((std::uint8_t *) buffer, DoubleByteArrayOop(receiver)->doubleBytes(), len))
+		return markSymbol(vmSymbols::value_out_of_range());
 
 	SymbolOop sym = Universe::symbol_table->lookup(buffer, len);
 	return sym;
@@ -189,3 +185,46 @@ PRIM_DECL_1(DoubleByteArrayPrimitives::hash, Oop receiver) {
 	ASSERT_RECEIVER;
 	return smiOopFromValue(DoubleByteArrayOop(receiver)->hash_value());
 }
+
+PRIM_DECL_2(DoubleByteArrayPrimitives::at_all_put, Oop receiver, Oop value) {
+	PROLOGUE_2("at_all_put", receiver, value);
+	ASSERT_RECEIVER;
+
+	// check value type
+	if (not value->isSmallIntegerOop())
+		return markSymbol(vmSymbols::first_argument_has_wrong_type());
+
+	// check value as double byte
+	std::uint32_t v = (std::uint32_t) SmallIntegerOop(value)->value();
+	if (v >= (1 << 16))
+		return markSymbol(vmSymbols::value_out_of_range());
+
+	StringOps::fill(DoubleByteArrayOop(receiver)->doubleBytes(), DoubleByteArrayOop(receiver)->length(), v);
+	return receiver;
+}
+
+PRIM_DECL_3(DoubleByteArrayPrimitives::indexOf, Oop receiver, Oop value, Oop start) {
+	PROLOGUE_3("indexOf", receiver, value, start);
+	ASSERT_RECEIVER;
+
+	// check argument types
+	if (not value->isSmallIntegerOop())
+		return markSymbol(vmSymbols::first_argument_has_wrong_type());
+
+	if (not start->isSmallIntegerOop())
+		return markSymbol(vmSymbols::second_argument_has_wrong_type());
+
+	// check value as double byte
+	std::uint32_t v = (std::uint32_t) SmallIntegerOop(value)->value();
+	if (v >= (1 << 16))
+		return markSymbol(vmSymbols::value_out_of_range());
+
+	// the search may start just past the end
+	std::int32_t length = DoubleByteArrayOop(receiver)->length();
+	std::int32_t s = SmallIntegerOop(start)->value();
+	if (s < 1 or s > length + 1)
+		return markSymbol(vmSymbols::out_of_bounds());
+
+	std::int32_t index = StringOps::index_of(DoubleByteArrayOop(receiver)->doubleBytes() + s - 1, length - s + 1, v);
+	return smiOopFromValue(index < 0 ? 0 : s + index);
+}
@@ -106,4 +106,25 @@ public:
     //   Internal { name  = 'DoubleByteArrayPrimitives::hash' }
     //%
     static PRIM_DECL_1( hash, Oop receiver );
+
+    //%prim
+    // <IndexedDoubleByteInstanceVariables>
+    //   primitiveIndexedDoubleByteAtAllPut: c         <SmallInteger>
+    //                               ifFail: failBlock <PrimFailBlock> ^<Self> =
+    //   Internal { error = #(ValueOutOfBounds)
+    //              flags = #(Function)
+    //              name  = 'DoubleByteArrayPrimitives::at_all_put' }
+    //%
+    static PRIM_DECL_2( at_all_put, Oop receiver, Oop c );
+
+    //%prim
+    // <IndexedDoubleByteInstanceVariables>
+    //   primitiveIndexedDoubleByteIndexOf: c         <SmallInteger>
+    //                          startingAt: start     <SmallInteger>
+    //                              ifFail: failBlock <PrimFailBlock> ^<SmallInteger> =
+    //   Internal { error = #(OutOfBounds ValueOutOfBounds)
+    //              flags = #(Function)
+    //              name  = 'DoubleByteArrayPrimitives::indexOf' }
+    //%
+    static PRIM_DECL_3( indexOf, Oop receiver, Oop c, Oop start );
 };
@@ -10,6 +10,10 @@
 #include "vm/oop/DoubleOopDescriptor.hpp"
 #include "vm/memory/OopFactory.hpp"
 
+#include <cmath>
+#include <cstring>
+#include <emmintrin.h>
+
 TRACE_FUNC(TraceDoubleValueArrayPrims, "doubleValueArray")
 
 std::int32_t DoubleValueArrayPrimitives::number_of_calls;
@@ -88,3 +92,326 @@ PRIM_DECL_3(DoubleValueArrayPrimitives::atPut, Oop receiver, Oop index, Oop valu
 	DoubleValueArrayOop(receiver)->double_at_put(SmallIntegerOop(index)->value(), DoubleOop(value)->value());
 	return receiver;
 }
+
+
+// Kernels for the bulk operations
+//
+// The SSE2 versions work on two doubles at a time (the elements are only 4 byte aligned, hence
+// the unaligned loads and stores); the scalar versions are used when UseSSE2 is off and for the
+// last odd element. Reductions keep two partial results, so the result may differ from a
+// sequential loop in the last bits.
+
+__attribute__((target("sse2")))
+static void sse2_add(double *x, const double *y, std::int32_t n) {
+	std::int32_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		_mm_storeu_pd(&x[i], _mm_add_pd(_mm_loadu_pd(&x[i]), _mm_loadu_pd(&y[i])));
+	}
+	for (; i < n; i++) {
+		x[i] += y[i];
+	}
+}
+
+__attribute__((target("sse2")))
+static void sse2_multiply(double *x, const double *y, std::int32_t n) {
+	std::int32_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		_mm_storeu_pd(&x[i], _mm_mul_pd(_mm_loadu_pd(&x[i]), _mm_loadu_pd(&y[i])));
+	}
+	for (; i < n; i++) {
+		x[i] *= y[i];
+	}
+}
+
+__attribute__((target("sse2")))
+static void sse2_scale(double *x, double factor, std::int32_t n) {
+	__m128d f = _mm_set1_pd(factor);
+	std::int32_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		_mm_storeu_pd(&x[i], _mm_mul_pd(_mm_loadu_pd(&x[i]), f));
+	}
+	for (; i < n; i++) {
+		x[i] *= factor;
+	}
+}
+
+__attribute__((target("sse2")))
+static double sse2_dot(const double *x, const double *y, std::int32_t n) {
+	__m128d acc = _mm_setzero_pd();
+	std::int32_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		acc = _mm_add_pd(acc, _mm_mul_pd(_mm_loadu_pd(&x[i]), _mm_loadu_pd(&y[i])));
+	}
+	double partial[2];
+	_mm_storeu_pd(partial, acc);
+	double result = partial[0] + partial[1];
+	for (; i < n; i++) {
+		result += x[i] * y[i];
+	}
+	return result;
+}
+
+__attribute__((target("sse2")))
+static double sse2_sum(const double *x, std::int32_t n) {
+	__m128d acc = _mm_setzero_pd();
+	std::int32_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		acc = _mm_add_pd(acc, _mm_loadu_pd(&x[i]));
+	}
+	double partial[2];
+	_mm_storeu_pd(partial, acc);
+	double result = partial[0] + partial[1];
+	for (; i < n; i++) {
+		result += x[i];
+	}
+	return result;
+}
+
+// NaNs are ignored by min and max; the answer is only NaN if all elements are
+static inline double min_max_step(double result, double x, bool is_min) {
+	return std::isnan(result) or (is_min ? x < result : x > result) ? x : result;
+}
+
+__attribute__((target("sse2")))
+static double sse2_min_max(const double *x, std::int32_t n, bool is_min) {
+	st_assert(n > 0, "empty array");
+	if (n < 2)
+		return x[0];
+	__m128d acc = _mm_loadu_pd(x);
+	std::int32_t i = 2;
+	for (; i + 2 <= n; i += 2) {
+		__m128d v = _mm_loadu_pd(&x[i]);
+		// minpd/maxpd answer their second operand if either one is NaN: this skips a NaN in v,
+		// and a lane of acc that is still NaN takes v
+		__m128d r = is_min ? _mm_min_pd(v, acc) : _mm_max_pd(v, acc);
+		__m128d nan = _mm_cmpunord_pd(acc, acc);
+		acc = _mm_or_pd(_mm_and_pd(nan, v), _mm_andnot_pd(nan, r));
+	}
+	double partial[2];
+	_mm_storeu_pd(partial, acc);
+	double result = min_max_step(partial[0], partial[1], is_min);
+	for (; i < n; i++) {
+		result = min_max_step(result, x[i], is_min);
+	}
+	return result;
+}
+
+static void add_kernel(double *x, const double *y, std::int32_t n) {
+	if (UseSSE2) {
+		sse2_add(x, y, n);
+		return;
+	}
+	for (std::int32_t i = 0; i < n; i++) {
+		x[i] += y[i];
+	}
+}
+
+static void multiply_kernel(double *x, const double *y, std::int32_t n) {
+	if (UseSSE2) {
+		sse2_multiply(x, y, n);
+		return;
+	}
+	for (std::int32_t i = 0; i < n; i++) {
+		x[i] *= y[i];
+	}
+}
+
+static void scale_kernel(double *x, double factor, std::int32_t n) {
+	if (UseSSE2) {
+		sse2_scale(x, factor, n);
+		return;
+	}
+	for (std::int32_t i = 0; i < n; i++) {
+		x[i] *= factor;
+	}
+}
+
+static double dot_kernel(const double *x, const double *y, std::int32_t n) {
+	if (UseSSE2)
+		return sse2_dot(x, y, n);
+	double result = 0.0;
+	for (std::int32_t i = 0; i < n; i++) {
+		result += x[i] * y[i];
+	}
+	return result;
+}
+
+static double sum_kernel(const double *x, std::int32_t n) {
+	if (UseSSE2)
+		return sse2_sum(x, n);
+	double result = 0.0;
+	for (std::int32_t i = 0; i < n; i++) {
+		result += x[i];
+	}
+	return result;
+}
+
+static double min_max_kernel(const double *x, std::int32_t n, bool is_min) {
+	if (UseSSE2)
+		return sse2_min_max(x, n, is_min);
+	double result = x[0];
+	for (std::int32_t i = 1; i < n; i++) {
+		result = min_max_step(result, x[i], is_min);
+	}
+	return result;
+}
+
+
+PRIM_DECL_2(DoubleValueArrayPrimitives::add, Oop receiver, Oop other) {
+	PROLOGUE_2("add", receiver, other);
+	ASSERT_RECEIVER;
+
+	// check argument type
+	if (not other->isDoubleValueArray())
+		return markSymbol(vmSymbols::first_argument_has_wrong_type());
+
+	// check sizes
+	if (DoubleValueArrayOop(other)->length() not_eq DoubleValueArrayOop(receiver)->length())
+		return markSymbol(vmSymbols::argument_is_invalid());
+
+	// do the operation
+	add_kernel(DoubleValueArrayOop(receiver)->double_start(), DoubleValueArrayOop(other)->double_start(), DoubleValueArrayOop(receiver)->length());
+	return receiver;
+}
+
+PRIM_DECL_2(DoubleValueArrayPrimitives::multiply, Oop receiver, Oop other) {
+	PROLOGUE_2("multiply", receiver, other);
+	ASSERT_RECEIVER;
+
+	// check argument type
+	if (not other->isDoubleValueArray())
+		return markSymbol(vmSymbols::first_argument_has_wrong_type());
+
+	// check sizes
+	if (DoubleValueArrayOop(other)->length() not_eq DoubleValueArrayOop(receiver)->length())
+		return markSymbol(vmSymbols::argument_is_invalid());
+
+	// do the operation
+	multiply_kernel(DoubleValueArrayOop(receiver)->double_start(), DoubleValueArrayOop(other)->double_start(), DoubleValueArrayOop(receiver)->length());
+	return receiver;
+}
+
+PRIM_DECL_2(DoubleValueArrayPrimitives::scale, Oop receiver, Oop factor) {
+	PROLOGUE_2("scale", receiver, factor);
+	ASSERT_RECEIVER;
+
+	// check argument type
+	if (not factor->isDouble())
+		return markSymbol(vmSymbols::first_argument_has_wrong_type());
+
+	// do the operation
+	scale_kernel(DoubleValueArrayOop(receiver)->double_start(), DoubleOop(factor)->value(), DoubleValueArrayOop(receiver)->length());
+	return receiver;
+}
+
+PRIM_DECL_2(DoubleValueArrayPrimitives::dot, Oop receiver, Oop other) {
+	PROLOGUE_2("dot", receiver, other);
+	ASSERT_RECEIVER;
+
+	// check argument type
+	if (not other->isDoubleValueArray())
+		return markSymbol(vmSymbols::first_argument_has_wrong_type());
+
+	// check sizes
+	if (DoubleValueArrayOop(other)->length() not_eq DoubleValueArrayOop(receiver)->length())
+		return markSymbol(vmSymbols::argument_is_invalid());
+
+	// do the operation (before allocating the result)
+	double result = dot_kernel(DoubleValueArrayOop(receiver)->double_start(), DoubleValueArrayOop(other)->double_start(), DoubleValueArrayOop(receiver)->length());
+	return OopFactory::new_double(result);
+}
+
+PRIM_DECL_1(DoubleValueArrayPrimitives::sum, Oop receiver) {
+	PROLOGUE_1("sum", receiver);
+	ASSERT_RECEIVER;
+
+	double result = sum_kernel(DoubleValueArrayOop(receiver)->double_start(), DoubleValueArrayOop(receiver)->length());
+	return OopFactory::new_double(result);
+}
+
+PRIM_DECL_1(DoubleValueArrayPrimitives::min, Oop receiver) {
+	PROLOGUE_1("min", receiver);
+	ASSERT_RECEIVER;
+
+	if (DoubleValueArrayOop(receiver)->length() == 0)
+		return markSymbol(vmSymbols::out_of_bounds());
+
+	double result = min_max_kernel(DoubleValueArrayOop(receiver)->double_start(), DoubleValueArrayOop(receiver)->length(), true);
+	return OopFactory::new_double(result);
+}
+
+PRIM_DECL_1(DoubleValueArrayPrimitives::max, Oop receiver) {
+	PROLOGUE_1("max", receiver);
+	ASSERT_RECEIVER;
+
+	if (DoubleValueArrayOop(receiver)->length() == 0)
+		return markSymbol(vmSymbols::out_of_bounds());
+
+	double result = min_max_kernel(DoubleValueArrayOop(receiver)->double_start(), DoubleValueArrayOop(receiver)->length(), false);
+	return OopFactory::new_double(result);
+}
+
+PRIM_DECL_4(DoubleValueArrayPrimitives::from_to_put, Oop receiver, Oop from, Oop to, Oop value) {
+	PROLOGUE_4("from_to_put", receiver, from, to, value);
+	ASSERT_RECEIVER;
+
+	// check from type
+	if (not from->isSmallIntegerOop())
+		return markSymbol(vmSymbols::first_argument_has_wrong_type());
+
+	// check to type
+	if (not to->isSmallIntegerOop())
+		return markSymbol(vmSymbols::second_argument_has_wrong_type());
+
+	// check value type
+	if (not value->isDouble())
+		return markSymbol(vmSymbols::third_argument_has_wrong_type());
+
+	// check range (an empty range, i.e. to = from - 1, is allowed)
+	std::int32_t f = SmallIntegerOop(from)->value();
+	std::int32_t t = SmallIntegerOop(to)->value();
+	if (f < 1 or t > DoubleValueArrayOop(receiver)->length() or f > t + 1)
+		return markSymbol(vmSymbols::out_of_bounds());
+
+	// do the operation
+	double v = DoubleOop(value)->value();
+	double *x = DoubleValueArrayOop(receiver)->double_start();
+	for (std::int32_t i = f - 1; i < t; i++) {
+		x[i] = v;
+	}
+	return receiver;
+}
+
+PRIM_DECL_5(DoubleValueArrayPrimitives::replace_from_to, Oop receiver, Oop from, Oop to, Oop source, Oop start) {
+	PROLOGUE_5("replace_from_to", receiver, from, to, source, start);
+	ASSERT_RECEIVER;
+
+	// check from type
+	if (not from->isSmallIntegerOop())
+		return markSymbol(vmSymbols::first_argument_has_wrong_type());
+
+	// check to type
+	if (not to->isSmallIntegerOop())
+		return markSymbol(vmSymbols::second_argument_has_wrong_type());
+
+	// check source type
+	if (not source->isDoubleValueArray())
+		return markSymbol(vmSymbols::third_argument_has_wrong_type());
+
+	// check start type
+	if (not start->isSmallIntegerOop())
+		return markSymbol(vmSymbols::fourth_argument_has_wrong_type());
+
+	// check ranges (an empty range, i.e. to = from - 1, is allowed)
+	std::int32_t f = SmallIntegerOop(from)->value();
+	std::int32_t t = SmallIntegerOop(to)->value();
+	std::int32_t s = SmallIntegerOop(start)->value();
+	if (f < 1 or t > DoubleValueArrayOop(receiver)->length() or f > t + 1)
+		return markSymbol(vmSymbols::out_of_bounds());
+	if (s < 1 or s + (t - f) > DoubleValueArrayOop(source)->length())
+		return markSymbol(vmSymbols::out_of_bounds());
+
+	// do the operation (source and receiver may be the same array)
+	std::memmove(DoubleValueArrayOop(receiver)->double_start() + (f - 1), DoubleValueArrayOop(source)->double_start() + (s - 1), (t - f + 1) * sizeof(double));
+	return receiver;
+}
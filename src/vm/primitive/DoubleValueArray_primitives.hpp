@@ -62,4 +62,98 @@ public:
     //%
     static PRIM_DECL_3( atPut, Oop receiver, Oop index, Oop value );
 
+    // Bulk operations
+    // They work on the unboxed elements and don't allocate, except for the Float result of
+    // the reductions. The kernels use SSE2 if UseSSE2 is set.
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueAdd: other     <IndexedFloatValueInstanceVariables>
+    //                          ifFail: failBlock <PrimFailBlock> ^<Self> =
+    //   Internal { error = #(ArgumentIsInvalid)
+    //              flags = #(Function IndexedFloatValue)
+    //              name  = 'DoubleValueArrayPrimitives::add' }
+    //%
+    static PRIM_DECL_2( add, Oop receiver, Oop other );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueMultiply: other     <IndexedFloatValueInstanceVariables>
+    //                               ifFail: failBlock <PrimFailBlock> ^<Self> =
+    //   Internal { error = #(ArgumentIsInvalid)
+    //              flags = #(Function IndexedFloatValue)
+    //              name  = 'DoubleValueArrayPrimitives::multiply' }
+    //%
+    static PRIM_DECL_2( multiply, Oop receiver, Oop other );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueScale: factor    <Float>
+    //                            ifFail: failBlock <PrimFailBlock> ^<Self> =
+    //   Internal { flags = #(Function IndexedFloatValue)
+    //              name  = 'DoubleValueArrayPrimitives::scale' }
+    //%
+    static PRIM_DECL_2( scale, Oop receiver, Oop factor );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueDot: other     <IndexedFloatValueInstanceVariables>
+    //                          ifFail: failBlock <PrimFailBlock> ^<Float> =
+    //   Internal { error = #(ArgumentIsInvalid)
+    //              flags = #(Allocate IndexedFloatValue)
+    //              name  = 'DoubleValueArrayPrimitives::dot' }
+    //%
+    static PRIM_DECL_2( dot, Oop receiver, Oop other );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueSum ^<Float> =
+    //   Internal { flags = #(Allocate IndexedFloatValue)
+    //              name  = 'DoubleValueArrayPrimitives::sum' }
+    //%
+    static PRIM_DECL_1( sum, Oop receiver );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueMinIfFail: failBlock <PrimFailBlock> ^<Float> =
+    //   Internal { error = #(OutOfBounds)
+    //              flags = #(Allocate IndexedFloatValue)
+    //              name  = 'DoubleValueArrayPrimitives::min' }
+    //%
+    static PRIM_DECL_1( min, Oop receiver );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueMaxIfFail: failBlock <PrimFailBlock> ^<Float> =
+    //   Internal { error = #(OutOfBounds)
+    //              flags = #(Allocate IndexedFloatValue)
+    //              name  = 'DoubleValueArrayPrimitives::max' }
+    //%
+    static PRIM_DECL_1( max, Oop receiver );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueFrom: from      <SmallInteger>
+    //                               to: to        <SmallInteger>
+    //                              put: value     <Float>
+    //                           ifFail: failBlock <PrimFailBlock> ^<Self> =
+    //   Internal { error = #(OutOfBounds)
+    //              flags = #(Function IndexedFloatValue)
+    //              name  = 'DoubleValueArrayPrimitives::from_to_put' }
+    //%
+    static PRIM_DECL_4( from_to_put, Oop receiver, Oop from, Oop to, Oop value );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueReplaceFrom: from      <SmallInteger>
+    //                                      to: to        <SmallInteger>
+    //                                    with: source    <IndexedFloatValueInstanceVariables>
+    //                              startingAt: start     <SmallInteger>
+    //                                  ifFail: failBlock <PrimFailBlock> ^<Self> =
+    //   Internal { error = #(OutOfBounds)
+    //              flags = #(Function IndexedFloatValue)
+    //              name  = 'DoubleValueArrayPrimitives::replace_from_to' }
+    //%
+    static PRIM_DECL_5( replace_from_to, Oop receiver, Oop from, Oop to, Oop source, Oop start );
+
 };
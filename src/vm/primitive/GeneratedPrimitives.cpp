@@ -12,6 +12,7 @@
 #include "vm/platform/os.hpp"
 #include "vm/utility/OutputStream.hpp"
 #include "vm/runtime/ResourceMark.hpp"
+#include "vm/memory/ThreadLocalAllocationBuffer.hpp"
 #include "PrimitivesGenerator.hpp"
 
 
@@ -41,7 +42,7 @@ std::array<const char *, 10>GeneratedPrimitives::_allocateBlock;
 std::array<const char *, 3> GeneratedPrimitives::_allocateContext;
 const char *GeneratedPrimitives::_primitiveInlineAllocations = nullptr;
 
-extern "C" void scavenge_and_allocate(std::int32_t size);
+extern "C" Oop *scavenge_and_allocate(std::int32_t size);
 
 
 // -----------------------------------------------------------------------------
@@ -58,11 +59,11 @@ void PrimitivesGenerator::scavenge(std::int32_t size) {
 }
 
 void PrimitivesGenerator::test_for_scavenge(Register dst, std::int32_t size, Label &need_scavenge) {
-	masm->movl(dst, Address((std::int32_t) &eden_top, RelocationInformation::RelocationType::external_word_type));
+	masm->movl(dst, Address((std::int32_t) &tlab_top, RelocationInformation::RelocationType::external_word_type));
 	masm->addl(dst, size);
-	masm->cmpl(dst, Address((std::int32_t) &eden_end, RelocationInformation::RelocationType::external_word_type));
+	masm->cmpl(dst, Address((std::int32_t) &tlab_end, RelocationInformation::RelocationType::external_word_type));
 	masm->jcc(Assembler::Condition::greater, need_scavenge);
-	masm->movl(Address((std::int32_t) &eden_top, RelocationInformation::RelocationType::external_word_type), dst);
+	masm->movl(Address((std::int32_t) &tlab_top, RelocationInformation::RelocationType::external_word_type), dst);
 }
 
 void PrimitivesGenerator::error_jumps() {
@@ -304,6 +305,8 @@ void generatedPrimitives_init_after_interpreter() {
 
 #include "vm/primitive/BehaviorPrimitives.hpp"
 #include "vm/primitive/PrimitivesGenerator.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/klass/Klass.hpp"
 
 static bool stop = false;
 
@@ -316,6 +319,13 @@ const char *PrimitivesGenerator::primitiveNew(std::int32_t n) {
 
 	const char *entry_point = masm->pc();
 
+	// the instances of a pretenured class are allocated by the allocation primitives
+	// (the klass bits are always a smi, see Klass::bits)
+	masm->movl(ebx, klass_addr);
+	masm->movl(ebx, Address(ebx, KlassOopDescriptor::hasUntaggedContentsOffset()));
+	masm->testl(ebx, std::int32_t(smiOopFromValue(Klass::pretenured_bit)));
+	masm->jcc(Assembler::Condition::notZero, allocation_failure);
+
 	test_for_scavenge(eax, size * OOP_SIZE, allocation_failure);
 	Address _stop = Address((std::int32_t) &stop, RelocationInformation::RelocationType::external_word_type);
 	Label _break, no_break;
@@ -695,7 +705,7 @@ const char *PrimitivesGenerator::smiOopPrimitives_remainder() {
 	return entry_point;
 }
 
-extern "C" void scavenge_and_allocate(std::int32_t size);
+extern "C" Oop *scavenge_and_allocate(std::int32_t size);
 
 
 // -----------------------------------------------------------------------------
@@ -9,6 +9,7 @@
 #include "vm/assembler/Label.hpp"
 #include "vm/assembler/Address.hpp"
 #include "vm/primitive/PrimitivesGenerator.hpp"
+#include "vm/memory/ThreadLocalAllocationBuffer.hpp"
 
 const char *PrimitivesGenerator::allocateBlock(std::int32_t n) {
 
@@ -75,7 +76,7 @@ const char *PrimitivesGenerator::allocateBlock(std::int32_t n) {
 	return entry_point;
 }
 
-extern "C" void scavenge_and_allocate(std::int32_t size);
+extern "C" Oop *scavenge_and_allocate(std::int32_t size);
 
 const char *PrimitivesGenerator::allocateContext_var() {
 
@@ -85,14 +86,14 @@ const char *PrimitivesGenerator::allocateContext_var() {
 	const char *entry_point = masm->pc();
 
 	masm->movl(ecx, Address(esp, +OOP_SIZE));    // load length  (remember this is a SmallIntegerOop)
-	masm->movl(eax, Address((std::int32_t) &eden_top, RelocationInformation::RelocationType::external_word_type));
+	masm->movl(eax, Address((std::int32_t) &tlab_top, RelocationInformation::RelocationType::external_word_type));
 	masm->movl(edx, ecx);
 	masm->addl(edx, 3 * OOP_SIZE);
 	masm->addl(edx, eax);
 // Equals? ==>  masm->leal(edx, Address(ecx, eax, Address::times_1, 3*OOP_SIZE));
-	masm->cmpl(edx, Address((std::int32_t) &eden_end, RelocationInformation::RelocationType::external_word_type));
+	masm->cmpl(edx, Address((std::int32_t) &tlab_end, RelocationInformation::RelocationType::external_word_type));
 	masm->jcc(Assembler::Condition::greater, need_scavenge);
-	masm->movl(Address((std::int32_t) &eden_top, RelocationInformation::RelocationType::external_word_type), edx);
+	masm->movl(Address((std::int32_t) &tlab_top, RelocationInformation::RelocationType::external_word_type), edx);
 
 	masm->bind(fill_object);
 	masm->movl(ebx, contextKlass_addr());
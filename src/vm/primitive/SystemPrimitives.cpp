@@ -260,8 +260,18 @@ PRIM_DECL_0(SystemPrimitives::elapsedTime) {
 
 PRIM_DECL_1(SystemPrimitives::writeSnapshot, Oop fileName) {
 	PROLOGUE_1("writeSnapshot", fileName);
+	if (not fileName->isByteArray())
+		return markSymbol(vmSymbols::first_argument_has_wrong_type());
+
+	// Only the old generation is written; a full collection empties the new generation
+	Oop name_oop = fileName;
+	VM_GarbageCollect op(&name_oop);
+	VMProcess::execute(&op);
+	fileName = name_oop;
+
+	ResourceMark resourceMark;
+	const char *name = ByteArrayOop(fileName)->copy_null_terminated();
 	SnapshotDescriptor sd;
-	const char *name = "fisk.snap";
 	sd.write_on(name);
 	if (sd.has_error())
 		return markSymbol(sd.error_symbol());
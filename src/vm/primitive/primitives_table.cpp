@@ -1230,1444 +1230,1528 @@ static PrimitiveDescriptor primitive_198 = {
 		"primitiveIndexedByteHash", primitiveFunctionType(&ByteArrayPrimitives::hash), 1574401, signature_198, errors_198
 };
 
-static const char *signature_199[] = {"CompressedSymbol", "IndexedByteInstanceVariables"};
-static const char *errors_199[] = {"ValueOutOfBounds", nullptr};
+static const char *signature_199[] = {"SmallInteger", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger"};
+static const char *errors_199[] = {"OutOfBounds", "ValueOutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_199 = {
-		"primitiveIndexedByteInternIfFail:", primitiveFunctionType(&ByteArrayPrimitives::intern), 1376257, signature_199, errors_199
+		"primitiveIndexedByteIndexOf:startingAt:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::indexOf), 1310723, signature_199, errors_199
 };
 
-static const char *signature_200[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
-static const char *errors_200[] = {"ArgumentIsInvalid", nullptr};
+static const char *signature_200[] = {"SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "SmallInteger"};
+static const char *errors_200[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_200 = {
-		"primitiveIndexedByteLargeIntegerAdd:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerAdd), 1312258, signature_200, errors_200
+		"primitiveIndexedByteIndexOfBytes:startingAt:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::indexOfBytes), 1310723, signature_200, errors_200
 };
 
-static const char *signature_201[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
-static const char *errors_201[] = {"ArgumentIsInvalid", "DivisionByZero", nullptr};
+static const char *signature_201[] = {"CompressedSymbol", "IndexedByteInstanceVariables"};
+static const char *errors_201[] = {"ValueOutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_201 = {
-		"primitiveIndexedByteLargeIntegerAnd:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerAnd), 1312258, signature_201, errors_201
+		"primitiveIndexedByteInternIfFail:", primitiveFunctionType(&ByteArrayPrimitives::intern), 1376257, signature_201, errors_201
 };
 
-static const char *signature_202[] = {"Float", "IndexedByteInstanceVariables"};
-static const char *errors_202[] = {nullptr};
+static const char *signature_202[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
+static const char *errors_202[] = {"ArgumentIsInvalid", nullptr};
 static PrimitiveDescriptor primitive_202 = {
-		"primitiveIndexedByteLargeIntegerAsFloatIfFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerToFloat), 1312257, signature_202, errors_202
+		"primitiveIndexedByteLargeIntegerAdd:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerAdd), 1312258, signature_202, errors_202
 };
 
-static const char *signature_203[] = {"SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
-static const char *errors_203[] = {nullptr};
+static const char *signature_203[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
+static const char *errors_203[] = {"ArgumentIsInvalid", "DivisionByZero", nullptr};
 static PrimitiveDescriptor primitive_203 = {
-		"primitiveIndexedByteLargeIntegerCompare:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerCompare), 1312258, signature_203, errors_203
+		"primitiveIndexedByteLargeIntegerAnd:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerAnd), 1312258, signature_203, errors_203
 };
 
-static const char *signature_204[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
-static const char *errors_204[] = {"ArgumentIsInvalid", "DivisionByZero", nullptr};
+static const char *signature_204[] = {"Float", "IndexedByteInstanceVariables"};
+static const char *errors_204[] = {nullptr};
 static PrimitiveDescriptor primitive_204 = {
-		"primitiveIndexedByteLargeIntegerDiv:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerDiv), 1312258, signature_204, errors_204
+		"primitiveIndexedByteLargeIntegerAsFloatIfFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerToFloat), 1312257, signature_204, errors_204
 };
 
-static const char *signature_205[] = {"IndexedByteInstanceVariables", "IndexedByteInstanceVariables class", "Float"};
+static const char *signature_205[] = {"SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
 static const char *errors_205[] = {nullptr};
 static PrimitiveDescriptor primitive_205 = {
-		"primitiveIndexedByteLargeIntegerFromFloat:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerFromDouble), 1310722, signature_205, errors_205
+		"primitiveIndexedByteLargeIntegerCompare:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerCompare), 1312258, signature_205, errors_205
 };
 
-static const char *signature_206[] = {"IndexedByteInstanceVariables", "IndexedByteInstanceVariables class", "SmallInteger"};
-static const char *errors_206[] = {nullptr};
+static const char *signature_206[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
+static const char *errors_206[] = {"ArgumentIsInvalid", "DivisionByZero", nullptr};
 static PrimitiveDescriptor primitive_206 = {
-		"primitiveIndexedByteLargeIntegerFromSmallInteger:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerFromSmallInteger), 1310722, signature_206, errors_206
+		"primitiveIndexedByteLargeIntegerDiv:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerDiv), 1312258, signature_206, errors_206
 };
 
-static const char *signature_207[] = {"IndexedByteInstanceVariables", "IndexedByteInstanceVariables class", "String", "Integer"};
-static const char *errors_207[] = {"ConversionFailed", nullptr};
+static const char *signature_207[] = {"IndexedByteInstanceVariables", "IndexedByteInstanceVariables class", "Float"};
+static const char *errors_207[] = {nullptr};
 static PrimitiveDescriptor primitive_207 = {
-		"primitiveIndexedByteLargeIntegerFromString:base:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerFromString), 1312259, signature_207, errors_207
+		"primitiveIndexedByteLargeIntegerFromFloat:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerFromDouble), 1310722, signature_207, errors_207
 };
 
-static const char *signature_208[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
-static const char *errors_208[] = {"ArgumentIsInvalid", "DivisionByZero", nullptr};
+static const char *signature_208[] = {"IndexedByteInstanceVariables", "IndexedByteInstanceVariables class", "SmallInteger"};
+static const char *errors_208[] = {nullptr};
 static PrimitiveDescriptor primitive_208 = {
-		"primitiveIndexedByteLargeIntegerMod:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerMod), 1312258, signature_208, errors_208
+		"primitiveIndexedByteLargeIntegerFromSmallInteger:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerFromSmallInteger), 1310722, signature_208, errors_208
 };
 
-static const char *signature_209[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
-static const char *errors_209[] = {"ArgumentIsInvalid", nullptr};
+static const char *signature_209[] = {"IndexedByteInstanceVariables", "IndexedByteInstanceVariables class", "String", "Integer"};
+static const char *errors_209[] = {"ConversionFailed", nullptr};
 static PrimitiveDescriptor primitive_209 = {
-		"primitiveIndexedByteLargeIntegerMultiply:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerMultiply), 1312258, signature_209, errors_209
+		"primitiveIndexedByteLargeIntegerFromString:base:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerFromString), 1312259, signature_209, errors_209
 };
 
 static const char *signature_210[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
 static const char *errors_210[] = {"ArgumentIsInvalid", "DivisionByZero", nullptr};
 static PrimitiveDescriptor primitive_210 = {
-		"primitiveIndexedByteLargeIntegerOr:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerOr), 1312258, signature_210, errors_210
+		"primitiveIndexedByteLargeIntegerMod:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerMod), 1312258, signature_210, errors_210
 };
 
 static const char *signature_211[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
-static const char *errors_211[] = {"ArgumentIsInvalid", "DivisionByZero", nullptr};
+static const char *errors_211[] = {"ArgumentIsInvalid", nullptr};
 static PrimitiveDescriptor primitive_211 = {
-		"primitiveIndexedByteLargeIntegerQuo:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerQuo), 1312258, signature_211, errors_211
+		"primitiveIndexedByteLargeIntegerMultiply:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerMultiply), 1312258, signature_211, errors_211
 };
 
 static const char *signature_212[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
 static const char *errors_212[] = {"ArgumentIsInvalid", "DivisionByZero", nullptr};
 static PrimitiveDescriptor primitive_212 = {
-		"primitiveIndexedByteLargeIntegerRem:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerRem), 1312258, signature_212, errors_212
+		"primitiveIndexedByteLargeIntegerOr:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerOr), 1312258, signature_212, errors_212
 };
 
-static const char *signature_213[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "SmallInt"};
+static const char *signature_213[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
 static const char *errors_213[] = {"ArgumentIsInvalid", "DivisionByZero", nullptr};
 static PrimitiveDescriptor primitive_213 = {
-		"primitiveIndexedByteLargeIntegerShift:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerShift), 1312258, signature_213, errors_213
+		"primitiveIndexedByteLargeIntegerQuo:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerQuo), 1312258, signature_213, errors_213
 };
 
 static const char *signature_214[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
-static const char *errors_214[] = {"ArgumentIsInvalid", nullptr};
+static const char *errors_214[] = {"ArgumentIsInvalid", "DivisionByZero", nullptr};
 static PrimitiveDescriptor primitive_214 = {
-		"primitiveIndexedByteLargeIntegerSubtract:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerSubtract), 1312258, signature_214, errors_214
+		"primitiveIndexedByteLargeIntegerRem:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerRem), 1312258, signature_214, errors_214
 };
 
-static const char *signature_215[] = {"String", "IndexedByteInstanceVariables", "SmallInteger"};
-static const char *errors_215[] = {nullptr};
+static const char *signature_215[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "SmallInt"};
+static const char *errors_215[] = {"ArgumentIsInvalid", "DivisionByZero", nullptr};
 static PrimitiveDescriptor primitive_215 = {
-		"primitiveIndexedByteLargeIntegerToStringBase:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerToString), 1312258, signature_215, errors_215
+		"primitiveIndexedByteLargeIntegerShift:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerShift), 1312258, signature_215, errors_215
 };
 
 static const char *signature_216[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
-static const char *errors_216[] = {"ArgumentIsInvalid", "DivisionByZero", nullptr};
+static const char *errors_216[] = {"ArgumentIsInvalid", nullptr};
 static PrimitiveDescriptor primitive_216 = {
-		"primitiveIndexedByteLargeIntegerXor:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerXor), 1312258, signature_216, errors_216
+		"primitiveIndexedByteLargeIntegerSubtract:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerSubtract), 1312258, signature_216, errors_216
 };
 
-static const char *signature_217[] = {"Object", "IndexedByteInstanceVariables class", "SmallInteger"};
-static const char *errors_217[] = {"NegativeSize", nullptr};
+static const char *signature_217[] = {"String", "IndexedByteInstanceVariables", "SmallInteger"};
+static const char *errors_217[] = {nullptr};
 static PrimitiveDescriptor primitive_217 = {
-		"primitiveIndexedByteNew:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::allocateSize), 1376258, signature_217, errors_217
+		"primitiveIndexedByteLargeIntegerToStringBase:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerToString), 1312258, signature_217, errors_217
 };
 
-static const char *signature_218[] = {"Object", "IndexedByteInstanceVariables class", "SmallInteger", "Boolean"};
-static const char *errors_218[] = {"NegativeSize", nullptr};
+static const char *signature_218[] = {"IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables"};
+static const char *errors_218[] = {"ArgumentIsInvalid", "DivisionByZero", nullptr};
 static PrimitiveDescriptor primitive_218 = {
-		"primitiveIndexedByteNew:size:tenured:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::allocateSize2), 327683, signature_218, errors_218
+		"primitiveIndexedByteLargeIntegerXor:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerXor), 1312258, signature_218, errors_218
 };
 
-static const char *signature_219[] = {"SmallInteger", "IndexedByteInstanceVariables"};
-static const char *errors_219[] = {nullptr};
+static const char *signature_219[] = {"Object", "IndexedByteInstanceVariables class", "SmallInteger"};
+static const char *errors_219[] = {"NegativeSize", nullptr};
 static PrimitiveDescriptor primitive_219 = {
-		"primitiveIndexedByteSize", primitiveFunctionType(&ByteArrayPrimitives::size), 1574401, signature_219, errors_219
+		"primitiveIndexedByteNew:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::allocateSize), 1376258, signature_219, errors_219
 };
 
-static const char *signature_220[] = {"SmallInteger", "IndexedDoubleByteInstanceVariables", "SmallInteger"};
-static const char *errors_220[] = {"OutOfBounds", nullptr};
+static const char *signature_220[] = {"Object", "IndexedByteInstanceVariables class", "SmallInteger", "Boolean"};
+static const char *errors_220[] = {"NegativeSize", nullptr};
 static PrimitiveDescriptor primitive_220 = {
-		"primitiveIndexedDoubleByteAt:ifFail:", primitiveFunctionType(&DoubleByteArrayPrimitives::at), 1312514, signature_220, errors_220
+		"primitiveIndexedByteNew:size:tenured:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::allocateSize2), 327683, signature_220, errors_220
 };
 
-static const char *signature_221[] = {"SmallInteger", "IndexedDoubleByteInstanceVariables", "SmallInteger", "SmallInteger"};
-static const char *errors_221[] = {"OutOfBounds", "ValueOutOfBounds", nullptr};
+static const char *signature_221[] = {"Self", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger"};
+static const char *errors_221[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_221 = {
-		"primitiveIndexedDoubleByteAt:put:ifFail:", primitiveFunctionType(&DoubleByteArrayPrimitives::atPut), 1312515, signature_221, errors_221
+		"primitiveIndexedByteReplaceFrom:to:with:startingAt:ifFail:", primitiveFunctionType(&ByteArrayPrimitives::replaceFromTo), 1310725, signature_221, errors_221
 };
 
-static const char *signature_222[] = {"SmallInteger", "IndexedDoubleByteInstanceVariables", "SmallInteger"};
-static const char *errors_222[] = {"OutOfBounds", nullptr};
+static const char *signature_222[] = {"SmallInteger", "IndexedByteInstanceVariables"};
+static const char *errors_222[] = {nullptr};
 static PrimitiveDescriptor primitive_222 = {
-		"primitiveIndexedDoubleByteCharacterAt:ifFail:", primitiveFunctionType(&DoubleByteArrayPrimitives::characterAt), 1312514, signature_222, errors_222
+		"primitiveIndexedByteSize", primitiveFunctionType(&ByteArrayPrimitives::size), 1574401, signature_222, errors_222
 };
 
-static const char *signature_223[] = {"SmallInteger", "IndexedDoubleByteInstanceVariables", "String"};
-static const char *errors_223[] = {nullptr};
+static const char *signature_223[] = {"SmallInteger", "IndexedDoubleByteInstanceVariables", "SmallInteger"};
+static const char *errors_223[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_223 = {
-		"primitiveIndexedDoubleByteCompare:ifFail:", primitiveFunctionType(&DoubleByteArrayPrimitives::compare), 1310722, signature_223, errors_223
+		"primitiveIndexedDoubleByteAt:ifFail:", primitiveFunctionType(&DoubleByteArrayPrimitives::at), 1312514, signature_223, errors_223
 };
 
-static const char *signature_224[] = {"SmallInteger", "IndexedDoubleByteInstanceVariables"};
-static const char *errors_224[] = {nullptr};
+static const char *signature_224[] = {"SmallInteger", "IndexedDoubleByteInstanceVariables", "SmallInteger", "SmallInteger"};
+static const char *errors_224[] = {"OutOfBounds", "ValueOutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_224 = {
-		"primitiveIndexedDoubleByteHash", primitiveFunctionType(&DoubleByteArrayPrimitives::hash), 1114113, signature_224, errors_224
+		"primitiveIndexedDoubleByteAt:put:ifFail:", primitiveFunctionType(&DoubleByteArrayPrimitives::atPut), 1312515, signature_224, errors_224
 };
 
-static const char *signature_225[] = {"CompressedSymbol", "IndexedDoubleByteInstanceVariables"};
+static const char *signature_225[] = {"Self", "IndexedDoubleByteInstanceVariables", "SmallInteger"};
 static const char *errors_225[] = {"ValueOutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_225 = {
-		"primitiveIndexedDoubleByteInternIfFail:", primitiveFunctionType(&DoubleByteArrayPrimitives::intern), 1376257, signature_225, errors_225
+		"primitiveIndexedDoubleByteAtAllPut:ifFail:", primitiveFunctionType(&DoubleByteArrayPrimitives::at_all_put), 1310722, signature_225, errors_225
 };
 
-static const char *signature_226[] = {"Object", "IndexedDoubleByteInstanceVariables class", "SmallInteger"};
-static const char *errors_226[] = {"NegativeSize", nullptr};
+static const char *signature_226[] = {"SmallInteger", "IndexedDoubleByteInstanceVariables", "SmallInteger"};
+static const char *errors_226[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_226 = {
-		"primitiveIndexedDoubleByteNew:ifFail:", primitiveFunctionType(&DoubleByteArrayPrimitives::allocateSize), 1376258, signature_226, errors_226
+		"primitiveIndexedDoubleByteCharacterAt:ifFail:", primitiveFunctionType(&DoubleByteArrayPrimitives::characterAt), 1312514, signature_226, errors_226
 };
 
-static const char *signature_227[] = {"Object", "IndexedDoubleByteInstanceVariables class", "SmallInteger", "Boolean"};
-static const char *errors_227[] = {"NegativeSize", nullptr};
+static const char *signature_227[] = {"SmallInteger", "IndexedDoubleByteInstanceVariables", "String"};
+static const char *errors_227[] = {nullptr};
 static PrimitiveDescriptor primitive_227 = {
-		"primitiveIndexedDoubleByteNew:size:tenured:ifFail:", primitiveFunctionType(&DoubleByteArrayPrimitives::allocateSize2), 327683, signature_227, errors_227
+		"primitiveIndexedDoubleByteCompare:ifFail:", primitiveFunctionType(&DoubleByteArrayPrimitives::compare), 1310722, signature_227, errors_227
 };
 
 static const char *signature_228[] = {"SmallInteger", "IndexedDoubleByteInstanceVariables"};
 static const char *errors_228[] = {nullptr};
 static PrimitiveDescriptor primitive_228 = {
-		"primitiveIndexedDoubleByteSize", primitiveFunctionType(&DoubleByteArrayPrimitives::size), 1574657, signature_228, errors_228
+		"primitiveIndexedDoubleByteHash", primitiveFunctionType(&DoubleByteArrayPrimitives::hash), 1114113, signature_228, errors_228
 };
 
-static const char *signature_229[] = {"Float", "IndexedFloatValueInstanceVariables", "SmallInteger"};
-static const char *errors_229[] = {"OutOfBounds", nullptr};
+static const char *signature_229[] = {"SmallInteger", "IndexedDoubleByteInstanceVariables", "SmallInteger", "SmallInteger"};
+static const char *errors_229[] = {"OutOfBounds", "ValueOutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_229 = {
-		"primitiveIndexedFloatValueAt:ifFail:", primitiveFunctionType(&DoubleValueArrayPrimitives::at), 1310722, signature_229, errors_229
+		"primitiveIndexedDoubleByteIndexOf:startingAt:ifFail:", primitiveFunctionType(&DoubleByteArrayPrimitives::indexOf), 1310723, signature_229, errors_229
 };
 
-static const char *signature_230[] = {"Float", "IndexedFloatValueInstanceVariables", "SmallInteger", "Float"};
-static const char *errors_230[] = {"OutOfBounds", "ValueOutOfBounds", nullptr};
+static const char *signature_230[] = {"CompressedSymbol", "IndexedDoubleByteInstanceVariables"};
+static const char *errors_230[] = {"ValueOutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_230 = {
-		"primitiveIndexedFloatValueAt:put:ifFail:", primitiveFunctionType(&DoubleValueArrayPrimitives::atPut), 1310723, signature_230, errors_230
+		"primitiveIndexedDoubleByteInternIfFail:", primitiveFunctionType(&DoubleByteArrayPrimitives::intern), 1376257, signature_230, errors_230
 };
 
-static const char *signature_231[] = {"Object", "IndexedFloatValueInstanceVariables class", "SmallInteger"};
+static const char *signature_231[] = {"Object", "IndexedDoubleByteInstanceVariables class", "SmallInteger"};
 static const char *errors_231[] = {"NegativeSize", nullptr};
 static PrimitiveDescriptor primitive_231 = {
-		"primitiveIndexedFloatValueNew:ifFail:", primitiveFunctionType(&DoubleValueArrayPrimitives::allocateSize), 1376258, signature_231, errors_231
+		"primitiveIndexedDoubleByteNew:ifFail:", primitiveFunctionType(&DoubleByteArrayPrimitives::allocateSize), 1376258, signature_231, errors_231
 };
 
-static const char *signature_232[] = {"SmallInteger", "IndexedFloatValueInstanceVariables"};
-static const char *errors_232[] = {nullptr};
+static const char *signature_232[] = {"Object", "IndexedDoubleByteInstanceVariables class", "SmallInteger", "Boolean"};
+static const char *errors_232[] = {"NegativeSize", nullptr};
 static PrimitiveDescriptor primitive_232 = {
-		"primitiveIndexedFloatValueSize", primitiveFunctionType(&DoubleValueArrayPrimitives::size), 1572865, signature_232, errors_232
+		"primitiveIndexedDoubleByteNew:size:tenured:ifFail:", primitiveFunctionType(&DoubleByteArrayPrimitives::allocateSize2), 327683, signature_232, errors_232
 };
 
-static const char *signature_233[] = {"SmallInteger", "IndexedInstanceVariables", "SmallInteger"};
-static const char *errors_233[] = {"OutOfBounds", nullptr};
+static const char *signature_233[] = {"SmallInteger", "IndexedDoubleByteInstanceVariables"};
+static const char *errors_233[] = {nullptr};
 static PrimitiveDescriptor primitive_233 = {
-		"primitiveIndexedObjectAt:ifFail:", primitiveFunctionType(&ObjectArrayPrimitives::at), 1312002, signature_233, errors_233
+		"primitiveIndexedDoubleByteSize", primitiveFunctionType(&DoubleByteArrayPrimitives::size), 1574657, signature_233, errors_233
 };
 
-static const char *signature_234[] = {"Object", "IndexedInstanceVariables", "SmallInteger", "Object"};
-static const char *errors_234[] = {"OutOfBounds", nullptr};
+static const char *signature_234[] = {"Self", "IndexedFloatValueInstanceVariables", "IndexedFloatValueInstanceVariables"};
+static const char *errors_234[] = {"ArgumentIsInvalid", nullptr};
 static PrimitiveDescriptor primitive_234 = {
-		"primitiveIndexedObjectAt:put:ifFail:", primitiveFunctionType(&ObjectArrayPrimitives::atPut), 1312003, signature_234, errors_234
+		"primitiveIndexedFloatValueAdd:ifFail:", primitiveFunctionType(&DoubleValueArrayPrimitives::add), 1310722, signature_234, errors_234
 };
 
-static const char *signature_235[] = {"Self", "IndexedInstanceVariables", "Object"};
-static const char *errors_235[] = {nullptr};
+static const char *signature_235[] = {"Float", "IndexedFloatValueInstanceVariables", "SmallInteger"};
+static const char *errors_235[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_235 = {
-		"primitiveIndexedObjectAtAllPut:", primitiveFunctionType(&ObjectArrayPrimitives::at_all_put), 1049858, signature_235, errors_235
+		"primitiveIndexedFloatValueAt:ifFail:", primitiveFunctionType(&DoubleValueArrayPrimitives::at), 1310722, signature_235, errors_235
 };
 
-static const char *signature_236[] = {"Self", "IndexedInstanceVariables", "SmallInteger", "SmallInteger", "SmallInteger"};
-static const char *errors_236[] = {"OutOfBounds", "NegativeSize", nullptr};
+static const char *signature_236[] = {"Float", "IndexedFloatValueInstanceVariables", "SmallInteger", "Float"};
+static const char *errors_236[] = {"OutOfBounds", "ValueOutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_236 = {
-		"primitiveIndexedObjectCopyFrom:startingAt:size:ifFail:", primitiveFunctionType(&ObjectArrayPrimitives::copy_size), 1377540, signature_236, errors_236
+		"primitiveIndexedFloatValueAt:put:ifFail:", primitiveFunctionType(&DoubleValueArrayPrimitives::atPut), 1310723, signature_236, errors_236
 };
 
-static const char *signature_237[] = {"Object", "IndexedInstanceVariables class", "SmallInteger"};
-static const char *errors_237[] = {"NegativeSize", nullptr};
+static const char *signature_237[] = {"Float", "IndexedFloatValueInstanceVariables", "IndexedFloatValueInstanceVariables"};
+static const char *errors_237[] = {"ArgumentIsInvalid", nullptr};
 static PrimitiveDescriptor primitive_237 = {
-		"primitiveIndexedObjectNew:ifFail:", primitiveFunctionType(&ObjectArrayPrimitives::allocateSize), 1376258, signature_237, errors_237
+		"primitiveIndexedFloatValueDot:ifFail:", primitiveFunctionType(&DoubleValueArrayPrimitives::dot), 1376258, signature_237, errors_237
 };
 
-static const char *signature_238[] = {"Object", "IndexedInstanceVariables class", "SmallInteger", "Boolean"};
-static const char *errors_238[] = {"NegativeSize", nullptr};
+static const char *signature_238[] = {"Self", "IndexedFloatValueInstanceVariables", "SmallInteger", "SmallInteger", "Float"};
+static const char *errors_238[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_238 = {
-		"primitiveIndexedObjectNew:size:tenured:ifFail:", primitiveFunctionType(&ObjectArrayPrimitives::allocateSize2), 327683, signature_238, errors_238
+		"primitiveIndexedFloatValueFrom:to:put:ifFail:", primitiveFunctionType(&DoubleValueArrayPrimitives::from_to_put), 1310724, signature_238, errors_238
 };
 
-static const char *signature_239[] = {"Self", "IndexedInstanceVariables", "SmallInteger", "SmallInteger", "IndexedInstanceVariables", "SmallInteger"};
+static const char *signature_239[] = {"Float", "IndexedFloatValueInstanceVariables"};
 static const char *errors_239[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_239 = {
-		"primitiveIndexedObjectReplaceFrom:to:with:startingAt:ifFail:", primitiveFunctionType(&ObjectArrayPrimitives::replace_from_to), 1377541, signature_239, errors_239
+		"primitiveIndexedFloatValueMaxIfFail:", primitiveFunctionType(&DoubleValueArrayPrimitives::max), 1376257, signature_239, errors_239
 };
 
-static const char *signature_240[] = {"Self", "IndexedInstanceVariables"};
-static const char *errors_240[] = {nullptr};
+static const char *signature_240[] = {"Float", "IndexedFloatValueInstanceVariables"};
+static const char *errors_240[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_240 = {
-		"primitiveIndexedObjectSize", primitiveFunctionType(&ObjectArrayPrimitives::size), 1574145, signature_240, errors_240
+		"primitiveIndexedFloatValueMinIfFail:", primitiveFunctionType(&DoubleValueArrayPrimitives::min), 1376257, signature_240, errors_240
 };
 
-static const char *signature_241[] = {"Instance", "Behavior", "SmallInt"};
-static const char *errors_241[] = {nullptr};
+static const char *signature_241[] = {"Self", "IndexedFloatValueInstanceVariables", "IndexedFloatValueInstanceVariables"};
+static const char *errors_241[] = {"ArgumentIsInvalid", nullptr};
 static PrimitiveDescriptor primitive_241 = {
-		"primitiveInlineAllocations:count:", primitiveFunctionType(&primitiveInlineAllocations), 4259842, signature_241, errors_241
+		"primitiveIndexedFloatValueMultiply:ifFail:", primitiveFunctionType(&DoubleValueArrayPrimitives::multiply), 1310722, signature_241, errors_241
 };
 
-static const char *signature_242[] = {"Boolean", "Behavior", "Symbol"};
-static const char *errors_242[] = {nullptr};
+static const char *signature_242[] = {"Object", "IndexedFloatValueInstanceVariables class", "SmallInteger"};
+static const char *errors_242[] = {"NegativeSize", nullptr};
 static PrimitiveDescriptor primitive_242 = {
-		"primitiveInliningDatabaseAddLookupEntryClass:selector:ifFail:", primitiveFunctionType(&SystemPrimitives::inlining_database_add_entry), 327682, signature_242, errors_242
+		"primitiveIndexedFloatValueNew:ifFail:", primitiveFunctionType(&DoubleValueArrayPrimitives::allocateSize), 1376258, signature_242, errors_242
 };
 
-static const char *signature_243[] = {"Boolean"};
-static const char *errors_243[] = {nullptr};
+static const char *signature_243[] = {"Self", "IndexedFloatValueInstanceVariables", "SmallInteger", "SmallInteger", "IndexedFloatValueInstanceVariables", "SmallInteger"};
+static const char *errors_243[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_243 = {
-		"primitiveInliningDatabaseCompile", primitiveFunctionType(&SystemPrimitives::inlining_database_compile_next), 65536, signature_243, errors_243
+		"primitiveIndexedFloatValueReplaceFrom:to:with:startingAt:ifFail:", primitiveFunctionType(&DoubleValueArrayPrimitives::replace_from_to), 1310725, signature_243, errors_243
 };
 
-static const char *signature_244[] = {"Object", "String"};
+static const char *signature_244[] = {"Self", "IndexedFloatValueInstanceVariables", "Float"};
 static const char *errors_244[] = {nullptr};
 static PrimitiveDescriptor primitive_244 = {
-		"primitiveInliningDatabaseCompile:ifFail:", primitiveFunctionType(&SystemPrimitives::inlining_database_compile), 327681, signature_244, errors_244
+		"primitiveIndexedFloatValueScale:ifFail:", primitiveFunctionType(&DoubleValueArrayPrimitives::scale), 1310722, signature_244, errors_244
 };
 
-static const char *signature_245[] = {"IndexedByteInstanceVariables", "String"};
+static const char *signature_245[] = {"SmallInteger", "IndexedFloatValueInstanceVariables"};
 static const char *errors_245[] = {nullptr};
 static PrimitiveDescriptor primitive_245 = {
-		"primitiveInliningDatabaseCompileDemangled:ifFail:", primitiveFunctionType(&SystemPrimitives::inlining_database_demangle), 327681, signature_245, errors_245
+		"primitiveIndexedFloatValueSize", primitiveFunctionType(&DoubleValueArrayPrimitives::size), 1572865, signature_245, errors_245
 };
 
-static const char *signature_246[] = {"Symbol"};
+static const char *signature_246[] = {"Float", "IndexedFloatValueInstanceVariables"};
 static const char *errors_246[] = {nullptr};
 static PrimitiveDescriptor primitive_246 = {
-		"primitiveInliningDatabaseDirectory", primitiveFunctionType(&SystemPrimitives::inlining_database_directory), 65536, signature_246, errors_246
+		"primitiveIndexedFloatValueSum", primitiveFunctionType(&DoubleValueArrayPrimitives::sum), 1114113, signature_246, errors_246
 };
 
-static const char *signature_247[] = {"SmallInteger"};
-static const char *errors_247[] = {nullptr};
+static const char *signature_247[] = {"SmallInteger", "IndexedInstanceVariables", "SmallInteger"};
+static const char *errors_247[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_247 = {
-		"primitiveInliningDatabaseFileOutAllIfFail:", primitiveFunctionType(&SystemPrimitives::inlining_database_file_out_all), 327680, signature_247, errors_247
+		"primitiveIndexedObjectAt:ifFail:", primitiveFunctionType(&ObjectArrayPrimitives::at), 1312002, signature_247, errors_247
 };
 
-static const char *signature_248[] = {"SmallInteger", "Behavior"};
-static const char *errors_248[] = {nullptr};
+static const char *signature_248[] = {"Object", "IndexedInstanceVariables", "SmallInteger", "Object"};
+static const char *errors_248[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_248 = {
-		"primitiveInliningDatabaseFileOutClass:ifFail:", primitiveFunctionType(&SystemPrimitives::inlining_database_file_out_class), 327681, signature_248, errors_248
+		"primitiveIndexedObjectAt:put:ifFail:", primitiveFunctionType(&ObjectArrayPrimitives::atPut), 1312003, signature_248, errors_248
 };
 
-static const char *signature_249[] = {"IndexedByteInstanceVariables", "String"};
+static const char *signature_249[] = {"Self", "IndexedInstanceVariables", "Object"};
 static const char *errors_249[] = {nullptr};
 static PrimitiveDescriptor primitive_249 = {
-		"primitiveInliningDatabaseMangle:ifFail:", primitiveFunctionType(&SystemPrimitives::inlining_database_mangle), 327681, signature_249, errors_249
+		"primitiveIndexedObjectAtAllPut:", primitiveFunctionType(&ObjectArrayPrimitives::at_all_put), 1049858, signature_249, errors_249
 };
 
-static const char *signature_250[] = {"Symbol", "Symbol"};
-static const char *errors_250[] = {nullptr};
+static const char *signature_250[] = {"Self", "IndexedInstanceVariables", "SmallInteger", "SmallInteger", "SmallInteger"};
+static const char *errors_250[] = {"OutOfBounds", "NegativeSize", nullptr};
 static PrimitiveDescriptor primitive_250 = {
-		"primitiveInliningDatabaseSetDirectory:ifFail:", primitiveFunctionType(&SystemPrimitives::inlining_database_set_directory), 327681, signature_250, errors_250
+		"primitiveIndexedObjectCopyFrom:startingAt:size:ifFail:", primitiveFunctionType(&ObjectArrayPrimitives::copy_size), 1377540, signature_250, errors_250
 };
 
-static const char *signature_251[] = {"Object", "Object", "SmallInteger"};
-static const char *errors_251[] = {"OutOfBounds", nullptr};
+static const char *signature_251[] = {"Object", "IndexedInstanceVariables class", "SmallInteger"};
+static const char *errors_251[] = {"NegativeSize", nullptr};
 static PrimitiveDescriptor primitive_251 = {
-		"primitiveInstVarAt:ifFail:", primitiveFunctionType(&OopPrimitives::instVarAt), 1376258, signature_251, errors_251
+		"primitiveIndexedObjectNew:ifFail:", primitiveFunctionType(&ObjectArrayPrimitives::allocateSize), 1376258, signature_251, errors_251
 };
 
-static const char *signature_252[] = {"Symbol", "Reciever", "Object", "SmallInteger"};
-static const char *errors_252[] = {"OutOfBounds", nullptr};
+static const char *signature_252[] = {"Object", "IndexedInstanceVariables class", "SmallInteger", "Boolean"};
+static const char *errors_252[] = {"NegativeSize", nullptr};
 static PrimitiveDescriptor primitive_252 = {
-		"primitiveInstVarNameFor:at:ifFail:", primitiveFunctionType(&OopPrimitives::instance_variable_name_at), 1376259, signature_252, errors_252
+		"primitiveIndexedObjectNew:size:tenured:ifFail:", primitiveFunctionType(&ObjectArrayPrimitives::allocateSize2), 327683, signature_252, errors_252
 };
 
-static const char *signature_253[] = {"Object", "Object", "SmallInteger", "Object"};
+static const char *signature_253[] = {"Self", "IndexedInstanceVariables", "SmallInteger", "SmallInteger", "IndexedInstanceVariables", "SmallInteger"};
 static const char *errors_253[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_253 = {
-		"primitiveInstVarOf:at:put:ifFail:", primitiveFunctionType(&OopPrimitives::instVarAtPut), 327683, signature_253, errors_253
+		"primitiveIndexedObjectReplaceFrom:to:with:startingAt:ifFail:", primitiveFunctionType(&ObjectArrayPrimitives::replace_from_to), 1377541, signature_253, errors_253
 };
 
-static const char *signature_254[] = {"IndexedInstanceVariables", "Class", "SmallInteger"};
+static const char *signature_254[] = {"Self", "IndexedInstanceVariables"};
 static const char *errors_254[] = {nullptr};
 static PrimitiveDescriptor primitive_254 = {
-		"primitiveInstancesOf:limit:ifFail:", primitiveFunctionType(&SystemPrimitives::instances_of), 327682, signature_254, errors_254
+		"primitiveIndexedObjectSize", primitiveFunctionType(&ObjectArrayPrimitives::size), 1574145, signature_254, errors_254
 };
 
-static const char *signature_255[] = {"SmallInteger"};
+static const char *signature_255[] = {"Instance", "Behavior", "SmallInt"};
 static const char *errors_255[] = {nullptr};
 static PrimitiveDescriptor primitive_255 = {
-		"primitiveInterpreterInvocationCounterLimit", primitiveFunctionType(&DebugPrimitives::interpreterInvocationCounterLimit), 65536, signature_255, errors_255
+		"primitiveInlineAllocations:count:", primitiveFunctionType(&primitiveInlineAllocations), 4259842, signature_255, errors_255
 };
 
-static const char *signature_256[] = {"SmallInteger", "IndexedByteInstanceVariables"};
+static const char *signature_256[] = {"Boolean", "Behavior", "Symbol"};
 static const char *errors_256[] = {nullptr};
 static PrimitiveDescriptor primitive_256 = {
-		"primitiveLargeIntegerHash", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerHash), 1574401, signature_256, errors_256
+		"primitiveInliningDatabaseAddLookupEntryClass:selector:ifFail:", primitiveFunctionType(&SystemPrimitives::inlining_database_add_entry), 327682, signature_256, errors_256
 };
 
-static const char *signature_257[] = {"Boolean", "SmallInteger", "SmallInteger"};
+static const char *signature_257[] = {"Boolean"};
 static const char *errors_257[] = {nullptr};
 static PrimitiveDescriptor primitive_257 = {
-		"primitiveLessThan:ifFail:", primitiveFunctionType(&SmallIntegerOopPrimitives::lessThan), 6029570, signature_257, errors_257
+		"primitiveInliningDatabaseCompile", primitiveFunctionType(&SystemPrimitives::inlining_database_compile_next), 65536, signature_257, errors_257
 };
 
-static const char *signature_258[] = {"Boolean", "SmallInteger", "SmallInteger"};
+static const char *signature_258[] = {"Object", "String"};
 static const char *errors_258[] = {nullptr};
 static PrimitiveDescriptor primitive_258 = {
-		"primitiveLessThanOrEqual:ifFail:", primitiveFunctionType(&SmallIntegerOopPrimitives::lessThanOrEqual), 6029570, signature_258, errors_258
+		"primitiveInliningDatabaseCompile:ifFail:", primitiveFunctionType(&SystemPrimitives::inlining_database_compile), 327681, signature_258, errors_258
 };
 
-static const char *signature_259[] = {"SmallInteger", "Float", "Float", "SmallInteger"};
+static const char *signature_259[] = {"IndexedByteInstanceVariables", "String"};
 static const char *errors_259[] = {nullptr};
 static PrimitiveDescriptor primitive_259 = {
-		"primitiveMandelbrotAtRe:im:iterate:ifFail:", primitiveFunctionType(&DoubleOopPrimitives::mandelbrot), 4980739, signature_259, errors_259
+		"primitiveInliningDatabaseCompileDemangled:ifFail:", primitiveFunctionType(&SystemPrimitives::inlining_database_demangle), 327681, signature_259, errors_259
 };
 
-static const char *signature_260[] = {"Block", "Method", "Object"};
+static const char *signature_260[] = {"Symbol"};
 static const char *errors_260[] = {nullptr};
 static PrimitiveDescriptor primitive_260 = {
-		"primitiveMethodAllocateBlock:ifFail:", primitiveFunctionType(&MethodOopPrimitives::allocate_block_self), 1376258, signature_260, errors_260
+		"primitiveInliningDatabaseDirectory", primitiveFunctionType(&SystemPrimitives::inlining_database_directory), 65536, signature_260, errors_260
 };
 
-static const char *signature_261[] = {"Block", "Method"};
+static const char *signature_261[] = {"SmallInteger"};
 static const char *errors_261[] = {nullptr};
 static PrimitiveDescriptor primitive_261 = {
-		"primitiveMethodAllocateBlockIfFail:", primitiveFunctionType(&MethodOopPrimitives::allocate_block), 1376257, signature_261, errors_261
+		"primitiveInliningDatabaseFileOutAllIfFail:", primitiveFunctionType(&SystemPrimitives::inlining_database_file_out_all), 327680, signature_261, errors_261
 };
 
-static const char *signature_262[] = {"Object", "Method"};
+static const char *signature_262[] = {"SmallInteger", "Behavior"};
 static const char *errors_262[] = {nullptr};
 static PrimitiveDescriptor primitive_262 = {
-		"primitiveMethodBody", primitiveFunctionType(&MethodOopPrimitives::fileout_body), 1114113, signature_262, errors_262
+		"primitiveInliningDatabaseFileOutClass:ifFail:", primitiveFunctionType(&SystemPrimitives::inlining_database_file_out_class), 327681, signature_262, errors_262
 };
 
-static const char *signature_263[] = {"Object", "Method"};
+static const char *signature_263[] = {"IndexedByteInstanceVariables", "String"};
 static const char *errors_263[] = {nullptr};
 static PrimitiveDescriptor primitive_263 = {
-		"primitiveMethodDebugInfo", primitiveFunctionType(&MethodOopPrimitives::debug_info), 1114113, signature_263, errors_263
+		"primitiveInliningDatabaseMangle:ifFail:", primitiveFunctionType(&SystemPrimitives::inlining_database_mangle), 327681, signature_263, errors_263
 };
 
-static const char *signature_264[] = {"Method", "Behavior", "CompressedSymbol"};
-static const char *errors_264[] = {"NotFound", nullptr};
+static const char *signature_264[] = {"Symbol", "Symbol"};
+static const char *errors_264[] = {nullptr};
 static PrimitiveDescriptor primitive_264 = {
-		"primitiveMethodFor:ifFail:", primitiveFunctionType(&BehaviorPrimitives::methodFor), 1376258, signature_264, errors_264
+		"primitiveInliningDatabaseSetDirectory:ifFail:", primitiveFunctionType(&SystemPrimitives::inlining_database_set_directory), 327681, signature_264, errors_264
 };
 
-static const char *signature_265[] = {"Symbol", "Method"};
-static const char *errors_265[] = {nullptr};
+static const char *signature_265[] = {"Object", "Object", "SmallInteger"};
+static const char *errors_265[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_265 = {
-		"primitiveMethodInliningInfo", primitiveFunctionType(&MethodOopPrimitives::inlining_info), 1114113, signature_265, errors_265
+		"primitiveInstVarAt:ifFail:", primitiveFunctionType(&OopPrimitives::instVarAt), 1376258, signature_265, errors_265
 };
 
-static const char *signature_266[] = {"SmallInteger", "Method"};
-static const char *errors_266[] = {nullptr};
+static const char *signature_266[] = {"Symbol", "Reciever", "Object", "SmallInteger"};
+static const char *errors_266[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_266 = {
-		"primitiveMethodNumberOfArguments", primitiveFunctionType(&MethodOopPrimitives::numberOfArguments), 1114113, signature_266, errors_266
+		"primitiveInstVarNameFor:at:ifFail:", primitiveFunctionType(&OopPrimitives::instance_variable_name_at), 1376259, signature_266, errors_266
 };
 
-static const char *signature_267[] = {"Symbol", "Method", "Method"};
-static const char *errors_267[] = {nullptr};
+static const char *signature_267[] = {"Object", "Object", "SmallInteger", "Object"};
+static const char *errors_267[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_267 = {
-		"primitiveMethodOuter:ifFail:", primitiveFunctionType(&MethodOopPrimitives::setOuter), 1376258, signature_267, errors_267
+		"primitiveInstVarOf:at:put:ifFail:", primitiveFunctionType(&OopPrimitives::instVarAtPut), 327683, signature_267, errors_267
 };
 
-static const char *signature_268[] = {"Method", "Method"};
-static const char *errors_268[] = {"ReceiverNotBlockMethod", nullptr};
+static const char *signature_268[] = {"IndexedInstanceVariables", "Class", "SmallInteger"};
+static const char *errors_268[] = {nullptr};
 static PrimitiveDescriptor primitive_268 = {
-		"primitiveMethodOuterIfFail:", primitiveFunctionType(&MethodOopPrimitives::outer), 1376257, signature_268, errors_268
+		"primitiveInstancesOf:limit:ifFail:", primitiveFunctionType(&SystemPrimitives::instances_of), 327682, signature_268, errors_268
 };
 
-static const char *signature_269[] = {"Method", "Method", "Object"};
+static const char *signature_269[] = {"SmallInteger"};
 static const char *errors_269[] = {nullptr};
 static PrimitiveDescriptor primitive_269 = {
-		"primitiveMethodPrettyPrintKlass:ifFail:", primitiveFunctionType(&MethodOopPrimitives::prettyPrint), 1376258, signature_269, errors_269
+		"primitiveInterpreterInvocationCounterLimit", primitiveFunctionType(&DebugPrimitives::interpreterInvocationCounterLimit), 65536, signature_269, errors_269
 };
 
-static const char *signature_270[] = {"ByteIndexedInstanceVariables", "Method", "Object"};
+static const char *signature_270[] = {"SmallInteger", "IndexedByteInstanceVariables"};
 static const char *errors_270[] = {nullptr};
 static PrimitiveDescriptor primitive_270 = {
-		"primitiveMethodPrettyPrintSourceKlass:ifFail:", primitiveFunctionType(&MethodOopPrimitives::prettyPrintSource), 1376258, signature_270, errors_270
+		"primitiveLargeIntegerHash", primitiveFunctionType(&ByteArrayPrimitives::largeIntegerHash), 1574401, signature_270, errors_270
 };
 
-static const char *signature_271[] = {"Symbol", "Method"};
+static const char *signature_271[] = {"Boolean", "SmallInteger", "SmallInteger"};
 static const char *errors_271[] = {nullptr};
 static PrimitiveDescriptor primitive_271 = {
-		"primitiveMethodPrintCodes", primitiveFunctionType(&MethodOopPrimitives::printCodes), 1114113, signature_271, errors_271
+		"primitiveLessThan:ifFail:", primitiveFunctionType(&SmallIntegerOopPrimitives::lessThan), 6029570, signature_271, errors_271
 };
 
-static const char *signature_272[] = {"IndexedInstanceVariables", "Method"};
+static const char *signature_272[] = {"Boolean", "SmallInteger", "SmallInteger"};
 static const char *errors_272[] = {nullptr};
 static PrimitiveDescriptor primitive_272 = {
-		"primitiveMethodReferencedClassVarNames", primitiveFunctionType(&MethodOopPrimitives::referenced_class_variable_names), 1114113, signature_272, errors_272
+		"primitiveLessThanOrEqual:ifFail:", primitiveFunctionType(&SmallIntegerOopPrimitives::lessThanOrEqual), 6029570, signature_272, errors_272
 };
 
-static const char *signature_273[] = {"IndexedInstanceVariables", "Method"};
+static const char *signature_273[] = {"SmallInteger", "Float", "Float", "SmallInteger"};
 static const char *errors_273[] = {nullptr};
 static PrimitiveDescriptor primitive_273 = {
-		"primitiveMethodReferencedGlobalNames", primitiveFunctionType(&MethodOopPrimitives::referenced_global_names), 1114113, signature_273, errors_273
+		"primitiveMandelbrotAtRe:im:iterate:ifFail:", primitiveFunctionType(&DoubleOopPrimitives::mandelbrot), 4980739, signature_273, errors_273
 };
 
-static const char *signature_274[] = {"IndexedInstanceVariables", "Method", "Mixin"};
+static const char *signature_274[] = {"Block", "Method", "Object"};
 static const char *errors_274[] = {nullptr};
 static PrimitiveDescriptor primitive_274 = {
-		"primitiveMethodReferencedInstVarNamesMixin:ifFail:", primitiveFunctionType(&MethodOopPrimitives::referenced_instance_variable_names), 1376258, signature_274, errors_274
+		"primitiveMethodAllocateBlock:ifFail:", primitiveFunctionType(&MethodOopPrimitives::allocate_block_self), 1376258, signature_274, errors_274
 };
 
-static const char *signature_275[] = {"Symbol", "Method"};
+static const char *signature_275[] = {"Block", "Method"};
 static const char *errors_275[] = {nullptr};
 static PrimitiveDescriptor primitive_275 = {
-		"primitiveMethodSelector", primitiveFunctionType(&MethodOopPrimitives::selector), 1114113, signature_275, errors_275
+		"primitiveMethodAllocateBlockIfFail:", primitiveFunctionType(&MethodOopPrimitives::allocate_block), 1376257, signature_275, errors_275
 };
 
-static const char *signature_276[] = {"Symbol", "Method", "Symbol"};
+static const char *signature_276[] = {"Object", "Method"};
 static const char *errors_276[] = {nullptr};
 static PrimitiveDescriptor primitive_276 = {
-		"primitiveMethodSelector:ifFail:", primitiveFunctionType(&MethodOopPrimitives::setSelector), 1376258, signature_276, errors_276
+		"primitiveMethodBody", primitiveFunctionType(&MethodOopPrimitives::fileout_body), 1114113, signature_276, errors_276
 };
 
-static const char *signature_277[] = {"IndexedInstanceVariables", "Method"};
+static const char *signature_277[] = {"Object", "Method"};
 static const char *errors_277[] = {nullptr};
 static PrimitiveDescriptor primitive_277 = {
-		"primitiveMethodSenders", primitiveFunctionType(&MethodOopPrimitives::senders), 1114113, signature_277, errors_277
+		"primitiveMethodDebugInfo", primitiveFunctionType(&MethodOopPrimitives::debug_info), 1114113, signature_277, errors_277
 };
 
-static const char *signature_278[] = {"Symbol", "Method", "Symbol"};
-static const char *errors_278[] = {"ArgumentIsInvalid", nullptr};
+static const char *signature_278[] = {"Method", "Behavior", "CompressedSymbol"};
+static const char *errors_278[] = {"NotFound", nullptr};
 static PrimitiveDescriptor primitive_278 = {
-		"primitiveMethodSetInliningInfo:ifFail:", primitiveFunctionType(&MethodOopPrimitives::set_inlining_info), 1376258, signature_278, errors_278
+		"primitiveMethodFor:ifFail:", primitiveFunctionType(&BehaviorPrimitives::methodFor), 1376258, signature_278, errors_278
 };
 
-static const char *signature_279[] = {"Object", "Method"};
+static const char *signature_279[] = {"Symbol", "Method"};
 static const char *errors_279[] = {nullptr};
 static PrimitiveDescriptor primitive_279 = {
-		"primitiveMethodSizeAndFlags", primitiveFunctionType(&MethodOopPrimitives::size_and_flags), 1114113, signature_279, errors_279
+		"primitiveMethodInliningInfo", primitiveFunctionType(&MethodOopPrimitives::inlining_info), 1114113, signature_279, errors_279
 };
 
-static const char *signature_280[] = {"Mixin", "Mixin", "Symbol"};
-static const char *errors_280[] = {"IsInstalled", "OutOfBounds", nullptr};
+static const char *signature_280[] = {"SmallInteger", "Method"};
+static const char *errors_280[] = {nullptr};
 static PrimitiveDescriptor primitive_280 = {
-		"primitiveMixin:addClassVariable:ifFail:", primitiveFunctionType(&MixinOopPrimitives::add_class_variable), 327682, signature_280, errors_280
+		"primitiveMethodNumberOfArguments", primitiveFunctionType(&MethodOopPrimitives::numberOfArguments), 1114113, signature_280, errors_280
 };
 
-static const char *signature_281[] = {"Symbol", "Mixin", "Symbol"};
-static const char *errors_281[] = {"IsInstalled", "OutOfBounds", nullptr};
+static const char *signature_281[] = {"Symbol", "Method", "Method"};
+static const char *errors_281[] = {nullptr};
 static PrimitiveDescriptor primitive_281 = {
-		"primitiveMixin:addInstanceVariable:ifFail:", primitiveFunctionType(&MixinOopPrimitives::add_instance_variable), 327682, signature_281, errors_281
+		"primitiveMethodOuter:ifFail:", primitiveFunctionType(&MethodOopPrimitives::setOuter), 1376258, signature_281, errors_281
 };
 
-static const char *signature_282[] = {"Method", "Mixin", "Method"};
-static const char *errors_282[] = {"IsInstalled", nullptr};
+static const char *signature_282[] = {"Method", "Method"};
+static const char *errors_282[] = {"ReceiverNotBlockMethod", nullptr};
 static PrimitiveDescriptor primitive_282 = {
-		"primitiveMixin:addMethod:ifFail:", primitiveFunctionType(&MixinOopPrimitives::add_method), 327682, signature_282, errors_282
+		"primitiveMethodOuterIfFail:", primitiveFunctionType(&MethodOopPrimitives::outer), 1376257, signature_282, errors_282
 };
 
-static const char *signature_283[] = {"Symbol", "Mixin", "SmallInteger"};
-static const char *errors_283[] = {"OutOfBounds", nullptr};
+static const char *signature_283[] = {"Method", "Method", "Object"};
+static const char *errors_283[] = {nullptr};
 static PrimitiveDescriptor primitive_283 = {
-		"primitiveMixin:classVariableAt:ifFail:", primitiveFunctionType(&MixinOopPrimitives::class_variable_at), 327682, signature_283, errors_283
+		"primitiveMethodPrettyPrintKlass:ifFail:", primitiveFunctionType(&MethodOopPrimitives::prettyPrint), 1376258, signature_283, errors_283
 };
 
-static const char *signature_284[] = {"Symbol", "Mixin"};
+static const char *signature_284[] = {"ByteIndexedInstanceVariables", "Method", "Object"};
 static const char *errors_284[] = {nullptr};
 static PrimitiveDescriptor primitive_284 = {
-		"primitiveMixin:classVariablesIfFail:", primitiveFunctionType(&MixinOopPrimitives::class_variables), 327681, signature_284, errors_284
+		"primitiveMethodPrettyPrintSourceKlass:ifFail:", primitiveFunctionType(&MethodOopPrimitives::prettyPrintSource), 1376258, signature_284, errors_284
 };
 
-static const char *signature_285[] = {"Symbol", "Mixin", "SmallInteger"};
-static const char *errors_285[] = {"OutOfBounds", nullptr};
+static const char *signature_285[] = {"Symbol", "Method"};
+static const char *errors_285[] = {nullptr};
 static PrimitiveDescriptor primitive_285 = {
-		"primitiveMixin:instanceVariableAt:ifFail:", primitiveFunctionType(&MixinOopPrimitives::instance_variable_at), 327682, signature_285, errors_285
+		"primitiveMethodPrintCodes", primitiveFunctionType(&MethodOopPrimitives::printCodes), 1114113, signature_285, errors_285
 };
 
-static const char *signature_286[] = {"Symbol", "Mixin"};
+static const char *signature_286[] = {"IndexedInstanceVariables", "Method"};
 static const char *errors_286[] = {nullptr};
 static PrimitiveDescriptor primitive_286 = {
-		"primitiveMixin:instanceVariablesIfFail:", primitiveFunctionType(&MixinOopPrimitives::instance_variables), 327681, signature_286, errors_286
+		"primitiveMethodReferencedClassVarNames", primitiveFunctionType(&MethodOopPrimitives::referenced_class_variable_names), 1114113, signature_286, errors_286
 };
 
-static const char *signature_287[] = {"Method", "Mixin", "SmallInteger"};
-static const char *errors_287[] = {"OutOfBounds", nullptr};
+static const char *signature_287[] = {"IndexedInstanceVariables", "Method"};
+static const char *errors_287[] = {nullptr};
 static PrimitiveDescriptor primitive_287 = {
-		"primitiveMixin:methodAt:ifFail:", primitiveFunctionType(&MixinOopPrimitives::method_at), 327682, signature_287, errors_287
+		"primitiveMethodReferencedGlobalNames", primitiveFunctionType(&MethodOopPrimitives::referenced_global_names), 1114113, signature_287, errors_287
 };
 
-static const char *signature_288[] = {"Symbol", "Mixin"};
+static const char *signature_288[] = {"IndexedInstanceVariables", "Method", "Mixin"};
 static const char *errors_288[] = {nullptr};
 static PrimitiveDescriptor primitive_288 = {
-		"primitiveMixin:methodsIfFail:", primitiveFunctionType(&MixinOopPrimitives::methods), 327681, signature_288, errors_288
+		"primitiveMethodReferencedInstVarNamesMixin:ifFail:", primitiveFunctionType(&MethodOopPrimitives::referenced_instance_variable_names), 1376258, signature_288, errors_288
 };
 
-static const char *signature_289[] = {"Symbol", "Mixin", "SmallInteger"};
-static const char *errors_289[] = {"IsInstalled", "OutOfBounds", nullptr};
+static const char *signature_289[] = {"Symbol", "Method"};
+static const char *errors_289[] = {nullptr};
 static PrimitiveDescriptor primitive_289 = {
-		"primitiveMixin:removeClassVariableAt:ifFail:", primitiveFunctionType(&MixinOopPrimitives::remove_class_variable_at), 327682, signature_289, errors_289
+		"primitiveMethodSelector", primitiveFunctionType(&MethodOopPrimitives::selector), 1114113, signature_289, errors_289
 };
 
-static const char *signature_290[] = {"Symbol", "Mixin", "SmallInteger"};
-static const char *errors_290[] = {"IsInstalled", "OutOfBounds", nullptr};
+static const char *signature_290[] = {"Symbol", "Method", "Symbol"};
+static const char *errors_290[] = {nullptr};
 static PrimitiveDescriptor primitive_290 = {
-		"primitiveMixin:removeInstanceVariableAt:ifFail:", primitiveFunctionType(&MixinOopPrimitives::remove_instance_variable_at), 327682, signature_290, errors_290
+		"primitiveMethodSelector:ifFail:", primitiveFunctionType(&MethodOopPrimitives::setSelector), 1376258, signature_290, errors_290
 };
 
-static const char *signature_291[] = {"Method", "Mixin", "SmallInteger"};
-static const char *errors_291[] = {"IsInstalled", "OutOfBounds", nullptr};
+static const char *signature_291[] = {"IndexedInstanceVariables", "Method"};
+static const char *errors_291[] = {nullptr};
 static PrimitiveDescriptor primitive_291 = {
-		"primitiveMixin:removeMethodAt:ifFail:", primitiveFunctionType(&MixinOopPrimitives::remove_method_at), 327682, signature_291, errors_291
+		"primitiveMethodSenders", primitiveFunctionType(&MethodOopPrimitives::senders), 1114113, signature_291, errors_291
 };
 
-static const char *signature_292[] = {"Mixin", "Mixin"};
-static const char *errors_292[] = {nullptr};
+static const char *signature_292[] = {"Symbol", "Method", "Symbol"};
+static const char *errors_292[] = {"ArgumentIsInvalid", nullptr};
 static PrimitiveDescriptor primitive_292 = {
-		"primitiveMixinClassMixinOf:ifFail:", primitiveFunctionType(&MixinOopPrimitives::class_mixin), 327681, signature_292, errors_292
+		"primitiveMethodSetInliningInfo:ifFail:", primitiveFunctionType(&MethodOopPrimitives::set_inlining_info), 1376258, signature_292, errors_292
 };
 
-static const char *signature_293[] = {"Boolean", "Mixin"};
+static const char *signature_293[] = {"Object", "Method"};
 static const char *errors_293[] = {nullptr};
 static PrimitiveDescriptor primitive_293 = {
-		"primitiveMixinIsInstalled:ifFail:", primitiveFunctionType(&MixinOopPrimitives::is_installed), 327681, signature_293, errors_293
+		"primitiveMethodSizeAndFlags", primitiveFunctionType(&MethodOopPrimitives::size_and_flags), 1114113, signature_293, errors_293
 };
 
-static const char *signature_294[] = {"SmallInteger", "Mixin"};
-static const char *errors_294[] = {nullptr};
+static const char *signature_294[] = {"Mixin", "Mixin", "Symbol"};
+static const char *errors_294[] = {"IsInstalled", "OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_294 = {
-		"primitiveMixinNumberOfClassVariablesOf:ifFail:", primitiveFunctionType(&MixinOopPrimitives::number_of_class_variables), 327681, signature_294, errors_294
+		"primitiveMixin:addClassVariable:ifFail:", primitiveFunctionType(&MixinOopPrimitives::add_class_variable), 327682, signature_294, errors_294
 };
 
-static const char *signature_295[] = {"SmallInteger", "Mixin"};
-static const char *errors_295[] = {nullptr};
+static const char *signature_295[] = {"Symbol", "Mixin", "Symbol"};
+static const char *errors_295[] = {"IsInstalled", "OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_295 = {
-		"primitiveMixinNumberOfInstanceVariablesOf:ifFail:", primitiveFunctionType(&MixinOopPrimitives::number_of_instance_variables), 327681, signature_295, errors_295
+		"primitiveMixin:addInstanceVariable:ifFail:", primitiveFunctionType(&MixinOopPrimitives::add_instance_variable), 327682, signature_295, errors_295
 };
 
-static const char *signature_296[] = {"SmallInteger", "Mixin"};
-static const char *errors_296[] = {nullptr};
+static const char *signature_296[] = {"Method", "Mixin", "Method"};
+static const char *errors_296[] = {"IsInstalled", nullptr};
 static PrimitiveDescriptor primitive_296 = {
-		"primitiveMixinNumberOfMethodsOf:ifFail:", primitiveFunctionType(&MixinOopPrimitives::number_of_methods), 327681, signature_296, errors_296
+		"primitiveMixin:addMethod:ifFail:", primitiveFunctionType(&MixinOopPrimitives::add_method), 327682, signature_296, errors_296
 };
 
-static const char *signature_297[] = {"Class", "Mixin"};
-static const char *errors_297[] = {nullptr};
+static const char *signature_297[] = {"Symbol", "Mixin", "SmallInteger"};
+static const char *errors_297[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_297 = {
-		"primitiveMixinPrimaryInvocationOf:ifFail:", primitiveFunctionType(&MixinOopPrimitives::primary_invocation), 327681, signature_297, errors_297
+		"primitiveMixin:classVariableAt:ifFail:", primitiveFunctionType(&MixinOopPrimitives::class_variable_at), 327682, signature_297, errors_297
 };
 
-static const char *signature_298[] = {"Mixin", "Mixin", "Mixin"};
-static const char *errors_298[] = {"IsInstalled", nullptr};
+static const char *signature_298[] = {"Symbol", "Mixin"};
+static const char *errors_298[] = {nullptr};
 static PrimitiveDescriptor primitive_298 = {
-		"primitiveMixinSetClassMixinOf:to:ifFail:", primitiveFunctionType(&MixinOopPrimitives::set_class_mixin), 327682, signature_298, errors_298
+		"primitiveMixin:classVariablesIfFail:", primitiveFunctionType(&MixinOopPrimitives::class_variables), 327681, signature_298, errors_298
 };
 
-static const char *signature_299[] = {"Boolean", "Mixin"};
-static const char *errors_299[] = {nullptr};
+static const char *signature_299[] = {"Symbol", "Mixin", "SmallInteger"};
+static const char *errors_299[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_299 = {
-		"primitiveMixinSetInstalled:ifFail:", primitiveFunctionType(&MixinOopPrimitives::set_installed), 327681, signature_299, errors_299
+		"primitiveMixin:instanceVariableAt:ifFail:", primitiveFunctionType(&MixinOopPrimitives::instance_variable_at), 327682, signature_299, errors_299
 };
 
-static const char *signature_300[] = {"Class", "Mixin", "Class"};
-static const char *errors_300[] = {"IsInstalled", nullptr};
+static const char *signature_300[] = {"Symbol", "Mixin"};
+static const char *errors_300[] = {nullptr};
 static PrimitiveDescriptor primitive_300 = {
-		"primitiveMixinSetPrimaryInvocationOf:to:ifFail:", primitiveFunctionType(&MixinOopPrimitives::set_primary_invocation), 327682, signature_300, errors_300
+		"primitiveMixin:instanceVariablesIfFail:", primitiveFunctionType(&MixinOopPrimitives::instance_variables), 327681, signature_300, errors_300
 };
 
-static const char *signature_301[] = {"Boolean", "Mixin"};
-static const char *errors_301[] = {nullptr};
+static const char *signature_301[] = {"Method", "Mixin", "SmallInteger"};
+static const char *errors_301[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_301 = {
-		"primitiveMixinSetUnInstalled:ifFail:", primitiveFunctionType(&MixinOopPrimitives::set_uninstalled), 327681, signature_301, errors_301
+		"primitiveMixin:methodAt:ifFail:", primitiveFunctionType(&MixinOopPrimitives::method_at), 327682, signature_301, errors_301
 };
 
-static const char *signature_302[] = {"SmallInteger", "SmallInteger", "SmallInteger"};
-static const char *errors_302[] = {"Overflow", "DivisionByZero", nullptr};
+static const char *signature_302[] = {"Symbol", "Mixin"};
+static const char *errors_302[] = {nullptr};
 static PrimitiveDescriptor primitive_302 = {
-		"primitiveMod:ifFail:", primitiveFunctionType(&smiOopPrimitives_mod), 6029826, signature_302, errors_302
+		"primitiveMixin:methodsIfFail:", primitiveFunctionType(&MixinOopPrimitives::methods), 327681, signature_302, errors_302
 };
 
-static const char *signature_303[] = {"SmallInteger", "SmallInteger", "SmallInteger"};
-static const char *errors_303[] = {"Overflow", nullptr};
+static const char *signature_303[] = {"Symbol", "Mixin", "SmallInteger"};
+static const char *errors_303[] = {"IsInstalled", "OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_303 = {
-		"primitiveMultiply:ifFail:", primitiveFunctionType(&smiOopPrimitives_multiply), 6029826, signature_303, errors_303
+		"primitiveMixin:removeClassVariableAt:ifFail:", primitiveFunctionType(&MixinOopPrimitives::remove_class_variable_at), 327682, signature_303, errors_303
 };
 
-static const char *signature_304[] = {"Instance", "Behavior", "Boolean"};
-static const char *errors_304[] = {nullptr};
+static const char *signature_304[] = {"Symbol", "Mixin", "SmallInteger"};
+static const char *errors_304[] = {"IsInstalled", "OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_304 = {
-		"primitiveNew0:ifFail:", primitiveFunctionType(&primitiveNew0), 7667714, signature_304, errors_304
+		"primitiveMixin:removeInstanceVariableAt:ifFail:", primitiveFunctionType(&MixinOopPrimitives::remove_instance_variable_at), 327682, signature_304, errors_304
 };
 
-static const char *signature_305[] = {"Instance", "Behavior", "Boolean"};
-static const char *errors_305[] = {nullptr};
+static const char *signature_305[] = {"Method", "Mixin", "SmallInteger"};
+static const char *errors_305[] = {"IsInstalled", "OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_305 = {
-		"primitiveNew1:ifFail:", primitiveFunctionType(&primitiveNew1), 7667714, signature_305, errors_305
+		"primitiveMixin:removeMethodAt:ifFail:", primitiveFunctionType(&MixinOopPrimitives::remove_method_at), 327682, signature_305, errors_305
 };
 
-static const char *signature_306[] = {"Instance", "Behavior", "Boolean"};
+static const char *signature_306[] = {"Mixin", "Mixin"};
 static const char *errors_306[] = {nullptr};
 static PrimitiveDescriptor primitive_306 = {
-		"primitiveNew2:ifFail:", primitiveFunctionType(&primitiveNew2), 7667714, signature_306, errors_306
+		"primitiveMixinClassMixinOf:ifFail:", primitiveFunctionType(&MixinOopPrimitives::class_mixin), 327681, signature_306, errors_306
 };
 
-static const char *signature_307[] = {"Instance", "Behavior"};
-static const char *errors_307[] = {"ReceiverIsIndexable", nullptr};
+static const char *signature_307[] = {"Boolean", "Mixin"};
+static const char *errors_307[] = {nullptr};
 static PrimitiveDescriptor primitive_307 = {
-		"primitiveNew2IfFail:", primitiveFunctionType(&BehaviorPrimitives::allocate2), 1376257, signature_307, errors_307
+		"primitiveMixinIsInstalled:ifFail:", primitiveFunctionType(&MixinOopPrimitives::is_installed), 327681, signature_307, errors_307
 };
 
-static const char *signature_308[] = {"Instance", "Behavior", "Boolean"};
+static const char *signature_308[] = {"SmallInteger", "Mixin"};
 static const char *errors_308[] = {nullptr};
 static PrimitiveDescriptor primitive_308 = {
-		"primitiveNew3:ifFail:", primitiveFunctionType(&primitiveNew3), 7667714, signature_308, errors_308
+		"primitiveMixinNumberOfClassVariablesOf:ifFail:", primitiveFunctionType(&MixinOopPrimitives::number_of_class_variables), 327681, signature_308, errors_308
 };
 
-static const char *signature_309[] = {"Instance", "Behavior", "Boolean"};
+static const char *signature_309[] = {"SmallInteger", "Mixin"};
 static const char *errors_309[] = {nullptr};
 static PrimitiveDescriptor primitive_309 = {
-		"primitiveNew4:ifFail:", primitiveFunctionType(&primitiveNew4), 7667714, signature_309, errors_309
+		"primitiveMixinNumberOfInstanceVariablesOf:ifFail:", primitiveFunctionType(&MixinOopPrimitives::number_of_instance_variables), 327681, signature_309, errors_309
 };
 
-static const char *signature_310[] = {"Instance", "Behavior", "Boolean"};
+static const char *signature_310[] = {"SmallInteger", "Mixin"};
 static const char *errors_310[] = {nullptr};
 static PrimitiveDescriptor primitive_310 = {
-		"primitiveNew5:ifFail:", primitiveFunctionType(&primitiveNew5), 7667714, signature_310, errors_310
+		"primitiveMixinNumberOfMethodsOf:ifFail:", primitiveFunctionType(&MixinOopPrimitives::number_of_methods), 327681, signature_310, errors_310
 };
 
-static const char *signature_311[] = {"Instance", "Behavior", "Boolean"};
+static const char *signature_311[] = {"Class", "Mixin"};
 static const char *errors_311[] = {nullptr};
 static PrimitiveDescriptor primitive_311 = {
-		"primitiveNew6:ifFail:", primitiveFunctionType(&primitiveNew6), 7667714, signature_311, errors_311
+		"primitiveMixinPrimaryInvocationOf:ifFail:", primitiveFunctionType(&MixinOopPrimitives::primary_invocation), 327681, signature_311, errors_311
 };
 
-static const char *signature_312[] = {"Instance", "Behavior", "Boolean"};
-static const char *errors_312[] = {nullptr};
+static const char *signature_312[] = {"Mixin", "Mixin", "Mixin"};
+static const char *errors_312[] = {"IsInstalled", nullptr};
 static PrimitiveDescriptor primitive_312 = {
-		"primitiveNew7:ifFail:", primitiveFunctionType(&primitiveNew7), 7667714, signature_312, errors_312
+		"primitiveMixinSetClassMixinOf:to:ifFail:", primitiveFunctionType(&MixinOopPrimitives::set_class_mixin), 327682, signature_312, errors_312
 };
 
-static const char *signature_313[] = {"Instance", "Behavior", "Boolean"};
+static const char *signature_313[] = {"Boolean", "Mixin"};
 static const char *errors_313[] = {nullptr};
 static PrimitiveDescriptor primitive_313 = {
-		"primitiveNew8:ifFail:", primitiveFunctionType(&primitiveNew8), 7667714, signature_313, errors_313
+		"primitiveMixinSetInstalled:ifFail:", primitiveFunctionType(&MixinOopPrimitives::set_installed), 327681, signature_313, errors_313
 };
 
-static const char *signature_314[] = {"Instance", "Behavior", "Boolean"};
-static const char *errors_314[] = {nullptr};
+static const char *signature_314[] = {"Class", "Mixin", "Class"};
+static const char *errors_314[] = {"IsInstalled", nullptr};
 static PrimitiveDescriptor primitive_314 = {
-		"primitiveNew9:ifFail:", primitiveFunctionType(&primitiveNew9), 7667714, signature_314, errors_314
+		"primitiveMixinSetPrimaryInvocationOf:to:ifFail:", primitiveFunctionType(&MixinOopPrimitives::set_primary_invocation), 327682, signature_314, errors_314
 };
 
-static const char *signature_315[] = {"Instance", "Behavior", "Boolean"};
-static const char *errors_315[] = {"ReceiverIsIndexable", nullptr};
+static const char *signature_315[] = {"Boolean", "Mixin"};
+static const char *errors_315[] = {nullptr};
 static PrimitiveDescriptor primitive_315 = {
-		"primitiveNew:tenured:ifFail:", primitiveFunctionType(&BehaviorPrimitives::allocate3), 327682, signature_315, errors_315
+		"primitiveMixinSetUnInstalled:ifFail:", primitiveFunctionType(&MixinOopPrimitives::set_uninstalled), 327681, signature_315, errors_315
 };
 
-static const char *signature_316[] = {"Instance", "Behavior"};
-static const char *errors_316[] = {"ReceiverIsIndexable", nullptr};
+static const char *signature_316[] = {"SmallInteger", "SmallInteger", "SmallInteger"};
+static const char *errors_316[] = {"Overflow", "DivisionByZero", nullptr};
 static PrimitiveDescriptor primitive_316 = {
-		"primitiveNewIfFail:", primitiveFunctionType(&BehaviorPrimitives::allocate), 1376257, signature_316, errors_316
+		"primitiveMod:ifFail:", primitiveFunctionType(&smiOopPrimitives_mod), 6029826, signature_316, errors_316
 };
 
-static const char *signature_317[] = {"Boolean", "Object", "Object"};
-static const char *errors_317[] = {nullptr};
+static const char *signature_317[] = {"SmallInteger", "SmallInteger", "SmallInteger"};
+static const char *errors_317[] = {"Overflow", nullptr};
 static PrimitiveDescriptor primitive_317 = {
-		"primitiveNotEqual:", primitiveFunctionType(&OopPrimitives::not_equal), 1572866, signature_317, errors_317
+		"primitiveMultiply:ifFail:", primitiveFunctionType(&smiOopPrimitives_multiply), 6029826, signature_317, errors_317
 };
 
-static const char *signature_318[] = {"Object"};
-static const char *errors_318[] = {"EmptyQueue", nullptr};
+static const char *signature_318[] = {"Instance", "Behavior", "Boolean"};
+static const char *errors_318[] = {nullptr};
 static PrimitiveDescriptor primitive_318 = {
-		"primitiveNotificationQueueGetIfFail:", primitiveFunctionType(&SystemPrimitives::notificationQueueGet), 327680, signature_318, errors_318
+		"primitiveNew0:ifFail:", primitiveFunctionType(&primitiveNew0), 7667714, signature_318, errors_318
 };
 
-static const char *signature_319[] = {"Object", "Object"};
+static const char *signature_319[] = {"Instance", "Behavior", "Boolean"};
 static const char *errors_319[] = {nullptr};
 static PrimitiveDescriptor primitive_319 = {
-		"primitiveNotificationQueuePut:", primitiveFunctionType(&SystemPrimitives::notificationQueuePut), 65537, signature_319, errors_319
+		"primitiveNew1:ifFail:", primitiveFunctionType(&primitiveNew1), 7667714, signature_319, errors_319
 };
 
-static const char *signature_320[] = {"SmallInteger"};
+static const char *signature_320[] = {"Instance", "Behavior", "Boolean"};
 static const char *errors_320[] = {nullptr};
 static PrimitiveDescriptor primitive_320 = {
-		"primitiveNumberOfLookupCacheMisses", primitiveFunctionType(&DebugPrimitives::numberOfLookupCacheMisses), 65536, signature_320, errors_320
+		"primitiveNew2:ifFail:", primitiveFunctionType(&primitiveNew2), 7667714, signature_320, errors_320
 };
 
-static const char *signature_321[] = {"SmallInteger"};
-static const char *errors_321[] = {nullptr};
+static const char *signature_321[] = {"Instance", "Behavior"};
+static const char *errors_321[] = {"ReceiverIsIndexable", nullptr};
 static PrimitiveDescriptor primitive_321 = {
-		"primitiveNumberOfMethodInvocations", primitiveFunctionType(&DebugPrimitives::numberOfMethodInvocations), 65536, signature_321, errors_321
+		"primitiveNew2IfFail:", primitiveFunctionType(&BehaviorPrimitives::allocate2), 1376257, signature_321, errors_321
 };
 
-static const char *signature_322[] = {"SmallInteger"};
+static const char *signature_322[] = {"Instance", "Behavior", "Boolean"};
 static const char *errors_322[] = {nullptr};
 static PrimitiveDescriptor primitive_322 = {
-		"primitiveNumberOfNativeMethodInvocations", primitiveFunctionType(&DebugPrimitives::numberOfNativeMethodInvocations), 65536, signature_322, errors_322
+		"primitiveNew3:ifFail:", primitiveFunctionType(&primitiveNew3), 7667714, signature_322, errors_322
 };
 
-static const char *signature_323[] = {"SmallInteger"};
+static const char *signature_323[] = {"Instance", "Behavior", "Boolean"};
 static const char *errors_323[] = {nullptr};
 static PrimitiveDescriptor primitive_323 = {
-		"primitiveNumberOfPrimaryLookupCacheHits", primitiveFunctionType(&DebugPrimitives::numberOfPrimaryLookupCacheHits), 65536, signature_323, errors_323
+		"primitiveNew4:ifFail:", primitiveFunctionType(&primitiveNew4), 7667714, signature_323, errors_323
 };
 
-static const char *signature_324[] = {"SmallInteger"};
+static const char *signature_324[] = {"Instance", "Behavior", "Boolean"};
 static const char *errors_324[] = {nullptr};
 static PrimitiveDescriptor primitive_324 = {
-		"primitiveNumberOfSecondaryLookupCacheHits", primitiveFunctionType(&DebugPrimitives::numberOfSecondaryLookupCacheHits), 65536, signature_324, errors_324
+		"primitiveNew5:ifFail:", primitiveFunctionType(&primitiveNew5), 7667714, signature_324, errors_324
 };
 
-static const char *signature_325[] = {"SmallInteger"};
+static const char *signature_325[] = {"Instance", "Behavior", "Boolean"};
 static const char *errors_325[] = {nullptr};
 static PrimitiveDescriptor primitive_325 = {
-		"primitiveNurseryFreeSpace", primitiveFunctionType(&SystemPrimitives::nurseryFreeSpace), 65536, signature_325, errors_325
+		"primitiveNew6:ifFail:", primitiveFunctionType(&primitiveNew6), 7667714, signature_325, errors_325
 };
 
-static const char *signature_326[] = {"Float"};
+static const char *signature_326[] = {"Instance", "Behavior", "Boolean"};
 static const char *errors_326[] = {nullptr};
 static PrimitiveDescriptor primitive_326 = {
-		"primitiveObjectMemorySize", primitiveFunctionType(&SystemPrimitives::object_memory_size), 65536, signature_326, errors_326
+		"primitiveNew7:ifFail:", primitiveFunctionType(&primitiveNew7), 7667714, signature_326, errors_326
 };
 
-static const char *signature_327[] = {"SmallInteger", "Object"};
+static const char *signature_327[] = {"Instance", "Behavior", "Boolean"};
 static const char *errors_327[] = {nullptr};
 static PrimitiveDescriptor primitive_327 = {
-		"primitiveOopSize", primitiveFunctionType(&OopPrimitives::oop_size), 1572865, signature_327, errors_327
+		"primitiveNew8:ifFail:", primitiveFunctionType(&primitiveNew8), 7667714, signature_327, errors_327
 };
 
-static const char *signature_328[] = {"Object", "Object", "Symbol"};
-static const char *errors_328[] = {"NotFound", nullptr};
+static const char *signature_328[] = {"Instance", "Behavior", "Boolean"};
+static const char *errors_328[] = {nullptr};
 static PrimitiveDescriptor primitive_328 = {
-		"primitiveOptimizeMethod:ifFail:", primitiveFunctionType(&DebugPrimitives::optimizeMethod), 1376258, signature_328, errors_328
+		"primitiveNew9:ifFail:", primitiveFunctionType(&primitiveNew9), 7667714, signature_328, errors_328
 };
 
-static const char *signature_329[] = {"Object", "Object", "CompressedSymbol", "Array"};
-static const char *errors_329[] = {"SelectorHasWrongNumberOfArguments", nullptr};
+static const char *signature_329[] = {"Instance", "Behavior", "Boolean"};
+static const char *errors_329[] = {"ReceiverIsIndexable", nullptr};
 static PrimitiveDescriptor primitive_329 = {
-		"primitivePerform:arguments:ifFail:", primitiveFunctionType(&OopPrimitives::performArguments), 1507331, signature_329, errors_329
+		"primitiveNew:tenured:ifFail:", primitiveFunctionType(&BehaviorPrimitives::allocate3), 327682, signature_329, errors_329
 };
 
-static const char *signature_330[] = {"Object", "Object", "CompressedSymbol"};
-static const char *errors_330[] = {"SelectorHasWrongNumberOfArguments", nullptr};
+static const char *signature_330[] = {"Instance", "Behavior"};
+static const char *errors_330[] = {"ReceiverIsIndexable", nullptr};
 static PrimitiveDescriptor primitive_330 = {
-		"primitivePerform:ifFail:", primitiveFunctionType(&OopPrimitives::perform), 1376258, signature_330, errors_330
+		"primitiveNewIfFail:", primitiveFunctionType(&BehaviorPrimitives::allocate), 1376257, signature_330, errors_330
 };
 
-static const char *signature_331[] = {"Object", "Object", "CompressedSymbol", "Object"};
-static const char *errors_331[] = {"SelectorHasWrongNumberOfArguments", nullptr};
+static const char *signature_331[] = {"Boolean", "Object", "Object"};
+static const char *errors_331[] = {nullptr};
 static PrimitiveDescriptor primitive_331 = {
-		"primitivePerform:with:ifFail:", primitiveFunctionType(&OopPrimitives::performWith), 1507331, signature_331, errors_331
+		"primitiveNotEqual:", primitiveFunctionType(&OopPrimitives::not_equal), 1572866, signature_331, errors_331
 };
 
-static const char *signature_332[] = {"Object", "Object", "CompressedSymbol", "Object", "Object"};
-static const char *errors_332[] = {"SelectorHasWrongNumberOfArguments", nullptr};
+static const char *signature_332[] = {"Object"};
+static const char *errors_332[] = {"EmptyQueue", nullptr};
 static PrimitiveDescriptor primitive_332 = {
-		"primitivePerform:with:with:ifFail:", primitiveFunctionType(&OopPrimitives::performWithWith), 1507332, signature_332, errors_332
+		"primitiveNotificationQueueGetIfFail:", primitiveFunctionType(&SystemPrimitives::notificationQueueGet), 327680, signature_332, errors_332
 };
 
-static const char *signature_333[] = {"Object", "Object", "CompressedSymbol", "Object", "Object", "Object"};
-static const char *errors_333[] = {"SelectorHasWrongNumberOfArguments", nullptr};
+static const char *signature_333[] = {"Object", "Object"};
+static const char *errors_333[] = {nullptr};
 static PrimitiveDescriptor primitive_333 = {
-		"primitivePerform:with:with:with:ifFail:", primitiveFunctionType(&OopPrimitives::performWithWithWith), 1507333, signature_333, errors_333
+		"primitiveNotificationQueuePut:", primitiveFunctionType(&SystemPrimitives::notificationQueuePut), 65537, signature_333, errors_333
 };
 
-static const char *signature_334[] = {"Self", "Object"};
+static const char *signature_334[] = {"SmallInteger"};
 static const char *errors_334[] = {nullptr};
 static PrimitiveDescriptor primitive_334 = {
-		"primitivePrint", primitiveFunctionType(&OopPrimitives::print), 1114113, signature_334, errors_334
+		"primitiveNumberOfLookupCacheMisses", primitiveFunctionType(&DebugPrimitives::numberOfLookupCacheMisses), 65536, signature_334, errors_334
 };
 
-static const char *signature_335[] = {"SmallInteger", "SmallInteger"};
-static const char *errors_335[] = {"OutOfBounds", nullptr};
+static const char *signature_335[] = {"SmallInteger"};
+static const char *errors_335[] = {nullptr};
 static PrimitiveDescriptor primitive_335 = {
-		"primitivePrintCharacterIfFail:", primitiveFunctionType(&SmallIntegerOopPrimitives::printCharacter), 1310721, signature_335, errors_335
+		"primitiveNumberOfMethodInvocations", primitiveFunctionType(&DebugPrimitives::numberOfMethodInvocations), 65536, signature_335, errors_335
 };
 
-static const char *signature_336[] = {"Object", "SmallInteger"};
+static const char *signature_336[] = {"SmallInteger"};
 static const char *errors_336[] = {nullptr};
 static PrimitiveDescriptor primitive_336 = {
-		"primitivePrintInvocationCounterHistogram:ifFail:", primitiveFunctionType(&DebugPrimitives::printInvocationCounterHistogram), 327681, signature_336, errors_336
+		"primitiveNumberOfNativeMethodInvocations", primitiveFunctionType(&DebugPrimitives::numberOfNativeMethodInvocations), 65536, signature_336, errors_336
 };
 
-static const char *signature_337[] = {"Object"};
+static const char *signature_337[] = {"SmallInteger"};
 static const char *errors_337[] = {nullptr};
 static PrimitiveDescriptor primitive_337 = {
-		"primitivePrintLayout", primitiveFunctionType(&DebugPrimitives::printMemoryLayout), 65536, signature_337, errors_337
+		"primitiveNumberOfPrimaryLookupCacheHits", primitiveFunctionType(&DebugPrimitives::numberOfPrimaryLookupCacheHits), 65536, signature_337, errors_337
 };
 
-static const char *signature_338[] = {"Object"};
+static const char *signature_338[] = {"SmallInteger"};
 static const char *errors_338[] = {nullptr};
 static PrimitiveDescriptor primitive_338 = {
-		"primitivePrintLookupCacheStatistics", primitiveFunctionType(&DebugPrimitives::printLookupCacheStatistics), 65536, signature_338, errors_338
+		"primitiveNumberOfSecondaryLookupCacheHits", primitiveFunctionType(&DebugPrimitives::numberOfSecondaryLookupCacheHits), 65536, signature_338, errors_338
 };
 
-static const char *signature_339[] = {"Object"};
+static const char *signature_339[] = {"SmallInteger"};
 static const char *errors_339[] = {nullptr};
 static PrimitiveDescriptor primitive_339 = {
-		"primitivePrintMemory", primitiveFunctionType(&SystemPrimitives::print_memory), 65536, signature_339, errors_339
+		"primitiveNurseryFreeSpace", primitiveFunctionType(&SystemPrimitives::nurseryFreeSpace), 65536, signature_339, errors_339
 };
 
-static const char *signature_340[] = {"Behavior", "Behavior", "ByteArray"};
+static const char *signature_340[] = {"Float"};
 static const char *errors_340[] = {nullptr};
 static PrimitiveDescriptor primitive_340 = {
-		"primitivePrintMethod:ifFail:", primitiveFunctionType(&BehaviorPrimitives::printMethod), 1376258, signature_340, errors_340
+		"primitiveObjectMemorySize", primitiveFunctionType(&SystemPrimitives::object_memory_size), 65536, signature_340, errors_340
 };
 
-static const char *signature_341[] = {"Object", "Object", "Symbol"};
-static const char *errors_341[] = {"NotFound", nullptr};
+static const char *signature_341[] = {"SmallInteger", "Object"};
+static const char *errors_341[] = {nullptr};
 static PrimitiveDescriptor primitive_341 = {
-		"primitivePrintMethodCodes:ifFail:", primitiveFunctionType(&DebugPrimitives::printMethodCodes), 1376258, signature_341, errors_341
+		"primitiveOopSize", primitiveFunctionType(&OopPrimitives::oop_size), 1572865, signature_341, errors_341
 };
 
-static const char *signature_342[] = {"Object", "SmallInteger"};
-static const char *errors_342[] = {nullptr};
+static const char *signature_342[] = {"Object", "Object", "Symbol"};
+static const char *errors_342[] = {"NotFound", nullptr};
 static PrimitiveDescriptor primitive_342 = {
-		"primitivePrintNativeMethodCounterHistogram:ifFail:", primitiveFunctionType(&DebugPrimitives::printNativeMethodCounterHistogram), 327681, signature_342, errors_342
+		"primitiveOptimizeMethod:ifFail:", primitiveFunctionType(&DebugPrimitives::optimizeMethod), 1376258, signature_342, errors_342
 };
 
-static const char *signature_343[] = {"Object"};
-static const char *errors_343[] = {nullptr};
+static const char *signature_343[] = {"Object", "Object", "CompressedSymbol", "Array"};
+static const char *errors_343[] = {"SelectorHasWrongNumberOfArguments", nullptr};
 static PrimitiveDescriptor primitive_343 = {
-		"primitivePrintObjectHistogram", primitiveFunctionType(&DebugPrimitives::printObjectHistogram), 65536, signature_343, errors_343
+		"primitivePerform:arguments:ifFail:", primitiveFunctionType(&OopPrimitives::performArguments), 1507331, signature_343, errors_343
 };
 
-static const char *signature_344[] = {"Object"};
-static const char *errors_344[] = {nullptr};
+static const char *signature_344[] = {"Object", "Object", "CompressedSymbol"};
+static const char *errors_344[] = {"SelectorHasWrongNumberOfArguments", nullptr};
 static PrimitiveDescriptor primitive_344 = {
-		"primitivePrintPrimitiveCounters", primitiveFunctionType(&DebugPrimitives::printPrimitiveCounters), 65536, signature_344, errors_344
+		"primitivePerform:ifFail:", primitiveFunctionType(&OopPrimitives::perform), 1376258, signature_344, errors_344
 };
 
-static const char *signature_345[] = {"Object"};
-static const char *errors_345[] = {nullptr};
+static const char *signature_345[] = {"Object", "Object", "CompressedSymbol", "Object"};
+static const char *errors_345[] = {"SelectorHasWrongNumberOfArguments", nullptr};
 static PrimitiveDescriptor primitive_345 = {
-		"primitivePrintPrimitiveTable", primitiveFunctionType(&SystemPrimitives::printPrimitiveTable), 65536, signature_345, errors_345
+		"primitivePerform:with:ifFail:", primitiveFunctionType(&OopPrimitives::performWith), 1507331, signature_345, errors_345
 };
 
-static const char *signature_346[] = {"Self", "Object"};
-static const char *errors_346[] = {nullptr};
+static const char *signature_346[] = {"Object", "Object", "CompressedSymbol", "Object", "Object"};
+static const char *errors_346[] = {"SelectorHasWrongNumberOfArguments", nullptr};
 static PrimitiveDescriptor primitive_346 = {
-		"primitivePrintValue", primitiveFunctionType(&OopPrimitives::printValue), 1114113, signature_346, errors_346
+		"primitivePerform:with:with:ifFail:", primitiveFunctionType(&OopPrimitives::performWithWith), 1507332, signature_346, errors_346
 };
 
-static const char *signature_347[] = {"Object"};
-static const char *errors_347[] = {nullptr};
+static const char *signature_347[] = {"Object", "Object", "CompressedSymbol", "Object", "Object", "Object"};
+static const char *errors_347[] = {"SelectorHasWrongNumberOfArguments", nullptr};
 static PrimitiveDescriptor primitive_347 = {
-		"primitivePrintZone", primitiveFunctionType(&SystemPrimitives::print_zone), 65536, signature_347, errors_347
+		"primitivePerform:with:with:with:ifFail:", primitiveFunctionType(&OopPrimitives::performWithWithWith), 1507333, signature_347, errors_347
 };
 
-static const char *signature_348[] = {"Object"};
+static const char *signature_348[] = {"Self", "Object"};
 static const char *errors_348[] = {nullptr};
 static PrimitiveDescriptor primitive_348 = {
-		"primitiveProcessActiveProcess", primitiveFunctionType(&ProcessOopPrimitives::activeProcess), 65536, signature_348, errors_348
+		"primitivePrint", primitiveFunctionType(&OopPrimitives::print), 1114113, signature_348, errors_348
 };
 
-static const char *signature_349[] = {"Process", "Process class", "BlockWithoutArguments"};
-static const char *errors_349[] = {"ProcessAllocationFailed", nullptr};
+static const char *signature_349[] = {"SmallInteger", "SmallInteger"};
+static const char *errors_349[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_349 = {
-		"primitiveProcessCreate:ifFail:", primitiveFunctionType(&ProcessOopPrimitives::create), 1376258, signature_349, errors_349
+		"primitivePrintCharacterIfFail:", primitiveFunctionType(&SmallIntegerOopPrimitives::printCharacter), 1310721, signature_349, errors_349
 };
 
-static const char *signature_350[] = {"Process"};
+static const char *signature_350[] = {"Object", "SmallInteger"};
 static const char *errors_350[] = {nullptr};
 static PrimitiveDescriptor primitive_350 = {
-		"primitiveProcessEnterCritical", primitiveFunctionType(&ProcessOopPrimitives::enter_critical), 65536, signature_350, errors_350
+		"primitivePrintInvocationCounterHistogram:ifFail:", primitiveFunctionType(&DebugPrimitives::printInvocationCounterHistogram), 327681, signature_350, errors_350
 };
 
-static const char *signature_351[] = {"Process"};
+static const char *signature_351[] = {"Object"};
 static const char *errors_351[] = {nullptr};
 static PrimitiveDescriptor primitive_351 = {
-		"primitiveProcessLeaveCritical", primitiveFunctionType(&ProcessOopPrimitives::leave_critical), 65536, signature_351, errors_351
+		"primitivePrintLayout", primitiveFunctionType(&DebugPrimitives::printMemoryLayout), 65536, signature_351, errors_351
 };
 
-static const char *signature_352[] = {"Boolean", "Process", "SmallInteger"};
+static const char *signature_352[] = {"Object"};
 static const char *errors_352[] = {nullptr};
 static PrimitiveDescriptor primitive_352 = {
-		"primitiveProcessSchedulerWait:ifFail:", primitiveFunctionType(&ProcessOopPrimitives::scheduler_wait), 1376258, signature_352, errors_352
+		"primitivePrintLookupCacheStatistics", primitiveFunctionType(&DebugPrimitives::printLookupCacheStatistics), 65536, signature_352, errors_352
 };
 
-static const char *signature_353[] = {"Symbol", "Process", "Symbol", "Activation", "Object"};
-static const char *errors_353[] = {"InScheduler", "Dead", nullptr};
+static const char *signature_353[] = {"Object"};
+static const char *errors_353[] = {nullptr};
 static PrimitiveDescriptor primitive_353 = {
-		"primitiveProcessSetMode:activation:returnValue:ifFail:", primitiveFunctionType(&ProcessOopPrimitives::set_mode), 1376260, signature_353, errors_353
+		"primitivePrintMemory", primitiveFunctionType(&SystemPrimitives::print_memory), 65536, signature_353, errors_353
 };
 
-static const char *signature_354[] = {"IndexedInstanceVariables", "Process", "SmallInteger"};
+static const char *signature_354[] = {"Behavior", "Behavior", "ByteArray"};
 static const char *errors_354[] = {nullptr};
 static PrimitiveDescriptor primitive_354 = {
-		"primitiveProcessStackLimit:ifFail:", primitiveFunctionType(&ProcessOopPrimitives::stack), 1376258, signature_354, errors_354
+		"primitivePrintMethod:ifFail:", primitiveFunctionType(&BehaviorPrimitives::printMethod), 1376258, signature_354, errors_354
 };
 
-static const char *signature_355[] = {"Object", "Process"};
-static const char *errors_355[] = {"NotInScheduler", "ProcessCannotContinue", "Dead", nullptr};
+static const char *signature_355[] = {"Object", "Object", "Symbol"};
+static const char *errors_355[] = {"NotFound", nullptr};
 static PrimitiveDescriptor primitive_355 = {
-		"primitiveProcessStartEvaluator:ifFail:", primitiveFunctionType(&ProcessOopPrimitives::start_evaluator), 327681, signature_355, errors_355
+		"primitivePrintMethodCodes:ifFail:", primitiveFunctionType(&DebugPrimitives::printMethodCodes), 1376258, signature_355, errors_355
 };
 
-static const char *signature_356[] = {"Symbol", "Process"};
+static const char *signature_356[] = {"Object", "SmallInteger"};
 static const char *errors_356[] = {nullptr};
 static PrimitiveDescriptor primitive_356 = {
-		"primitiveProcessStatus", primitiveFunctionType(&ProcessOopPrimitives::status), 1114113, signature_356, errors_356
+		"primitivePrintNativeMethodCounterHistogram:ifFail:", primitiveFunctionType(&DebugPrimitives::printNativeMethodCounterHistogram), 327681, signature_356, errors_356
 };
 
-static const char *signature_357[] = {"Process"};
+static const char *signature_357[] = {"Object"};
 static const char *errors_357[] = {nullptr};
 static PrimitiveDescriptor primitive_357 = {
-		"primitiveProcessStop", primitiveFunctionType(&ProcessOopPrimitives::stop), 65536, signature_357, errors_357
+		"primitivePrintObjectHistogram", primitiveFunctionType(&DebugPrimitives::printObjectHistogram), 65536, signature_357, errors_357
 };
 
-static const char *signature_358[] = {"Float", "Process"};
+static const char *signature_358[] = {"Object"};
 static const char *errors_358[] = {nullptr};
 static PrimitiveDescriptor primitive_358 = {
-		"primitiveProcessSystemTime", primitiveFunctionType(&ProcessOopPrimitives::user_time), 1114113, signature_358, errors_358
+		"primitivePrintPrimitiveCounters", primitiveFunctionType(&DebugPrimitives::printPrimitiveCounters), 65536, signature_358, errors_358
 };
 
-static const char *signature_359[] = {"Self", "Process"};
-static const char *errors_359[] = {"Dead", nullptr};
+static const char *signature_359[] = {"Object"};
+static const char *errors_359[] = {nullptr};
 static PrimitiveDescriptor primitive_359 = {
-		"primitiveProcessTerminateIfFail:", primitiveFunctionType(&ProcessOopPrimitives::terminate), 1507329, signature_359, errors_359
+		"primitivePrintPrimitiveTable", primitiveFunctionType(&SystemPrimitives::printPrimitiveTable), 65536, signature_359, errors_359
 };
 
-static const char *signature_360[] = {"Self", "Process", "SmallInteger"};
+static const char *signature_360[] = {"Self", "Object"};
 static const char *errors_360[] = {nullptr};
 static PrimitiveDescriptor primitive_360 = {
-		"primitiveProcessTraceStack:ifFail:", primitiveFunctionType(&ProcessOopPrimitives::trace_stack), 1376258, signature_360, errors_360
+		"primitivePrintValue", primitiveFunctionType(&OopPrimitives::printValue), 1114113, signature_360, errors_360
 };
 
-static const char *signature_361[] = {"Object", "Process"};
-static const char *errors_361[] = {"NotInScheduler", "ProcessCannotContinue", "Dead", nullptr};
+static const char *signature_361[] = {"Object"};
+static const char *errors_361[] = {nullptr};
 static PrimitiveDescriptor primitive_361 = {
-		"primitiveProcessTransferTo:ifFail:", primitiveFunctionType(&ProcessOopPrimitives::transferTo), 327681, signature_361, errors_361
+		"primitivePrintZone", primitiveFunctionType(&SystemPrimitives::print_zone), 65536, signature_361, errors_361
 };
 
-static const char *signature_362[] = {"Float", "Process"};
+static const char *signature_362[] = {"Object"};
 static const char *errors_362[] = {nullptr};
 static PrimitiveDescriptor primitive_362 = {
-		"primitiveProcessUserTime", primitiveFunctionType(&ProcessOopPrimitives::user_time), 1114113, signature_362, errors_362
+		"primitiveProcessActiveProcess", primitiveFunctionType(&ProcessOopPrimitives::activeProcess), 65536, signature_362, errors_362
 };
 
-static const char *signature_363[] = {"Process"};
-static const char *errors_363[] = {nullptr};
+static const char *signature_363[] = {"Process", "Process class", "BlockWithoutArguments"};
+static const char *errors_363[] = {"ProcessAllocationFailed", nullptr};
 static PrimitiveDescriptor primitive_363 = {
-		"primitiveProcessYield", primitiveFunctionType(&ProcessOopPrimitives::yield), 65536, signature_363, errors_363
+		"primitiveProcessCreate:ifFail:", primitiveFunctionType(&ProcessOopPrimitives::create), 1376258, signature_363, errors_363
 };
 
 static const char *signature_364[] = {"Process"};
 static const char *errors_364[] = {nullptr};
 static PrimitiveDescriptor primitive_364 = {
-		"primitiveProcessYieldInCritical", primitiveFunctionType(&ProcessOopPrimitives::yield_in_critical), 65536, signature_364, errors_364
+		"primitiveProcessEnterCritical", primitiveFunctionType(&ProcessOopPrimitives::enter_critical), 65536, signature_364, errors_364
 };
 
-static const char *signature_365[] = {"SmallInteger", "Proxy", "SmallInteger"};
+static const char *signature_365[] = {"Process"};
 static const char *errors_365[] = {nullptr};
 static PrimitiveDescriptor primitive_365 = {
-		"primitiveProxyByteAt:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::byteAt), 5570562, signature_365, errors_365
+		"primitiveProcessLeaveCritical", primitiveFunctionType(&ProcessOopPrimitives::leave_critical), 65536, signature_365, errors_365
 };
 
-static const char *signature_366[] = {"SmallInteger", "Proxy", "SmallInteger", "SmallInteger"};
+static const char *signature_366[] = {"Boolean", "Process", "SmallInteger"};
 static const char *errors_366[] = {nullptr};
 static PrimitiveDescriptor primitive_366 = {
-		"primitiveProxyByteAt:put:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::byteAtPut), 5570563, signature_366, errors_366
+		"primitiveProcessSchedulerWait:ifFail:", primitiveFunctionType(&ProcessOopPrimitives::scheduler_wait), 1376258, signature_366, errors_366
 };
 
-static const char *signature_367[] = {"Self", "Proxy", "SmallInteger"};
-static const char *errors_367[] = {nullptr};
+static const char *signature_367[] = {"Symbol", "Process", "Symbol", "Activation", "Object"};
+static const char *errors_367[] = {"InScheduler", "Dead", nullptr};
 static PrimitiveDescriptor primitive_367 = {
-		"primitiveProxyCalloc:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::calloc), 1376258, signature_367, errors_367
+		"primitiveProcessSetMode:activation:returnValue:ifFail:", primitiveFunctionType(&ProcessOopPrimitives::set_mode), 1376260, signature_367, errors_367
 };
 
-static const char *signature_368[] = {"SmallInteger", "Proxy", "SmallInteger"};
+static const char *signature_368[] = {"IndexedInstanceVariables", "Process", "SmallInteger"};
 static const char *errors_368[] = {nullptr};
 static PrimitiveDescriptor primitive_368 = {
-		"primitiveProxyDoubleByteAt:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::doubleByteAt), 1376258, signature_368, errors_368
+		"primitiveProcessStackLimit:ifFail:", primitiveFunctionType(&ProcessOopPrimitives::stack), 1376258, signature_368, errors_368
 };
 
-static const char *signature_369[] = {"SmallInteger", "Proxy", "SmallInteger", "SmallInteger"};
-static const char *errors_369[] = {nullptr};
+static const char *signature_369[] = {"Object", "Process"};
+static const char *errors_369[] = {"NotInScheduler", "ProcessCannotContinue", "Dead", nullptr};
 static PrimitiveDescriptor primitive_369 = {
-		"primitiveProxyDoubleByteAt:put:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::doubleByteAtPut), 1376259, signature_369, errors_369
+		"primitiveProcessStartEvaluator:ifFail:", primitiveFunctionType(&ProcessOopPrimitives::start_evaluator), 327681, signature_369, errors_369
 };
 
-static const char *signature_370[] = {"Float", "Proxy", "SmallInteger"};
+static const char *signature_370[] = {"Symbol", "Process"};
 static const char *errors_370[] = {nullptr};
 static PrimitiveDescriptor primitive_370 = {
-		"primitiveProxyDoublePrecisionFloatAt:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::doublePrecisionFloatAt), 1376258, signature_370, errors_370
+		"primitiveProcessStatus", primitiveFunctionType(&ProcessOopPrimitives::status), 1114113, signature_370, errors_370
 };
 
-static const char *signature_371[] = {"Self", "Proxy", "SmallInteger", "Float"};
-static const char *errors_371[] = {"ConversionFailed", nullptr};
+static const char *signature_371[] = {"Process"};
+static const char *errors_371[] = {nullptr};
 static PrimitiveDescriptor primitive_371 = {
-		"primitiveProxyDoublePrecisionFloatAt:put:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::doublePrecisionFloatAtPut), 1376259, signature_371, errors_371
+		"primitiveProcessStop", primitiveFunctionType(&ProcessOopPrimitives::stop), 65536, signature_371, errors_371
 };
 
-static const char *signature_372[] = {"Self", "Proxy"};
+static const char *signature_372[] = {"Float", "Process"};
 static const char *errors_372[] = {nullptr};
 static PrimitiveDescriptor primitive_372 = {
-		"primitiveProxyFree", primitiveFunctionType(&ProxyOopPrimitives::free), 1114113, signature_372, errors_372
+		"primitiveProcessSystemTime", primitiveFunctionType(&ProcessOopPrimitives::user_time), 1114113, signature_372, errors_372
 };
 
-static const char *signature_373[] = {"SmallInteger", "Proxy"};
-static const char *errors_373[] = {nullptr};
+static const char *signature_373[] = {"Self", "Process"};
+static const char *errors_373[] = {"Dead", nullptr};
 static PrimitiveDescriptor primitive_373 = {
-		"primitiveProxyGetHigh", primitiveFunctionType(&ProxyOopPrimitives::getHigh), 1114113, signature_373, errors_373
+		"primitiveProcessTerminateIfFail:", primitiveFunctionType(&ProcessOopPrimitives::terminate), 1507329, signature_373, errors_373
 };
 
-static const char *signature_374[] = {"SmallInteger", "Proxy"};
-static const char *errors_374[] = {"ConversionFailed", nullptr};
+static const char *signature_374[] = {"Self", "Process", "SmallInteger"};
+static const char *errors_374[] = {nullptr};
 static PrimitiveDescriptor primitive_374 = {
-		"primitiveProxyGetIfFail:", primitiveFunctionType(&ProxyOopPrimitives::getSmi), 1376257, signature_374, errors_374
+		"primitiveProcessTraceStack:ifFail:", primitiveFunctionType(&ProcessOopPrimitives::trace_stack), 1376258, signature_374, errors_374
 };
 
-static const char *signature_375[] = {"SmallInteger", "Proxy"};
-static const char *errors_375[] = {nullptr};
+static const char *signature_375[] = {"Object", "Process"};
+static const char *errors_375[] = {"NotInScheduler", "ProcessCannotContinue", "Dead", nullptr};
 static PrimitiveDescriptor primitive_375 = {
-		"primitiveProxyGetLow", primitiveFunctionType(&ProxyOopPrimitives::getLow), 1114113, signature_375, errors_375
+		"primitiveProcessTransferTo:ifFail:", primitiveFunctionType(&ProcessOopPrimitives::transferTo), 327681, signature_375, errors_375
 };
 
-static const char *signature_376[] = {"Boolean", "Proxy"};
+static const char *signature_376[] = {"Float", "Process"};
 static const char *errors_376[] = {nullptr};
 static PrimitiveDescriptor primitive_376 = {
-		"primitiveProxyIsAllOnes", primitiveFunctionType(&ProxyOopPrimitives::isAllOnes), 1114113, signature_376, errors_376
+		"primitiveProcessUserTime", primitiveFunctionType(&ProcessOopPrimitives::user_time), 1114113, signature_376, errors_376
 };
 
-static const char *signature_377[] = {"Boolean", "Proxy"};
+static const char *signature_377[] = {"Process"};
 static const char *errors_377[] = {nullptr};
 static PrimitiveDescriptor primitive_377 = {
-		"primitiveProxyIsNull", primitiveFunctionType(&ProxyOopPrimitives::isNull), 1114113, signature_377, errors_377
+		"primitiveProcessYield", primitiveFunctionType(&ProcessOopPrimitives::yield), 65536, signature_377, errors_377
 };
 
-static const char *signature_378[] = {"Self", "Proxy", "SmallInteger"};
+static const char *signature_378[] = {"Process"};
 static const char *errors_378[] = {nullptr};
 static PrimitiveDescriptor primitive_378 = {
-		"primitiveProxyMalloc:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::malloc), 1376258, signature_378, errors_378
+		"primitiveProcessYieldInCritical", primitiveFunctionType(&ProcessOopPrimitives::yield_in_critical), 65536, signature_378, errors_378
 };
 
-static const char *signature_379[] = {"Proxy", "Proxy", "SmallInteger", "Proxy"};
+static const char *signature_379[] = {"SmallInteger", "Proxy", "SmallInteger"};
 static const char *errors_379[] = {nullptr};
 static PrimitiveDescriptor primitive_379 = {
-		"primitiveProxyProxyAt:put:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::proxyAtPut), 1376259, signature_379, errors_379
+		"primitiveProxyByteAt:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::byteAt), 5570562, signature_379, errors_379
 };
 
-static const char *signature_380[] = {"Proxy", "Proxy", "SmallInteger", "Proxy"};
+static const char *signature_380[] = {"SmallInteger", "Proxy", "SmallInteger", "SmallInteger"};
 static const char *errors_380[] = {nullptr};
 static PrimitiveDescriptor primitive_380 = {
-		"primitiveProxyProxyAt:result:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::proxyAt), 1376259, signature_380, errors_380
+		"primitiveProxyByteAt:put:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::byteAtPut), 5570563, signature_380, errors_380
 };
 
-static const char *signature_381[] = {"Self", "Proxy", "SmallInteger|Proxy"};
+static const char *signature_381[] = {"Self", "Proxy", "SmallInteger"};
 static const char *errors_381[] = {nullptr};
 static PrimitiveDescriptor primitive_381 = {
-		"primitiveProxySet:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::set), 1376258, signature_381, errors_381
+		"primitiveProxyCalloc:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::calloc), 1376258, signature_381, errors_381
 };
 
-static const char *signature_382[] = {"Self", "Proxy", "SmallInteger", "SmallInteger"};
+static const char *signature_382[] = {"SmallInteger", "Proxy", "SmallInteger"};
 static const char *errors_382[] = {nullptr};
 static PrimitiveDescriptor primitive_382 = {
-		"primitiveProxySetHigh:low:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::setHighLow), 1376259, signature_382, errors_382
+		"primitiveProxyDoubleByteAt:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::doubleByteAt), 1376258, signature_382, errors_382
 };
 
-static const char *signature_383[] = {"Float", "Proxy", "SmallInteger"};
+static const char *signature_383[] = {"SmallInteger", "Proxy", "SmallInteger", "SmallInteger"};
 static const char *errors_383[] = {nullptr};
 static PrimitiveDescriptor primitive_383 = {
-		"primitiveProxySinglePrecisionFloatAt:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::singlePrecisionFloatAt), 1376258, signature_383, errors_383
+		"primitiveProxyDoubleByteAt:put:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::doubleByteAtPut), 1376259, signature_383, errors_383
 };
 
-static const char *signature_384[] = {"Self", "Proxy", "SmallInteger", "Float"};
-static const char *errors_384[] = {"ConversionFailed", nullptr};
+static const char *signature_384[] = {"Float", "Proxy", "SmallInteger"};
+static const char *errors_384[] = {nullptr};
 static PrimitiveDescriptor primitive_384 = {
-		"primitiveProxySinglePrecisionFloatAt:put:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::singlePrecisionFloatAtPut), 1376259, signature_384, errors_384
+		"primitiveProxyDoublePrecisionFloatAt:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::doublePrecisionFloatAt), 1376258, signature_384, errors_384
 };
 
-static const char *signature_385[] = {"SmallInteger", "Proxy", "SmallInteger"};
+static const char *signature_385[] = {"Self", "Proxy", "SmallInteger", "Float"};
 static const char *errors_385[] = {"ConversionFailed", nullptr};
 static PrimitiveDescriptor primitive_385 = {
-		"primitiveProxySmiAt:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::smiAt), 1376258, signature_385, errors_385
+		"primitiveProxyDoublePrecisionFloatAt:put:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::doublePrecisionFloatAtPut), 1376259, signature_385, errors_385
 };
 
-static const char *signature_386[] = {"SmallInteger", "Proxy", "SmallInteger", "SmallInteger"};
+static const char *signature_386[] = {"Self", "Proxy"};
 static const char *errors_386[] = {nullptr};
 static PrimitiveDescriptor primitive_386 = {
-		"primitiveProxySmiAt:put:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::smiAtPut), 1376259, signature_386, errors_386
+		"primitiveProxyFree", primitiveFunctionType(&ProxyOopPrimitives::free), 1114113, signature_386, errors_386
 };
 
-static const char *signature_387[] = {"Proxy", "Proxy", "SmallInteger", "Proxy"};
+static const char *signature_387[] = {"SmallInteger", "Proxy"};
 static const char *errors_387[] = {nullptr};
 static PrimitiveDescriptor primitive_387 = {
-		"primitiveProxySubProxyAt:result:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::subProxyAt), 1376259, signature_387, errors_387
+		"primitiveProxyGetHigh", primitiveFunctionType(&ProxyOopPrimitives::getHigh), 1114113, signature_387, errors_387
 };
 
-static const char *signature_388[] = {"BottomType"};
-static const char *errors_388[] = {nullptr};
+static const char *signature_388[] = {"SmallInteger", "Proxy"};
+static const char *errors_388[] = {"ConversionFailed", nullptr};
 static PrimitiveDescriptor primitive_388 = {
-		"primitiveQuit", primitiveFunctionType(&SystemPrimitives::quit), 65536, signature_388, errors_388
+		"primitiveProxyGetIfFail:", primitiveFunctionType(&ProxyOopPrimitives::getSmi), 1376257, signature_388, errors_388
 };
 
-static const char *signature_389[] = {"SmallInteger", "SmallInteger", "SmallInteger"};
-static const char *errors_389[] = {"NotImplementedYet", nullptr};
+static const char *signature_389[] = {"SmallInteger", "Proxy"};
+static const char *errors_389[] = {nullptr};
 static PrimitiveDescriptor primitive_389 = {
-		"primitiveQuo:ifFail:", primitiveFunctionType(&smiOopPrimitives_quo), 6029826, signature_389, errors_389
+		"primitiveProxyGetLow", primitiveFunctionType(&ProxyOopPrimitives::getLow), 1114113, signature_389, errors_389
 };
 
-static const char *signature_390[] = {"SmallInteger", "SmallInteger", "SmallInteger"};
+static const char *signature_390[] = {"Boolean", "Proxy"};
 static const char *errors_390[] = {nullptr};
 static PrimitiveDescriptor primitive_390 = {
-		"primitiveRawBitShift:ifFail:", primitiveFunctionType(&SmallIntegerOopPrimitives::rawBitShift), 6029826, signature_390, errors_390
+		"primitiveProxyIsAllOnes", primitiveFunctionType(&ProxyOopPrimitives::isAllOnes), 1114113, signature_390, errors_390
 };
 
-static const char *signature_391[] = {"Object", "Process"};
+static const char *signature_391[] = {"Boolean", "Proxy"};
 static const char *errors_391[] = {nullptr};
 static PrimitiveDescriptor primitive_391 = {
-		"primitiveRecordMainProcessIfFail:", primitiveFunctionType(&ProcessOopPrimitives::setMainProcess), 1376257, signature_391, errors_391
+		"primitiveProxyIsNull", primitiveFunctionType(&ProxyOopPrimitives::isNull), 1114113, signature_391, errors_391
 };
 
-static const char *signature_392[] = {"IndexedInstanceVariables", "Object", "SmallInteger"};
+static const char *signature_392[] = {"Self", "Proxy", "SmallInteger"};
 static const char *errors_392[] = {nullptr};
 static PrimitiveDescriptor primitive_392 = {
-		"primitiveReferencesTo:limit:ifFail:", primitiveFunctionType(&SystemPrimitives::references_to), 327682, signature_392, errors_392
+		"primitiveProxyMalloc:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::malloc), 1376258, signature_392, errors_392
 };
 
-static const char *signature_393[] = {"IndexedInstanceVariables", "Class", "SmallInteger"};
+static const char *signature_393[] = {"Proxy", "Proxy", "SmallInteger", "Proxy"};
 static const char *errors_393[] = {nullptr};
 static PrimitiveDescriptor primitive_393 = {
-		"primitiveReferencesToInstancesOf:limit:ifFail:", primitiveFunctionType(&SystemPrimitives::references_to_instances_of), 327682, signature_393, errors_393
+		"primitiveProxyProxyAt:put:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::proxyAtPut), 1376259, signature_393, errors_393
 };
 
-static const char *signature_394[] = {"SmallInteger", "SmallInteger", "SmallInteger"};
-static const char *errors_394[] = {"DivisionByZero", nullptr};
+static const char *signature_394[] = {"Proxy", "Proxy", "SmallInteger", "Proxy"};
+static const char *errors_394[] = {nullptr};
 static PrimitiveDescriptor primitive_394 = {
-		"primitiveRemainder:ifFail:", primitiveFunctionType(&smiOopPrimitives_remainder), 6029826, signature_394, errors_394
+		"primitiveProxyProxyAt:result:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::proxyAt), 1376259, signature_394, errors_394
 };
 
-static const char *signature_395[] = {"BottomType", "BlockWithoutArguments"};
+static const char *signature_395[] = {"Self", "Proxy", "SmallInteger|Proxy"};
 static const char *errors_395[] = {nullptr};
 static PrimitiveDescriptor primitive_395 = {
-		"primitiveRepeat", primitiveFunctionType(&blockRepeat), 1245185, signature_395, errors_395
+		"primitiveProxySet:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::set), 1376258, signature_395, errors_395
 };
 
-static const char *signature_396[] = {"Self", "Object"};
+static const char *signature_396[] = {"Self", "Proxy", "SmallInteger", "SmallInteger"};
 static const char *errors_396[] = {nullptr};
 static PrimitiveDescriptor primitive_396 = {
-		"primitiveScavenge", primitiveFunctionType(&SystemPrimitives::scavenge), 1114113, signature_396, errors_396
+		"primitiveProxySetHigh:low:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::setHighLow), 1376259, signature_396, errors_396
 };
 
-static const char *signature_397[] = {"Object", "SmallInteger"};
+static const char *signature_397[] = {"Float", "Proxy", "SmallInteger"};
 static const char *errors_397[] = {nullptr};
 static PrimitiveDescriptor primitive_397 = {
-		"primitiveSetInterpreterInvocationCounterLimitTo:ifFail:", primitiveFunctionType(&DebugPrimitives::setInterpreterInvocationCounterLimit), 327681, signature_397, errors_397
+		"primitiveProxySinglePrecisionFloatAt:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::singlePrecisionFloatAt), 1376258, signature_397, errors_397
 };
 
-static const char *signature_398[] = {"Behavior", "Behavior", "Behavior"};
-static const char *errors_398[] = {"NotAClass", nullptr};
+static const char *signature_398[] = {"Self", "Proxy", "SmallInteger", "Float"};
+static const char *errors_398[] = {"ConversionFailed", nullptr};
 static PrimitiveDescriptor primitive_398 = {
-		"primitiveSetSuperclassOf:toClass:ifFail:", primitiveFunctionType(&BehaviorPrimitives::setSuperclass), 327682, signature_398, errors_398
+		"primitiveProxySinglePrecisionFloatAt:put:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::singlePrecisionFloatAtPut), 1376259, signature_398, errors_398
 };
 
-static const char *signature_399[] = {"Object", "Object"};
-static const char *errors_399[] = {"ReceiverHasWrongType", nullptr};
+static const char *signature_399[] = {"SmallInteger", "Proxy", "SmallInteger"};
+static const char *errors_399[] = {"ConversionFailed", nullptr};
 static PrimitiveDescriptor primitive_399 = {
-		"primitiveShallowCopyIfFail:", primitiveFunctionType(&OopPrimitives::shallowCopy), 1376257, signature_399, errors_399
+		"primitiveProxySmiAt:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::smiAt), 1376258, signature_399, errors_399
 };
 
-static const char *signature_400[] = {"Object", "SmallInteger"};
+static const char *signature_400[] = {"SmallInteger", "Proxy", "SmallInteger", "SmallInteger"};
 static const char *errors_400[] = {nullptr};
 static PrimitiveDescriptor primitive_400 = {
-		"primitiveShrinkMemory:", primitiveFunctionType(&SystemPrimitives::shrinkMemory), 65537, signature_400, errors_400
+		"primitiveProxySmiAt:put:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::smiAtPut), 1376259, signature_400, errors_400
 };
 
-static const char *signature_401[] = {"SmallInteger"};
+static const char *signature_401[] = {"Proxy", "Proxy", "SmallInteger", "Proxy"};
 static const char *errors_401[] = {nullptr};
 static PrimitiveDescriptor primitive_401 = {
-		"primitiveSizeOfOop", primitiveFunctionType(&SystemPrimitives::oopSize), 65536, signature_401, errors_401
+		"primitiveProxySubProxyAt:result:ifFail:", primitiveFunctionType(&ProxyOopPrimitives::subProxyAt), 1376259, signature_401, errors_401
 };
 
-static const char *signature_402[] = {"IndexedInstanceVariables"};
+static const char *signature_402[] = {"BottomType"};
 static const char *errors_402[] = {nullptr};
 static PrimitiveDescriptor primitive_402 = {
-		"primitiveSlidingSystemAverageIfFail:", primitiveFunctionType(&SystemPrimitives::sliding_system_average), 327680, signature_402, errors_402
+		"primitiveQuit", primitiveFunctionType(&SystemPrimitives::quit), 65536, signature_402, errors_402
 };
 
-static const char *signature_403[] = {"Boolean", "SmallInteger", "SmallInteger"};
-static const char *errors_403[] = {nullptr};
+static const char *signature_403[] = {"SmallInteger", "SmallInteger", "SmallInteger"};
+static const char *errors_403[] = {"NotImplementedYet", nullptr};
 static PrimitiveDescriptor primitive_403 = {
-		"primitiveSmallIntegerEqual:ifFail:", primitiveFunctionType(&SmallIntegerOopPrimitives::equal), 6029570, signature_403, errors_403
+		"primitiveQuo:ifFail:", primitiveFunctionType(&smiOopPrimitives_quo), 6029826, signature_403, errors_403
 };
 
-static const char *signature_404[] = {"SmallInteger", "Symbol"};
-static const char *errors_404[] = {"NotFound", nullptr};
+static const char *signature_404[] = {"SmallInteger", "SmallInteger", "SmallInteger"};
+static const char *errors_404[] = {nullptr};
 static PrimitiveDescriptor primitive_404 = {
-		"primitiveSmallIntegerFlagAt:ifFail:", primitiveFunctionType(&DebugPrimitives::smiAt), 327681, signature_404, errors_404
+		"primitiveRawBitShift:ifFail:", primitiveFunctionType(&SmallIntegerOopPrimitives::rawBitShift), 6029826, signature_404, errors_404
 };
 
-static const char *signature_405[] = {"Boolean", "Symbol", "Boolean"};
-static const char *errors_405[] = {"NotFound", nullptr};
+static const char *signature_405[] = {"Object", "Process"};
+static const char *errors_405[] = {nullptr};
 static PrimitiveDescriptor primitive_405 = {
-		"primitiveSmallIntegerFlagAt:put:ifFail:", primitiveFunctionType(&DebugPrimitives::smiAtPut), 327682, signature_405, errors_405
+		"primitiveRecordMainProcessIfFail:", primitiveFunctionType(&ProcessOopPrimitives::setMainProcess), 1376257, signature_405, errors_405
 };
 
-static const char *signature_406[] = {"Boolean", "SmallInteger", "SmallInteger"};
+static const char *signature_406[] = {"IndexedInstanceVariables", "Object", "SmallInteger"};
 static const char *errors_406[] = {nullptr};
 static PrimitiveDescriptor primitive_406 = {
-		"primitiveSmallIntegerNotEqual:ifFail:", primitiveFunctionType(&SmallIntegerOopPrimitives::notEqual), 6029570, signature_406, errors_406
+		"primitiveReferencesTo:limit:ifFail:", primitiveFunctionType(&SystemPrimitives::references_to), 327682, signature_406, errors_406
 };
 
-static const char *signature_407[] = {"IndexedInstanceVariables"};
+static const char *signature_407[] = {"IndexedInstanceVariables", "Class", "SmallInteger"};
 static const char *errors_407[] = {nullptr};
 static PrimitiveDescriptor primitive_407 = {
-		"primitiveSmalltalkArray", primitiveFunctionType(&SystemPrimitives::smalltalk_array), 65536, signature_407, errors_407
+		"primitiveReferencesToInstancesOf:limit:ifFail:", primitiveFunctionType(&SystemPrimitives::references_to_instances_of), 327682, signature_407, errors_407
 };
 
-static const char *signature_408[] = {"GlobalAssociation", "Symbol", "Object"};
-static const char *errors_408[] = {nullptr};
+static const char *signature_408[] = {"SmallInteger", "SmallInteger", "SmallInteger"};
+static const char *errors_408[] = {"DivisionByZero", nullptr};
 static PrimitiveDescriptor primitive_408 = {
-		"primitiveSmalltalkAt:Put:ifFail:", primitiveFunctionType(&SystemPrimitives::smalltalk_at_put), 327682, signature_408, errors_408
+		"primitiveRemainder:ifFail:", primitiveFunctionType(&smiOopPrimitives_remainder), 6029826, signature_408, errors_408
 };
 
-static const char *signature_409[] = {"GlobalAssociation", "SmallInteger"};
-static const char *errors_409[] = {"OutOfBounds", nullptr};
+static const char *signature_409[] = {"BottomType", "BlockWithoutArguments"};
+static const char *errors_409[] = {nullptr};
 static PrimitiveDescriptor primitive_409 = {
-		"primitiveSmalltalkAt:ifFail:", primitiveFunctionType(&SystemPrimitives::smalltalk_at), 327681, signature_409, errors_409
+		"primitiveRepeat", primitiveFunctionType(&blockRepeat), 1245185, signature_409, errors_409
 };
 
-static const char *signature_410[] = {"GlobalAssociation", "SmallInteger"};
+static const char *signature_410[] = {"Self", "Object"};
 static const char *errors_410[] = {nullptr};
 static PrimitiveDescriptor primitive_410 = {
-		"primitiveSmalltalkRemoveAt:ifFail:", primitiveFunctionType(&SystemPrimitives::smalltalk_remove_at), 327681, signature_410, errors_410
+		"primitiveScavenge", primitiveFunctionType(&SystemPrimitives::scavenge), 1114113, signature_410, errors_410
 };
 
-static const char *signature_411[] = {"SmallInteger"};
+static const char *signature_411[] = {"Object", "SmallInteger"};
 static const char *errors_411[] = {nullptr};
 static PrimitiveDescriptor primitive_411 = {
-		"primitiveSmalltalkSize", primitiveFunctionType(&SystemPrimitives::smalltalk_size), 65536, signature_411, errors_411
+		"primitiveSetInterpreterInvocationCounterLimitTo:ifFail:", primitiveFunctionType(&DebugPrimitives::setInterpreterInvocationCounterLimit), 327681, signature_411, errors_411
 };
 
-static const char *signature_412[] = {"SmallInteger", "SmallInteger", "SmallInteger"};
-static const char *errors_412[] = {"Overflow", nullptr};
+static const char *signature_412[] = {"Behavior", "Behavior", "Behavior"};
+static const char *errors_412[] = {"NotAClass", nullptr};
 static PrimitiveDescriptor primitive_412 = {
-		"primitiveSubtract:ifFail:", primitiveFunctionType(&smiOopPrimitives_subtract), 6029826, signature_412, errors_412
+		"primitiveSetSuperclassOf:toClass:ifFail:", primitiveFunctionType(&BehaviorPrimitives::setSuperclass), 327682, signature_412, errors_412
 };
 
-static const char *signature_413[] = {"Behavior|Nil", "Behavior"};
-static const char *errors_413[] = {nullptr};
+static const char *signature_413[] = {"Object", "Object"};
+static const char *errors_413[] = {"ReceiverHasWrongType", nullptr};
 static PrimitiveDescriptor primitive_413 = {
-		"primitiveSuperclass", primitiveFunctionType(&BehaviorPrimitives::superclass), 1114113, signature_413, errors_413
+		"primitiveShallowCopyIfFail:", primitiveFunctionType(&OopPrimitives::shallowCopy), 1376257, signature_413, errors_413
 };
 
-static const char *signature_414[] = {"Behavior|Nil", "Behavior"};
+static const char *signature_414[] = {"Object", "SmallInteger"};
 static const char *errors_414[] = {nullptr};
 static PrimitiveDescriptor primitive_414 = {
-		"primitiveSuperclassOf:ifFail:", primitiveFunctionType(&BehaviorPrimitives::superclass_of), 327681, signature_414, errors_414
+		"primitiveShrinkMemory:", primitiveFunctionType(&SystemPrimitives::shrinkMemory), 65537, signature_414, errors_414
 };
 
-static const char *signature_415[] = {"SmallInteger", "IndexedByteInstanceVariables"};
+static const char *signature_415[] = {"SmallInteger"};
 static const char *errors_415[] = {nullptr};
 static PrimitiveDescriptor primitive_415 = {
-		"primitiveSymbolNumberOfArguments", primitiveFunctionType(&ByteArrayPrimitives::numberOfArguments), 1574401, signature_415, errors_415
+		"primitiveSizeOfOop", primitiveFunctionType(&SystemPrimitives::oopSize), 65536, signature_415, errors_415
 };
 
-static const char *signature_416[] = {"Float"};
+static const char *signature_416[] = {"IndexedInstanceVariables"};
 static const char *errors_416[] = {nullptr};
 static PrimitiveDescriptor primitive_416 = {
-		"primitiveSystemTime", primitiveFunctionType(&SystemPrimitives::systemTime), 65536, signature_416, errors_416
+		"primitiveSlidingSystemAverageIfFail:", primitiveFunctionType(&SystemPrimitives::sliding_system_average), 327680, signature_416, errors_416
 };
 
-static const char *signature_417[] = {"Object"};
+static const char *signature_417[] = {"Boolean", "SmallInteger", "SmallInteger"};
 static const char *errors_417[] = {nullptr};
 static PrimitiveDescriptor primitive_417 = {
-		"primitiveTimerPrintBuffer", primitiveFunctionType(&DebugPrimitives::timerPrintBuffer), 65536, signature_417, errors_417
+		"primitiveSmallIntegerEqual:ifFail:", primitiveFunctionType(&SmallIntegerOopPrimitives::equal), 6029570, signature_417, errors_417
 };
 
-static const char *signature_418[] = {"Object"};
-static const char *errors_418[] = {nullptr};
+static const char *signature_418[] = {"SmallInteger", "Symbol"};
+static const char *errors_418[] = {"NotFound", nullptr};
 static PrimitiveDescriptor primitive_418 = {
-		"primitiveTimerStart", primitiveFunctionType(&DebugPrimitives::timerStart), 65536, signature_418, errors_418
+		"primitiveSmallIntegerFlagAt:ifFail:", primitiveFunctionType(&DebugPrimitives::smiAt), 327681, signature_418, errors_418
 };
 
-static const char *signature_419[] = {"Object"};
-static const char *errors_419[] = {nullptr};
+static const char *signature_419[] = {"Boolean", "Symbol", "Boolean"};
+static const char *errors_419[] = {"NotFound", nullptr};
 static PrimitiveDescriptor primitive_419 = {
-		"primitiveTimerStop", primitiveFunctionType(&DebugPrimitives::timerStop), 65536, signature_419, errors_419
+		"primitiveSmallIntegerFlagAt:put:ifFail:", primitiveFunctionType(&DebugPrimitives::smiAtPut), 327682, signature_419, errors_419
 };
 
-static const char *signature_420[] = {"Object"};
+static const char *signature_420[] = {"Boolean", "SmallInteger", "SmallInteger"};
 static const char *errors_420[] = {nullptr};
 static PrimitiveDescriptor primitive_420 = {
-		"primitiveTraceStack", primitiveFunctionType(&SystemPrimitives::traceStack), 65536, signature_420, errors_420
+		"primitiveSmallIntegerNotEqual:ifFail:", primitiveFunctionType(&SmallIntegerOopPrimitives::notEqual), 6029570, signature_420, errors_420
 };
 
-static const char *signature_421[] = {"Object", "BlockWithoutArguments", "BlockWithoutArguments"};
+static const char *signature_421[] = {"IndexedInstanceVariables"};
 static const char *errors_421[] = {nullptr};
 static PrimitiveDescriptor primitive_421 = {
-		"primitiveUnwindProtect:ifFail:", primitiveFunctionType(&unwindprotect), 1507330, signature_421, errors_421
+		"primitiveSmalltalkArray", primitiveFunctionType(&SystemPrimitives::smalltalk_array), 65536, signature_421, errors_421
 };
 
-static const char *signature_422[] = {"Float"};
+static const char *signature_422[] = {"GlobalAssociation", "Symbol", "Object"};
 static const char *errors_422[] = {nullptr};
 static PrimitiveDescriptor primitive_422 = {
-		"primitiveUserTime", primitiveFunctionType(&SystemPrimitives::userTime), 65536, signature_422, errors_422
+		"primitiveSmalltalkAt:Put:ifFail:", primitiveFunctionType(&SystemPrimitives::smalltalk_at_put), 327682, signature_422, errors_422
 };
 
-static const char *signature_423[] = {"Object"};
-static const char *errors_423[] = {nullptr};
+static const char *signature_423[] = {"GlobalAssociation", "SmallInteger"};
+static const char *errors_423[] = {"OutOfBounds", nullptr};
 static PrimitiveDescriptor primitive_423 = {
-		"primitiveVMBreakpoint", primitiveFunctionType(&SystemPrimitives::vmbreakpoint), 65536, signature_423, errors_423
+		"primitiveSmalltalkAt:ifFail:", primitiveFunctionType(&SystemPrimitives::smalltalk_at), 327681, signature_423, errors_423
 };
 
-static const char *signature_424[] = {"Object", "BlockWithoutArguments"};
+static const char *signature_424[] = {"GlobalAssociation", "SmallInteger"};
 static const char *errors_424[] = {nullptr};
 static PrimitiveDescriptor primitive_424 = {
-		"primitiveValue", primitiveFunctionType(&primitiveValue0), 5441537, signature_424, errors_424
+		"primitiveSmalltalkRemoveAt:ifFail:", primitiveFunctionType(&SystemPrimitives::smalltalk_remove_at), 327681, signature_424, errors_424
 };
 
-static const char *signature_425[] = {"Object", "BlockWithOneArgument", "Object"};
+static const char *signature_425[] = {"SmallInteger"};
 static const char *errors_425[] = {nullptr};
 static PrimitiveDescriptor primitive_425 = {
-		"primitiveValue:", primitiveFunctionType(&primitiveValue1), 5441538, signature_425, errors_425
+		"primitiveSmalltalkSize", primitiveFunctionType(&SystemPrimitives::smalltalk_size), 65536, signature_425, errors_425
 };
 
-static const char *signature_426[] = {"Object", "BlockWithTwoArguments", "Object", "Object"};
-static const char *errors_426[] = {nullptr};
+static const char *signature_426[] = {"SmallInteger", "SmallInteger", "SmallInteger"};
+static const char *errors_426[] = {"Overflow", nullptr};
 static PrimitiveDescriptor primitive_426 = {
-		"primitiveValue:value:", primitiveFunctionType(&primitiveValue2), 5441539, signature_426, errors_426
+		"primitiveSubtract:ifFail:", primitiveFunctionType(&smiOopPrimitives_subtract), 6029826, signature_426, errors_426
 };
 
-static const char *signature_427[] = {"Object", "BlockWithThreeArguments", "Object", "Object", "Object"};
+static const char *signature_427[] = {"Behavior|Nil", "Behavior"};
 static const char *errors_427[] = {nullptr};
 static PrimitiveDescriptor primitive_427 = {
-		"primitiveValue:value:value:", primitiveFunctionType(&primitiveValue3), 5441540, signature_427, errors_427
+		"primitiveSuperclass", primitiveFunctionType(&BehaviorPrimitives::superclass), 1114113, signature_427, errors_427
 };
 
-static const char *signature_428[] = {"Object", "BlockWithFourArguments", "Object", "Object", "Object", "Object"};
+static const char *signature_428[] = {"Behavior|Nil", "Behavior"};
 static const char *errors_428[] = {nullptr};
 static PrimitiveDescriptor primitive_428 = {
-		"primitiveValue:value:value:value:", primitiveFunctionType(&primitiveValue4), 5441541, signature_428, errors_428
+		"primitiveSuperclassOf:ifFail:", primitiveFunctionType(&BehaviorPrimitives::superclass_of), 327681, signature_428, errors_428
 };
 
-static const char *signature_429[] = {"Object", "BlockWithFiveArguments", "Object", "Object", "Object", "Object", "Object"};
+static const char *signature_429[] = {"SmallInteger", "IndexedByteInstanceVariables"};
 static const char *errors_429[] = {nullptr};
 static PrimitiveDescriptor primitive_429 = {
-		"primitiveValue:value:value:value:value:", primitiveFunctionType(&primitiveValue5), 5441542, signature_429, errors_429
+		"primitiveSymbolNumberOfArguments", primitiveFunctionType(&ByteArrayPrimitives::numberOfArguments), 1574401, signature_429, errors_429
 };
 
-static const char *signature_430[] = {"Object", "BlockWithSixArguments", "Object", "Object", "Object", "Object", "Object", "Object"};
+static const char *signature_430[] = {"Float"};
 static const char *errors_430[] = {nullptr};
 static PrimitiveDescriptor primitive_430 = {
-		"primitiveValue:value:value:value:value:value:", primitiveFunctionType(&primitiveValue6), 5441543, signature_430, errors_430
+		"primitiveSystemTime", primitiveFunctionType(&SystemPrimitives::systemTime), 65536, signature_430, errors_430
 };
 
-static const char *signature_431[] = {"Object", "BlockWithSevenArguments", "Object", "Object", "Object", "Object", "Object", "Object", "Object"};
+static const char *signature_431[] = {"Object"};
 static const char *errors_431[] = {nullptr};
 static PrimitiveDescriptor primitive_431 = {
-		"primitiveValue:value:value:value:value:value:value:", primitiveFunctionType(&primitiveValue7), 5441544, signature_431, errors_431
+		"primitiveTimerPrintBuffer", primitiveFunctionType(&DebugPrimitives::timerPrintBuffer), 65536, signature_431, errors_431
 };
 
-static const char *signature_432[] = {"Object", "BlockWithEightArguments", "Object", "Object", "Object", "Object", "Object", "Object", "Object", "Object"};
+static const char *signature_432[] = {"Object"};
 static const char *errors_432[] = {nullptr};
 static PrimitiveDescriptor primitive_432 = {
-		"primitiveValue:value:value:value:value:value:value:value:", primitiveFunctionType(&primitiveValue8), 5441545, signature_432, errors_432
+		"primitiveTimerStart", primitiveFunctionType(&DebugPrimitives::timerStart), 65536, signature_432, errors_432
 };
 
-static const char *signature_433[] = {"Object", "BlockWithNineArguments", "Object", "Object", "Object", "Object", "Object", "Object", "Object", "Object", "Object"};
+static const char *signature_433[] = {"Object"};
 static const char *errors_433[] = {nullptr};
 static PrimitiveDescriptor primitive_433 = {
-		"primitiveValue:value:value:value:value:value:value:value:value:", primitiveFunctionType(&primitiveValue9), 5441546, signature_433, errors_433
+		"primitiveTimerStop", primitiveFunctionType(&DebugPrimitives::timerStop), 65536, signature_433, errors_433
 };
 
 static const char *signature_434[] = {"Object"};
 static const char *errors_434[] = {nullptr};
 static PrimitiveDescriptor primitive_434 = {
-		"primitiveVerify", primitiveFunctionType(&DebugPrimitives::verify), 65536, signature_434, errors_434
+		"primitiveTraceStack", primitiveFunctionType(&SystemPrimitives::traceStack), 65536, signature_434, errors_434
 };
 
-static const char *signature_435[] = {"Proxy", "Proxy"};
+static const char *signature_435[] = {"Object", "BlockWithoutArguments", "BlockWithoutArguments"};
 static const char *errors_435[] = {nullptr};
 static PrimitiveDescriptor primitive_435 = {
-		"primitiveWindowsHInstance:ifFail:", primitiveFunctionType(&SystemPrimitives::windowsHInstance), 327681, signature_435, errors_435
+		"primitiveUnwindProtect:ifFail:", primitiveFunctionType(&unwindprotect), 1507330, signature_435, errors_435
 };
 
-static const char *signature_436[] = {"Proxy", "Proxy"};
+static const char *signature_436[] = {"Float"};
 static const char *errors_436[] = {nullptr};
 static PrimitiveDescriptor primitive_436 = {
-		"primitiveWindowsHPrevInstance:ifFail:", primitiveFunctionType(&SystemPrimitives::windowsHPrevInstance), 327681, signature_436, errors_436
+		"primitiveUserTime", primitiveFunctionType(&SystemPrimitives::userTime), 65536, signature_436, errors_436
 };
 
 static const char *signature_437[] = {"Object"};
 static const char *errors_437[] = {nullptr};
 static PrimitiveDescriptor primitive_437 = {
-		"primitiveWindowsNCmdShow", primitiveFunctionType(&SystemPrimitives::windowsNCmdShow), 65536, signature_437, errors_437
+		"primitiveVMBreakpoint", primitiveFunctionType(&SystemPrimitives::vmbreakpoint), 65536, signature_437, errors_437
 };
 
-static const char *signature_438[] = {"Object", "String"};
+static const char *signature_438[] = {"Object", "BlockWithoutArguments"};
 static const char *errors_438[] = {nullptr};
 static PrimitiveDescriptor primitive_438 = {
-		"primitiveWriteSnapshot:", primitiveFunctionType(&SystemPrimitives::writeSnapshot), 65537, signature_438, errors_438
+		"primitiveValue", primitiveFunctionType(&primitiveValue0), 5441537, signature_438, errors_438
+};
+
+static const char *signature_439[] = {"Object", "BlockWithOneArgument", "Object"};
+static const char *errors_439[] = {nullptr};
+static PrimitiveDescriptor primitive_439 = {
+		"primitiveValue:", primitiveFunctionType(&primitiveValue1), 5441538, signature_439, errors_439
+};
+
+static const char *signature_440[] = {"Object", "BlockWithTwoArguments", "Object", "Object"};
+static const char *errors_440[] = {nullptr};
+static PrimitiveDescriptor primitive_440 = {
+		"primitiveValue:value:", primitiveFunctionType(&primitiveValue2), 5441539, signature_440, errors_440
+};
+
+static const char *signature_441[] = {"Object", "BlockWithThreeArguments", "Object", "Object", "Object"};
+static const char *errors_441[] = {nullptr};
+static PrimitiveDescriptor primitive_441 = {
+		"primitiveValue:value:value:", primitiveFunctionType(&primitiveValue3), 5441540, signature_441, errors_441
+};
+
+static const char *signature_442[] = {"Object", "BlockWithFourArguments", "Object", "Object", "Object", "Object"};
+static const char *errors_442[] = {nullptr};
+static PrimitiveDescriptor primitive_442 = {
+		"primitiveValue:value:value:value:", primitiveFunctionType(&primitiveValue4), 5441541, signature_442, errors_442
+};
+
+static const char *signature_443[] = {"Object", "BlockWithFiveArguments", "Object", "Object", "Object", "Object", "Object"};
+static const char *errors_443[] = {nullptr};
+static PrimitiveDescriptor primitive_443 = {
+		"primitiveValue:value:value:value:value:", primitiveFunctionType(&primitiveValue5), 5441542, signature_443, errors_443
+};
+
+static const char *signature_444[] = {"Object", "BlockWithSixArguments", "Object", "Object", "Object", "Object", "Object", "Object"};
+static const char *errors_444[] = {nullptr};
+static PrimitiveDescriptor primitive_444 = {
+		"primitiveValue:value:value:value:value:value:", primitiveFunctionType(&primitiveValue6), 5441543, signature_444, errors_444
+};
+
+static const char *signature_445[] = {"Object", "BlockWithSevenArguments", "Object", "Object", "Object", "Object", "Object", "Object", "Object"};
+static const char *errors_445[] = {nullptr};
+static PrimitiveDescriptor primitive_445 = {
+		"primitiveValue:value:value:value:value:value:value:", primitiveFunctionType(&primitiveValue7), 5441544, signature_445, errors_445
+};
+
+static const char *signature_446[] = {"Object", "BlockWithEightArguments", "Object", "Object", "Object", "Object", "Object", "Object", "Object", "Object"};
+static const char *errors_446[] = {nullptr};
+static PrimitiveDescriptor primitive_446 = {
+		"primitiveValue:value:value:value:value:value:value:value:", primitiveFunctionType(&primitiveValue8), 5441545, signature_446, errors_446
+};
+
+static const char *signature_447[] = {"Object", "BlockWithNineArguments", "Object", "Object", "Object", "Object", "Object", "Object", "Object", "Object", "Object"};
+static const char *errors_447[] = {nullptr};
+static PrimitiveDescriptor primitive_447 = {
+		"primitiveValue:value:value:value:value:value:value:value:value:", primitiveFunctionType(&primitiveValue9), 5441546, signature_447, errors_447
+};
+
+static const char *signature_448[] = {"Object"};
+static const char *errors_448[] = {nullptr};
+static PrimitiveDescriptor primitive_448 = {
+		"primitiveVerify", primitiveFunctionType(&DebugPrimitives::verify), 65536, signature_448, errors_448
+};
+
+static const char *signature_449[] = {"Proxy", "Proxy"};
+static const char *errors_449[] = {nullptr};
+static PrimitiveDescriptor primitive_449 = {
+		"primitiveWindowsHInstance:ifFail:", primitiveFunctionType(&SystemPrimitives::windowsHInstance), 327681, signature_449, errors_449
+};
+
+static const char *signature_450[] = {"Proxy", "Proxy"};
+static const char *errors_450[] = {nullptr};
+static PrimitiveDescriptor primitive_450 = {
+		"primitiveWindowsHPrevInstance:ifFail:", primitiveFunctionType(&SystemPrimitives::windowsHPrevInstance), 327681, signature_450, errors_450
+};
+
+static const char *signature_451[] = {"Object"};
+static const char *errors_451[] = {nullptr};
+static PrimitiveDescriptor primitive_451 = {
+		"primitiveWindowsNCmdShow", primitiveFunctionType(&SystemPrimitives::windowsNCmdShow), 65536, signature_451, errors_451
+};
+
+static const char *signature_452[] = {"Object", "String"};
+static const char *errors_452[] = {nullptr};
+static PrimitiveDescriptor primitive_452 = {
+		"primitiveWriteSnapshot:", primitiveFunctionType(&SystemPrimitives::writeSnapshot), 65537, signature_452, errors_452
 };
 
 PrimitiveDescriptor *primitive_table[] = {
@@ -3109,5 +3193,19 @@ PrimitiveDescriptor *primitive_table[] = {
     &primitive_435, \
     &primitive_436, \
     &primitive_437, \
-    &primitive_438
+    &primitive_438, \
+    &primitive_439, \
+    &primitive_440, \
+    &primitive_441, \
+    &primitive_442, \
+    &primitive_443, \
+    &primitive_444, \
+    &primitive_445, \
+    &primitive_446, \
+    &primitive_447, \
+    &primitive_448, \
+    &primitive_449, \
+    &primitive_450, \
+    &primitive_451, \
+    &primitive_452
 };
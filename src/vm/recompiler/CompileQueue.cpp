@@ -0,0 +1,170 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/recompiler/CompileQueue.hpp"
+#include "vm/recompiler/Recompilation.hpp"
+#include "vm/lookup/LookupCache.hpp"
+#include "vm/runtime/DeltaCallCache.hpp"
+#include "vm/runtime/ResourceMark.hpp"
+#include "vm/runtime/flags.hpp"
+#include "vm/code/Zone.hpp"
+#include "vm/code/InliningDatabase.hpp"
+#include "vm/compiler/RecompilationScope.hpp"
+#include "vm/runtime/VMOperation.hpp"
+#include "vm/runtime/VMProcess.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/platform/os.hpp"
+
+
+LookupKey *CompileQueue::_keys = nullptr;
+std::int32_t CompileQueue::_capacity = 0;
+std::int32_t CompileQueue::_first = 0;
+std::int32_t CompileQueue::_length = 0;
+std::int32_t CompileQueue::_compiled = 0;
+std::int32_t CompileQueue::_warmed_up = 0;
+bool CompileQueue::_warm_up_done = false;
+
+
+LookupKey *CompileQueue::at(std::int32_t i) {
+	st_assert(i >= 0 and i < _capacity, "index out of bounds");
+	return &_keys[(_first + i) % _capacity];
+}
+
+bool CompileQueue::enqueue(LookupKey *key) {
+	if (_keys == nullptr) {
+		if (CompileQueueSize <= 0)
+			return false;
+		_capacity = CompileQueueSize;
+		_keys = new_c_heap_array<LookupKey>(_capacity);
+	}
+
+	if (includes(key))
+		return true;
+
+	if (_length == _capacity)
+		return false;
+
+	at(_length)->initialize(key->klass(), key->selector_or_method());
+	_length++;
+	return true;
+}
+
+bool CompileQueue::includes(LookupKey *key) {
+	for (std::int32_t i = 0; i < _length; i++) {
+		if (at(i)->equal(key))
+			return true;
+	}
+	return false;
+}
+
+bool CompileQueue::has_work() {
+	return (UseBackgroundCompilation and not is_empty()) or (UseInliningDatabase and UseInliningDatabaseWarmUp and not _warm_up_done);
+}
+
+bool CompileQueue::compile_queued() {
+	LookupKey key(at(0));
+	_first = (_first + 1) % _capacity;
+	_length--;
+
+	// the method may have been compiled or changed since it was queued
+	if (Universe::code->lookup(&key) not_eq nullptr)
+		return false;
+	LookupResult result = LookupCache::lookup(&key);
+	if (not result.is_method())
+		return false;
+
+	ResourceMark resourceMark;
+	NativeMethod *nm = compile_method(&key, result.method());
+	if (nm == nullptr)
+		return false;
+
+	// lookups find the NativeMethod from now on; inline caches are updated by Recompilation
+	LookupCache::flush(&nm->_lookupKey);
+	_compiled++;
+
+	if (PrintRecompilation) {
+		SPDLOG_INFO("background compilation: {}", nm->_lookupKey.toString());
+	}
+	return true;
+}
+
+bool CompileQueue::compile_from_inlining_database() {
+	ResourceMark resourceMark;
+	bool end_of_table = true;
+	RecompilationScope *rs = InliningDatabase::select_and_remove(&end_of_table);
+	if (end_of_table) {
+		_warm_up_done = true;
+		return false;
+	}
+
+	// the entry could not be read, or the method got compiled (triggered by its counter) in the meantime
+	if (rs == nullptr or Universe::code->lookup(rs->key()) not_eq nullptr)
+		return false;
+
+	VM_OptimizeRScope op(rs);
+	VMProcess::execute(&op);
+	NativeMethod *nm = op.result();
+	if (nm == nullptr)
+		return false;
+
+	LookupCache::flush(&nm->_lookupKey);
+	_warmed_up++;
+
+	if (TraceInliningDatabase) {
+		SPDLOG_INFO("inlining database warm-up: {}", nm->_lookupKey.toString());
+	}
+	return true;
+}
+
+std::int32_t CompileQueue::drain(std::int32_t budget_in_ms) {
+	if (not has_work())
+		return 0;
+
+	double start = os::elapsedTime();
+	std::int32_t count = 0;
+
+	// requests from the running program come first, they are known to be hot
+	while (not is_empty() and (os::elapsedTime() - start) * 1000.0 < budget_in_ms) {
+		if (compile_queued())
+			count++;
+	}
+
+	if (UseInliningDatabase and UseInliningDatabaseWarmUp) {
+		while (not _warm_up_done and (os::elapsedTime() - start) * 1000.0 < budget_in_ms) {
+			if (compile_from_inlining_database())
+				count++;
+		}
+	}
+
+	// the inline caches are left alone (they hold the type feedback of the next recompilations): an interpreted
+	// inline cache still calling the method is fixed by Recompilation::handleStaleInlineCache when its counter overflows
+	if (count > 0)
+		DeltaCallCache::clearAll();
+
+	return count;
+}
+
+std::int32_t CompileQueue::idle_budget(std::int32_t timeout_in_ms) {
+	return timeout_in_ms > 0 ? min(timeout_in_ms, BackgroundCompilationBudget) : BackgroundCompilationBudget;
+}
+
+void CompileQueue::clear() {
+	_first = 0;
+	_length = 0;
+	_warm_up_done = false;
+}
+
+void CompileQueue::oops_do(void f(Oop *)) {
+	for (std::int32_t i = 0; i < _length; i++) {
+		at(i)->oops_do(f);
+	}
+}
+
+void CompileQueue::print() {
+	SPDLOG_INFO("CompileQueue: {} queued, {} compiled, {} compiled from the inlining database", _length, _compiled, _warmed_up);
+	for (std::int32_t i = 0; i < _length; i++) {
+		SPDLOG_INFO("  {}", at(i)->toString());
+	}
+}
@@ -0,0 +1,82 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+#include "vm/lookup/LookupKey.hpp"
+
+
+// CompileQueue holds the lookup keys of interpreted methods whose invocation counter overflowed
+// while UseBackgroundCompilation is on. Instead of stopping for the compile, the requesting
+// process continues in the interpreter.
+//
+// The queue is drained when the system is idle (see DeltaProcess::wait_for_async_dll), oldest
+// request first and within BackgroundCompilationBudget milliseconds. A new NativeMethod is picked
+// up by the inline caches through the normal stale inline cache handling of Recompilation.
+//
+// When the queue is full, the requester falls back to compiling synchronously.
+//
+// With UseInliningDatabaseWarmUp the remaining idle time is used to compile the entries of the
+// inlining database index (see InliningDatabase::select_and_remove), so that a restarted system
+// gets its optimized code back without waiting for the invocation counters.
+class CompileQueue : AllStatic {
+
+private:
+	static LookupKey *_keys;            // circular buffer of keys
+	static std::int32_t _capacity;      // CompileQueueSize when the buffer was allocated
+	static std::int32_t _first;         // index of the oldest request
+	static std::int32_t _length;        // # of queued requests
+	static std::int32_t _compiled;      // # of NativeMethods compiled from the queue
+	static std::int32_t _warmed_up;     // # of NativeMethods compiled from the inlining database
+	static bool _warm_up_done;          // no outer entries left in the inlining database
+
+	static LookupKey *at(std::int32_t i);
+
+	static bool compile_queued();
+
+	static bool compile_from_inlining_database();
+
+public:
+	// Queues a compilation of key; returns false if the queue is full
+	static bool enqueue(LookupKey *key);
+
+	static bool includes(LookupKey *key);
+
+	static bool is_empty() {
+		return _length == 0;
+	}
+
+	static std::int32_t length() {
+		return _length;
+	}
+
+	static std::int32_t compiled() {
+		return _compiled;
+	}
+
+	static std::int32_t warmed_up() {
+		return _warmed_up;
+	}
+
+	// Tells whether drain has anything to do
+	static bool has_work();
+
+	// Compiles queued methods, then inlining database entries, until there is nothing left or budget_in_ms
+	// has passed; returns the # of compiled methods
+	static std::int32_t drain(std::int32_t budget_in_ms);
+
+	// the budget of a drain before waiting for timeout_in_ms (<= 0: forever, or just polling)
+	static std::int32_t idle_budget(std::int32_t timeout_in_ms);
+
+	// Forgets the queued requests and restarts the inlining database warm-up
+	static void clear();
+
+	// memory operations
+	static void oops_do(void f(Oop *));
+
+	static void print();
+};
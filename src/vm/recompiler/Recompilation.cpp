@@ -7,6 +7,7 @@
 #include "vm/code/NativeMethod.hpp"
 #include "vm/recompiler/Recompilation.hpp"
 #include "vm/recompiler/Recompilee.hpp"
+#include "vm/recompiler/CompileQueue.hpp"
 #include "vm/utility/EventLog.hpp"
 #include "vm/runtime/ResourceMark.hpp"
 #include "vm/code/InliningDatabase.hpp"
@@ -56,6 +57,11 @@ const char *Recompilation::methodOop_invocation_counter_overflow(Oop receiver, M
 	}
 
 	if (UseRecompilation) {
+		if (UseBackgroundCompilation and enqueue_compilation(receiver, method)) {
+			// continue interpreting; the method is compiled when the system is idle
+			method->set_invocation_count(0);
+			return nullptr;
+		}
 		Recompilation r(receiver, method);
 		VMProcess::execute(&r);
 		if (r.recompiledTrigger()) {
@@ -98,6 +104,38 @@ const char *Recompilation::nativeMethod_invocation_counter_overflow(Oop receiver
 	return continuationAddr;
 }
 
+bool Recompilation::methodOop_loop_counter_overflow(Oop receiver, MethodOop method) {
+
+	// called by the interpreter whenever a loop in a method (or block method) whose invocation counter
+	// already reached the limit overflows the loop counter; the activation stays interpreted since there
+	// is no loop-header entry into compiled code, but the resulting NativeMethod replaces the interpreted
+	// method in the calling inline caches for subsequent sends.
+	// Note: as for methodOop_invocation_counter_overflow, the receiver of a block method is its context.
+	Recompilation r(receiver, method);
+	VMProcess::execute(&r);
+	if (PrintRecompilation and r.recompiledTrigger()) {
+		SPDLOG_INFO("loop recompilation: {} compiled, current activation continues interpreted", method->selector()->as_string());
+	}
+	return r.recompiledTrigger();
+}
+
+bool Recompilation::enqueue_compilation(Oop receiver, MethodOop method) {
+
+	// only plain sends can be queued: the key of a super send or block method depends on the stack
+	if (method->is_blockMethod())
+		return false;
+	LookupKey key(receiver->klass(), method->selector());
+	if (LookupCache::compile_time_normal_lookup(key.klass(), key.selector()) not_eq method)
+		return false;
+
+	if (not CompileQueue::enqueue(&key))
+		return false;
+	if (PrintRecompilation) {
+		SPDLOG_INFO("compilation queued: {}", key.toString());
+	}
+	return true;
+}
+
 NativeMethod *compile_method(LookupKey *key, MethodOop m) {
 
 	if (UseInliningDatabase and not m->is_blockMethod()) {
@@ -13,6 +13,8 @@
 
 class Recompilee;
 
+class LookupKey;
+
 extern std::int32_t nstages;                            // # of recompilation stages
 extern small_int_t *compileCounts;                     // # of compilations indexed by stage
 extern std::int32_t *recompileLimits;                   // recompilation limits indexed by stage
@@ -31,6 +33,9 @@ constexpr std::int32_t MAX_NATIVE_METHOD_RECOMPILATION_LEVELS = 4 - 1;  // desir
 // The global theRecompilation is set only during a recompilation.
 
 
+// compiles method for key, using the inlining database if it has an entry for key
+NativeMethod *compile_method(LookupKey *key, MethodOop m);
+
 extern NativeMethod *recompilee;         // method currently being recompiled
 extern class Recompilation *theRecompilation;   // forward declaration
 
@@ -106,6 +111,10 @@ public:
 	// entry points dealing with invocation counter overflow
 	static const char *methodOop_invocation_counter_overflow(Oop receiver, MethodOop method); // called by interpreter
 	static const char *nativeMethod_invocation_counter_overflow(Oop receiver, char *pc); // called by nativeMethods
+	static bool methodOop_loop_counter_overflow(Oop receiver, MethodOop method); // called by interpreter loops; returns whether method was recompiled
+
+	// queues the compilation of an interpreted method (see CompileQueue); returns false if it must be compiled now
+	static bool enqueue_compilation(Oop receiver, MethodOop method);
 
 protected:
 	void init();
@@ -35,7 +35,9 @@ Bootstrap::Bootstrap(const std::string &name) :
 		_new_format{false},
 		_objectCount{0},
 		_filename{name},
-		_stream{},
+		_buffer{nullptr},
+		_size{0},
+		_position{0},
 		_counter{0},
 		_countByType{},
 		_nameByTypeByte{},
@@ -111,13 +113,25 @@ void Bootstrap::load() {
 }
 
 void Bootstrap::open_file() {
-	_stream.open(_filename, std::ifstream::binary);
+	std::ifstream stream(_filename, std::ifstream::binary | std::ifstream::ate);
 
-	if (not _stream.good()) {
+	if (not stream.good()) {
 		SPDLOG_INFO("bootstrap-file-error: failed to open file [{}] for reading", _filename.c_str());
 		exit(EXIT_FAILURE);
 	}
-	SPDLOG_INFO("bootstrap-file-open: [{}]", _filename.c_str());
+
+	// read the whole file at once; decoding works on the buffer
+	_size = stream.tellg();
+	_buffer = new_c_heap_array<std::uint8_t>(_size);
+	_position = 0;
+	stream.seekg(0);
+	stream.read(reinterpret_cast<char *>( _buffer ), _size);
+
+	if (not stream.good()) {
+		SPDLOG_INFO("bootstrap-file-error: failed to read [{}] bytes from file [{}]", _size, _filename.c_str());
+		exit(EXIT_FAILURE);
+	}
+	SPDLOG_INFO("bootstrap-file-open: [{}] [{}] bytes", _filename.c_str(), _size);
 
 	_version_number = read_uint32_t();
 	check_version();
@@ -132,13 +146,17 @@ void Bootstrap::parse_file() {
 }
 
 void Bootstrap::close_file() {
-	_stream.close();
+	FreeHeap(_buffer);
+	_buffer = nullptr;
 	SPDLOG_INFO("bootstrap-file-close: [{}]", _filename.c_str());
 }
 
 void Bootstrap::summary() {
-	for (auto item: _countByType) {
-		SPDLOG_INFO("bootstrap-object-count:    {} {:28s} {}", item.first, _nameByTypeByte[item.first].c_str(), item.second);
+	for (std::size_t i = 0; i < _countByType.size(); i++) {
+		if (_countByType[i] == 0)
+			continue;
+		char typeByte = static_cast<char>( i );
+		SPDLOG_INFO("bootstrap-object-count:    {} {:28s} {}", typeByte, _nameByTypeByte[typeByte].c_str(), _countByType[i]);
 	}
 }
 
@@ -174,9 +192,10 @@ void Bootstrap::add(Oop obj) {
 // -----------------------------------------------------------------------------
 
 char Bootstrap::read_uint8_t() {
-	std::uint8_t byte;
-	_stream.read(reinterpret_cast<char *>(&byte), 1);
-	return byte;
+	if (_position >= _size) {
+		st_fatal("bootstrap file truncated");
+	}
+	return _buffer[_position++];
 }
 
 std::uint16_t Bootstrap::read_uint16_t() {
@@ -185,13 +204,16 @@ std::uint16_t Bootstrap::read_uint16_t() {
 
 std::int32_t Bootstrap::read_uint32_t() {
 
-	std::uint8_t lowByte = read_uint8_t();
-	if (lowByte < 128) {
-		return lowByte;
+	// 7 bits per byte, least significant first; the high bit is set on all but the last byte
+	std::int32_t value = 0;
+	std::int32_t shift = 0;
+	std::uint8_t byte = read_uint8_t();
+	while (byte >= 128) {
+		value += (byte % 128) << shift;
+		shift += 7;
+		byte = read_uint8_t();
 	}
-
-	std::int32_t highByte = read_uint32_t();
-	return (highByte * 128) + (lowByte % 128);
+	return value + (byte << shift);
 }
 
 
@@ -301,10 +323,10 @@ Oop Bootstrap::oopFromTable(const std::int32_t index) {
 inline char Bootstrap::getNextTypeByte() {
 
 	// get type byte
-	char typeByte = _stream.get();
+	char typeByte = read_uint8_t();
 
 	// update counters
-	_countByType[typeByte]++;
+	_countByType[static_cast<std::uint8_t>( typeByte )]++;
 	_objectCount++;
 
 	return typeByte;
@@ -459,8 +481,7 @@ Oop Bootstrap::readNextObject() {
 
 void Bootstrap::read_mark(MarkOop *mark_addr) {
 
-	char typeByte{0};
-	_stream.get(typeByte);
+	char typeByte = read_uint8_t();
 
 	MarkOop m{nullptr};
 
@@ -481,14 +502,11 @@ void Bootstrap::read_mark(MarkOop *mark_addr) {
 
 double Bootstrap::read_double() {
 	double value{0};
-	std::uint8_t *str = (std::uint8_t *) &value;
-
-	for (std::size_t i = 0; i < 8; i++) {
-		char c{0};
-		_stream.get(c);
-
-		str[i] = c;
+	if (_position + static_cast<std::int32_t>( sizeof(value) ) > _size) {
+		st_fatal("bootstrap file truncated");
 	}
+	memcpy(&value, _buffer + _position, sizeof(value));
+	_position += sizeof(value);
 
 	return value;
 }
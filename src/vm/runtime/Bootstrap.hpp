@@ -14,6 +14,9 @@
 #include <map>
 
 // Bootstrap parses and allocates memOops from a file
+//
+// The file is read into memory in one go and decoded from there; the format is a single depth-first
+// stream in which objects refer back to earlier ones by their index in the oop table.
 
 class Klass;
 
@@ -27,10 +30,12 @@ private:
 	bool _new_format;
 	std::int32_t _objectCount;
 	std::string _filename;
-	std::ifstream _stream;
+	std::uint8_t *_buffer;      // contents of the file
+	std::int32_t _size;         // size of the file
+	std::int32_t _position;     // next byte to decode
 	std::int32_t _counter;
 
-	std::map<char, std::int32_t> _countByType{};
+	std::array<std::int32_t, 256> _countByType{};
 	std::map<char, std::string> _nameByTypeByte{};
 
 	Bootstrap(const Bootstrap &); // private copy constructor -> cannot copy [-Weffc++]
@@ -8,6 +8,7 @@
 #include "vm/interpreter/CodeIterator.hpp"
 #include "vm/interpreter/InterpretedInlineCache.hpp"
 #include "vm/interpreter/Interpreter.hpp"
+#include "vm/memory/HeapPolicy.hpp"
 #include "vm/memory/MarkSweep.hpp"
 #include "vm/memory/OopFactory.hpp"
 #include "vm/memory/Scavenge.hpp"
@@ -17,6 +18,7 @@
 #include "vm/oop/ProcessOopDescriptor.hpp"
 #include "vm/platform/os.hpp"
 #include "vm/primitive/InterpretedPrimitiveCache.hpp"
+#include "vm/recompiler/CompileQueue.hpp"
 #include "vm/runtime/Delta.hpp"
 #include "vm/runtime/DeltaProcess.hpp"
 #include "vm/runtime/ErrorHandler.hpp"
@@ -229,6 +231,14 @@ bool DeltaProcess::wait_for_async_dll(std::int32_t timeout_in_ms) {
 		SPDLOG_INFO("Waiting for async {} ms", timeout_in_ms);
 	}
 
+	// use the idle time for queued compilations and the inlining database warm-up
+	if (CompileQueue::has_work()) {
+		CompileQueue::drain(CompileQueue::idle_budget(timeout_in_ms));
+		if (Processes::has_completed_async_call()) {
+			return true;
+		}
+	}
+
 	_is_idle = true;
 	bool result = os::wait_for_event_or_timer(_async_dll_completion_event, timeout_in_ms);
 	_is_idle = false;
@@ -327,6 +337,7 @@ DeltaProcess::DeltaProcess(Oop receiver, SymbolOop selector, bool createThread)
 		_last_delta_fp{nullptr},
 		_last_delta_sp{nullptr},
 		_last_delta_pc{nullptr},
+		_allocation_buffer{},
 		_is_terminating{false},
 		_time_stamp{0},
 		_debugInfo{},
@@ -387,6 +398,15 @@ void DeltaProcess::check_stack_overflow() {
 		_interrupt = false;
 	}
 
+	// a stack check is a safe point for a full collection requested by the allocation slow path; if the stack
+	// really overflows, the next check traps again
+	if (HeapPolicy::collection_requested()) {
+		_active_stack_limit = active()->_stack_limit;
+		HeapPolicy::collect_if_requested();
+		if (not isInterrupted)
+			return;
+	}
+
 	if (isInterrupted) {
 		st_assert(EnableProcessPreemption, "Should not be interrupted unless preemption enabled");
 		interruptions++;
@@ -410,6 +430,12 @@ extern "C" void check_stack_overflow() {
 }
 
 DeltaProcess::~DeltaProcess() {
+	if (this == _active_delta_process) {
+		ThreadLocalAllocationBuffer::retire_active();
+	}
+	else {
+		_allocation_buffer.retire();
+	}
 	processObject()->set_process(nullptr);
 	if (Processes::includes(this)) {
 		Processes::remove(this);
@@ -422,6 +448,15 @@ void DeltaProcess::preempt_active() {
 	_active_stack_limit = (char *) 0x7fffffff;
 }
 
+void DeltaProcess::request_stack_check() {
+	_active_stack_limit = (char *) 0x7fffffff;
+}
+
+void DeltaProcess::cancel_stack_check() {
+	if (not _interrupt and active() not_eq nullptr)
+		_active_stack_limit = active()->_stack_limit;
+}
+
 void DeltaProcess::print() {
 
 	switch (state()) {
@@ -1099,8 +1134,19 @@ bool DeltaProcess::in_vm_operation() const {
 }
 
 void DeltaProcess::set_active(DeltaProcess *p) {
+	// the allocation buffer of the active process is kept in tlab_top/tlab_end
+	if (p not_eq _active_delta_process) {
+		if (_active_delta_process not_eq nullptr) {
+			_active_delta_process->_allocation_buffer.save();
+		}
+		else {
+			ThreadLocalAllocationBuffer::retire_active();
+		}
+		p->_allocation_buffer.restore();
+	}
+
 	_active_delta_process = p;
-	_active_stack_limit = p->_stack_limit;
+	_active_stack_limit = HeapPolicy::collection_requested() ? (char *) 0x7fffffff : p->_stack_limit;
 
 	if (_active_delta_process->state() not_eq ProcessState::uncommon) {
 		_active_delta_process->set_state(ProcessState::running);
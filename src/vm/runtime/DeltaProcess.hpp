@@ -7,6 +7,7 @@
 #pragma once
 
 #include "vm/runtime/Process.hpp"
+#include "vm/memory/ThreadLocalAllocationBuffer.hpp"
 
 //
 class DeltaProcess : public Process {
@@ -21,6 +22,7 @@ private:
 	std::int32_t *_last_delta_fp;
 	Oop *_last_delta_sp;
 	const char *_last_delta_pc;      // For now only used for stack overflow
+	ThreadLocalAllocationBuffer _allocation_buffer;   // only used while the process is not active
 
 	volatile bool _is_terminating;
 
@@ -86,6 +88,10 @@ public:
 	const char *last_delta_pc() const;              //
 	void set_last_delta_pc(const char *pc);       //
 
+	ThreadLocalAllocationBuffer *allocation_buffer() {
+		return &_allocation_buffer;
+	}
+
 	ProcessState state() const;
 
 	SymbolOop status_symbol() const;
@@ -240,6 +246,11 @@ public:
 
 	static void preempt_active();
 
+	// makes the next stack check of Delta code call check_stack_overflow (see HeapPolicy::request_collection)
+	static void request_stack_check();
+
+	static void cancel_stack_check();
+
 	// create and run the main process - ie. the process for the initial thread
 	static void createMainProcess();
 
@@ -16,6 +16,7 @@ auto _ActivationShowExpressionStack = _flag<bool>("ActivationShowExpressionStack
 auto _ActivationShowFrame = _flag<bool>("ActivationShowFrame", false, "Show frame for activation");
 auto _ActivationShowNameDescs = _flag<bool>("ActivationShowNameDescs", false, "Show name desc in the printed code");
 auto _AlwaysFlushVMMessages = _flag<bool>("AlwaysFlushVMMessages", true, "Flush VM message log after every line");
+auto _BackgroundCompilationBudget = _flag<std::int32_t>("BackgroundCompilationBudget", 50, "max. time in ms spent compiling queued methods per idle period");
 auto _BlockArgAdditionalAllowedInlineCost = _flag<std::int32_t>("BlockArgAdditionalAllowedInlineCost", 35, "additional allowed cost for each block arg");
 auto _BlockArgAdditionalInstrSize = _flag<std::int32_t>("BlockArgAdditionalInstrSize", 150, "extra allowance (in instr bytes) for each block arg");
 auto _BreakAtWarning = _flag<bool>("BreakAtWarning", false, "Interrupt execution at warning?");
@@ -23,6 +24,7 @@ auto _BruteForcePropagate = _flag<bool>("BruteForcePropagate", false, "Perform b
 auto _CodeForP6 = _flag<bool>("CodeForP6", false, "Minimize use of byte registers in code generation for P6");
 auto _CodeSize = _flag<std::int32_t>("CodeSize", 20 * 1024, "size of code cache (in Kbytes)");
 auto _CodeSizeImpactsInlining = _flag<bool>("CodeSizeImpactsInlining", true, "code size is used as parameter to guide inlining");
+auto _CompileQueueSize = _flag<std::int32_t>("CompileQueueSize", 64, "max. number of queued compilations (UseBackgroundCompilation)");
 auto _CompiledCodeOnly = _flag<bool>("CompiledCodeOnly", false, "Use compiled code only");
 auto _CompilerDebug = _flag<bool>("CompilerDebug", false, "Make compiler debugging easier");
 auto _CompilerInstrsSize = _flag<std::int32_t>("CompilerInstrsSize", 50 * 1024, "max. size of NativeMethod instrs");
@@ -39,6 +41,7 @@ auto _DebugPerformance = _flag<bool>("DebugPerformance", false, "Print info usef
 auto _DeferUncommonBranches = _flag<bool>("DeferUncommonBranches", true, "Don't generate code for uncommon cases");
 auto _EdenSize = _flag<std::int32_t>("EdenSize", 512, "size of eden (in Kbytes)");
 auto _EliminateContexts = _flag<bool>("EliminateContexts", true, "Eliminate context allocations");
+auto _EliminateFloatBoxing = _flag<bool>("EliminateFloatBoxing", true, "Don't unbox floats that were boxed from an unchanged float temporary");
 auto _EliminateJumpsToJumps = _flag<bool>("EliminateJumpsToJumps", true, "Eliminate jumps to jumps");
 auto _EliminateUnneededNodes = _flag<bool>("EliminateUnneededNodes", true, "Eliminate dead code");
 auto _EnableInt3 = _flag<bool>("EnableInt3", true, "Enables/disables code generation for int3 instructions");
@@ -46,6 +49,8 @@ auto _EnableOptimizedCodeRecompilation = _flag<bool>("EnableOptimizedCodeRecompi
 auto _EnableProcessPreemption = _flag<bool>("EnableProcessPreemption", false, "Enables or disables preemption of running Smalltalk processes");
 auto _EnableTasks = _flag<bool>("EnableTasks", true, "Enable periodic tasks to be performed");
 auto _EventLogLength = _flag<std::int32_t>("EventLogLength", 1000, "Length of internal event log");
+auto _FullGCGrowthPercent = _flag<std::int32_t>("FullGCGrowthPercent", 100, "collect when the old generation grew by this % of the live data after the last collection");
+auto _FullGCMinGrowth = _flag<std::int32_t>("FullGCMinGrowth", 4 * 1024, "min. growth (in Kbytes) of the old generation between full collections");
 auto _GenTraceCalls = _flag<bool>("GenTraceCalls", false, "Generate code for TraceCalls");
 auto _GenerateFullDebugInfo = _flag<bool>("GenerateFullDebugInfo", false, "Generate debugging info for each byte code and not only for sends/traps");
 auto _GenerateHTML = _flag<bool>("GenerateHTML", false, "Generate HTML output for documentation");
@@ -53,41 +58,57 @@ auto _GenerateLiteScopeDescs = _flag<bool>("GenerateLiteScopeDescs", false, "gen
 auto _GenerateSmalltalk = _flag<bool>("GenerateSmalltalk", false, "Generate Smalltalk output for file_in");
 auto _GlobalCopyPropagate = _flag<bool>("GlobalCopyPropagate", true, "Perform global copy propagation");
 auto _HeapSweeperInterval = _flag<std::int32_t>("HeapSweeperInterval", 120, "Time interval (sec) between starting heap sweep");
+auto _HeapTargetFootprint = _flag<std::int32_t>("HeapTargetFootprint", 0, "target size of old generation (in Kbytes) before collecting (0 = derived from ReservedHeapSize)");
+auto _IncrementalMarkingStepSize = _flag<std::int32_t>("IncrementalMarkingStepSize", 64, "words (in K) scanned by a slice of UseIncrementalMarking");
+auto _IncrementalMarkingThreshold = _flag<std::int32_t>("IncrementalMarkingThreshold", 50, "start UseIncrementalMarking at this percentage of the growth triggering a full collection");
 auto _Inline = _flag<bool>("Inline", true, "Inline message sends");
 auto _InlinePrims = _flag<bool>("InlinePrims", true, "Inline some primitive calls");
 auto _InliningDatabasePruningLimit = _flag<std::int32_t>("InliningDatabasePruningLimit", 3, "Min. number of nodes in inlining structure to qualify for database");
 auto _InvocationCounterLimit = _flag<std::int32_t>("InvocationCounterLimit", 10000, "max. number of method invocations before (re-)compiling");
 auto _JumpTableSize = _flag<std::int32_t>("JumpTableSize", 8 * 1024, "size of jump table");
 auto _LRUDecayFactor = _flag<std::int32_t>("LRUDecayFactor", 2, "LRUDecayFactor");
+auto _LargeObjectThreshold = _flag<std::int32_t>("LargeObjectThreshold", 64, "size (in Kbytes) from which objects are large (UseLargeObjectAllocation)");
 auto _LocalCopyPropagate = _flag<bool>("LocalCopyPropagate", true, "Perform local copy propagation");
 auto _LogVMMessages = _flag<bool>("LogVMMessages", true, "Log all vm messages to a file");
 auto _LoopCounterLimit = _flag<std::int32_t>("LoopCounterLimit", 10000, "max. number of loop iterations before (re-)compiling");
 auto _MakeBlockMethodZombies = _flag<bool>("MakeBlockMethodZombies", false, "Make block NativeMethod zombies if needed");
+auto _MarkCompactThreads = _flag<std::int32_t>("MarkCompactThreads", 4, "number of threads (including the VM thread) used by UseMarkCompact");
 auto _MaterializeEliminatedBlocks = _flag<bool>("MaterializeEliminatedBlocks", true, "Create fake blocks for eliminated blocks when printing stack");
 auto _MaxBlockInlineCost = _flag<std::int32_t>("MaxBlockInlineCost", 70, "max. cost of block method");
 auto _MaxBlockInstrSize = _flag<std::int32_t>("MaxBlockInstrSize", 450, "max. inline size (in instr bytes) of block method");
 auto _MaxCustomization = _flag<std::int32_t>("MaxCustomization", 10, "max. number of customized method copies to create");
+auto _MaxEdenSize = _flag<std::int32_t>("MaxEdenSize", 8*1024, "max. size of eden with UseAdaptiveNewGeneration (in Kbytes)");
 auto _MaxElementPrintSize = _flag<std::int32_t>("MaxElementPrintSize", 64, "Maximum number of elements to print");
 auto _MaxFnInlineCost = _flag<std::int32_t>("MaxFnInlineCost", 40, "max. cost of normal inlined method");
 auto _MaxFnInstrSize = _flag<std::int32_t>("MaxFnInstrSize", 300, "max. inline size (in instr bytes) of normal method");
+auto _MaxHeapFreeRatio = _flag<std::int32_t>("MaxHeapFreeRatio", 70, "shrink the old generation after a full collection if more than this percentage is free");
 auto _MaxInterpretedSearchLength = _flag<std::int32_t>("MaxInterpretedSearchLength", 10, "max. number of intrepreted stack frames to traverse searching for recompilee");
 auto _MaxNmInstrSize = _flag<std::int32_t>("MaxNmInstrSize", 12000, "max. desired size (in instr bytes) of an method");
+auto _MaxPolymorphicInlineCacheEntries = _flag<std::int32_t>("MaxPolymorphicInlineCacheEntries", 8, "max. number of receiver types in a PIC before it becomes megamorphic (<= 8)");
 auto _MaxRecompilationSearchLength = _flag<std::int32_t>("MaxRecompilationSearchLength", 10, "max. number of real stack frames to traverse searching for recompilee");
 auto _MaxRecursionUnroll = _flag<std::int32_t>("MaxRecursionUnroll", 2, "max. unrolling depth of recursive methods");
+auto _MaxSurvivorSize = _flag<std::int32_t>("MaxSurvivorSize", 1024, "max. size of survivor spaces with UseAdaptiveNewGeneration (in Kbytes)");
 auto _MaxTypeCaseSize = _flag<std::int32_t>("MaxTypeCaseSize", 3, "max. number of types in typecase-based inlining");
 auto _MemoizeBlocks = _flag<bool>("MemoizeBlocks", true, "memoize (delay creation of) blocks");
 auto _MinBlockCostFraction = _flag<std::int32_t>("MinBlockCostFraction", 50, "(in %) inline block if makes up more than this fraction of parent's cost");
+auto _MinHeapFreeRatio = _flag<std::int32_t>("MinHeapFreeRatio", 40, "percentage of the old generation left free when it is shrunk after a full collection");
 auto _MinInvocationsBeforeTrust = _flag<std::int32_t>("MinInvocationsBeforeTrust", 100, "min. number of invocations required before trusting NativeMethod's PICs");
 auto _MinSendsBeforeRecompile = _flag<std::int32_t>("MinSendsBeforeRecompile", 2000, "min number of sends a method must have performed before being recompiled");
+auto _MinTypeCaseFrequency = _flag<std::int32_t>("MinTypeCaseFrequency", 10, "min. share (in percent) of a PIC's hits a receiver type needs to be inlined");
 auto _NativeMethodAgeLimit = _flag<std::int32_t>("NativeMethodAgeLimit", 2, "min. number of sweeps before NativeMethod becomes old");
 auto _NumberOfBlockAllocations = _flag<std::int32_t>("NumberOfBlockAllocations", 0, "Number of allocated blocks");
 auto _NumberOfBytecodesExecuted = _flag<std::int32_t>("NumberOfBytecodesExecuted", 0, "Number of bytecodes executed by interpreter (if tracing)");
 auto _NumberOfContextAllocations = _flag<std::int32_t>("NumberOfContextAllocations", 0, "Number of allocated block contexts");
 auto _ObjectHeapExpandSize = _flag<std::int32_t>("ObjectHeapExpandSize", 512, "Chunk size (in Kbytes) by which the object heap grows");
 auto _OldSize = _flag<std::int32_t>("OldSize", 3 * 1024, "initial size of oldspace (in Kbytes)");
+auto _OldSpaceFragmentationLimit = _flag<std::int32_t>("OldSpaceFragmentationLimit", 25, "with UseOldSpaceFreeLists, compact once this percentage of the old space is free");
 auto _OptimizeIntegerLoops = _flag<bool>("OptimizeIntegerLoops", true, "optimize integer loops");
 auto _OptimizeLoops = _flag<bool>("OptimizeLoops", true, "optimize loops (hoist type tests");
 auto _PICSize = _flag<std::int32_t>("PICSize", 128, "size of PolymorphicInlineCache cache (in Kbytes)");
+auto _ParallelScavengeThreads = _flag<std::int32_t>("ParallelScavengeThreads", 4, "number of threads (including the VM thread) used by UseParallelScavenge");
+auto _PretenureMinSize = _flag<std::int32_t>("PretenureMinSize", 64, "min. words (in K) allocated in sampled edens before a class is pretenured");
+auto _PretenureSampleInterval = _flag<std::int32_t>("PretenureSampleInterval", 4, "gather the pretenuring feedback at every n'th scavenge (UsePretenuring)");
+auto _PretenureThreshold = _flag<std::int32_t>("PretenureThreshold", 90, "pretenure a class once this percentage of its allocated words gets tenured (UsePretenuring)");
 auto _PrintAssemblyCode = _flag<bool>("PrintAssemblyCode", false, "Print assembly code");
 auto _PrintCode = _flag<bool>("PrintCode", false, "Print intermediate code");
 auto _PrintCodeCompaction = _flag<bool>("PrintCodeCompaction", false, "Print code compaction");
@@ -106,6 +127,7 @@ auto _PrintExposed = _flag<bool>("PrintExposed", false, "Print info about expose
 auto _PrintGC = _flag<bool>("PrintGC", true, "Print message at garbage collect");
 auto _PrintGlobalAllocation = _flag<bool>("PrintGlobalAllocation", false, "Print info about global register allocation");
 auto _PrintHeapAllocation = _flag<bool>("PrintHeapAllocation", false, "Print heap allocation");
+auto _PrintHeapPolicy = _flag<bool>("PrintHeapPolicy", false, "Print heap policy decisions");
 auto _PrintHexAddresses = _flag<bool>("PrintHexAddresses", true, "Print hex addresses in print outs (otherwise print 0)");
 auto _PrintInlineCacheInvalidation = _flag<bool>("PrintInlineCacheInvalidation", false, "Print inline cache invalidation");
 auto _PrintInlining = _flag<bool>("PrintInlining", false, "Print info about inlining");
@@ -143,12 +165,16 @@ auto _ReorderBBs = _flag<bool>("ReorderBBs", true, "Reorder basic blocks");
 auto _ReservedCodeSize = _flag<std::int32_t>("ReservedCodeSize", 10 * 1024, "Maximum size of code cache (in Kbytes)");
 auto _ReservedHeapSize = _flag<std::int32_t>("ReservedHeapSize", 50 * 1024, "Maximum size for object heap in Kbytes");
 auto _ReservedPICSize = _flag<std::int32_t>("ReservedPICSize", 4 * 1024, "Maximum size of PolymorphicInlineCache cache (in Kbytes)");
+auto _ScavengeBufferSize = _flag<std::int32_t>("ScavengeBufferSize", 256, "size (in words) of the survivor and promotion buffers of a scavenge thread");
+auto _ScavengePauseGoal = _flag<std::int32_t>("ScavengePauseGoal", 10, "target pause time of a scavenge with UseAdaptiveNewGeneration (in ms)");
+auto _SegregateHotCode = _flag<bool>("SegregateHotCode", true, "Place recompiled nativeMethods and first versions at opposite ends of the zone");
 auto _ShowMessageBoxOnError = _flag<bool>("ShowMessageBoxOnError", false, "Show a message box on error");
 auto _Splitting = _flag<bool>("Splitting", true, "Perform message splitting");
 auto _StackPrintLimit = _flag<std::int32_t>("StackPrintLimit", 64, "Number of stack frames to print in VM-level stack dump");
 auto _StopInterpreterAt = _flag<std::int32_t>("StopInterpreterAt", 0, "Stops interpreter execution at specified bytecode number");
 auto _SurvivorSize = _flag<std::int32_t>("SurvivorSize", 64, "size of survivor spaces (in Kbytes)");
 auto _SweeperUseTimer = _flag<bool>("SweeperUseTimer", true, "Tells whether the sweeper should use timer interrupts or compile events");
+auto _TLABSize = _flag<std::int32_t>("TLABSize", 8, "size of the per process allocation buffers with UseTLAB (in Kbytes)");
 auto _ThreadStackSize = _flag<std::int32_t>("ThreadStackSize", 512, "Size (in 1024) of each thread's stack");
 auto _TraceAllocation = _flag<bool>("TraceAllocation", false, "Trace allocation");
 auto _TraceApplyChange = _flag<bool>("TraceApplyChange", false, "Trace reflective operation");
@@ -197,20 +223,35 @@ auto _UncommonAgeBackoffFactor = _flag<std::int32_t>("UncommonAgeBackoffFactor",
 auto _UncommonInvocationLimit = _flag<std::int32_t>("UncommonInvocationLimit", 10000, "min. number of invocations uncommon NativeMethod before recompiling it again");
 auto _UncommonRecompileLimit = _flag<std::int32_t>("UncommonRecompileLimit", 5, "min. number of uncommon traps before recompiling");
 auto _UseAccessMethods = _flag<bool>("UseAccessMethods", true, "Use access methods");
+auto _UseAdaptiveNewGeneration = _flag<bool>("UseAdaptiveNewGeneration", false, "Resize eden and the survivor spaces after each scavenge (see HeapPolicy)");
+auto _UseBackgroundCompilation = _flag<bool>("UseBackgroundCompilation", false, "Queue compilations of interpreted methods and compile them when the system is idle");
+auto _UseClassHierarchyAnalysis = _flag<bool>("UseClassHierarchyAnalysis", true, "Predict the receivers of sends whose selector has a single implementation");
 auto _UseFPUStack = _flag<bool>("UseFPUStack", false, "Use FPU stack for floats (unsafe)");
 auto _UseGlobalFlatProfiling = _flag<bool>("UseGlobalFlatProfiling", true, "Include all processes when flat-profiling");
+auto _UseHeapPolicy = _flag<bool>("UseHeapPolicy", true, "Start full garbage collections automatically from the allocation slow path");
+auto _UseHeapShrinking = _flag<bool>("UseHeapShrinking", true, "Uncommit the free tail of the old generation after a full collection");
+auto _UseIncrementalMarking = _flag<bool>("UseIncrementalMarking", false, "Mark the old generation in slices after scavenges, leaving a remark to the full collection");
 auto _UseInlineCaching = _flag<bool>("UseInlineCaching", true, "Use inline caching in compiled code");
 auto _UseInliningDatabase = _flag<bool>("UseInliningDatabase", false, "Use the inlining database for recompilation");
 auto _UseInliningDatabaseEagerly = _flag<bool>("UseInliningDatabaseEagerly", false, "Use the inlining database eagerly at lookup");
+auto _UseInliningDatabaseWarmUp = _flag<bool>("UseInliningDatabaseWarmUp", false, "Compile the methods in the inlining database index when the system is idle");
 auto _UseLRUInterrupts = _flag<bool>("UseLRUInterrupts", true, "User timers for zone LRU info");
+auto _UseLargeObjectAllocation = _flag<bool>("UseLargeObjectAllocation", false, "Allocate objects of LargeObjectThreshold or more page aligned in the old generation");
+auto _UseLoopRecompilation = _flag<bool>("UseLoopRecompilation", true, "Recompile methods whose loops overflow the loop counter without waiting for the next invocation");
 auto _UseMICs = _flag<bool>("UseMICs", true, "Use MEGAMORPHIC PICs (MegamorphicInlineCache)");
+auto _UseMarkCompact = _flag<bool>("UseMarkCompact", false, "Use the parallel sliding mark-compact collector instead of MarkSweep for full collections");
 auto _UseNativeMethodAging = _flag<bool>("UseNativeMethodAging", true, "Age nativeMethods before recompiling them");
 auto _UseNewBackend = _flag<bool>("UseNewBackend", false, "Use new backend");
 auto _UseNewMakeConformant = _flag<bool>("UseNewMakeConformant", true, "Use new makeConformant function");
+auto _UseOldSpaceFreeLists = _flag<bool>("UseOldSpaceFreeLists", false, "Let full collections sweep the old space into free lists instead of compacting it");
+auto _UseParallelScavenge = _flag<bool>("UseParallelScavenge", false, "Copy the objects reachable from the scavenge roots with several worker threads");
 auto _UsePredictedMethods = _flag<bool>("UsePredictedMethods", true, "Use predicted methods");
+auto _UsePretenuring = _flag<bool>("UsePretenuring", false, "Allocate the instances of classes whose objects are nearly always tenured in the old generation");
 auto _UsePrimitiveMethods = _flag<bool>("UsePrimitiveMethods", false, "Use primitive methods");
 auto _UseRecompilation = _flag<bool>("UseRecompilation", true, "Automatically (re-)compile frequently-used methods");
+auto _UseSSE2 = _flag<bool>("UseSSE2", false, "Use SSE2 instead of the FPU for float operations");
 auto _UseSlidingSystemAverage = _flag<bool>("UseSlidingSystemAverage", true, "Compute sliding system average on the fly");
+auto _UseTLAB = _flag<bool>("UseTLAB", true, "Allocate in per process buffers carved from eden");
 auto _UseTimers = _flag<bool>("UseTimers", true, "Tells whether the VM should use timers (only used at startup)");
 auto _VerifyAfterGC = _flag<bool>("VerifyAfterGC", false, "Verify system after garbage collect");
 auto _VerifyAfterScavenge = _flag<bool>("VerifyAfterScavenge", false, "Verify system after scavenge");
@@ -221,6 +262,7 @@ auto _VerifyDebugInfo = _flag<bool>("VerifyDebugInfo", false, "Verify compiled-c
 auto _VerifyZoneOften = _flag<bool>("VerifyZoneOften", false, "Verify compiled-code zone often");
 auto _WizardMode = _flag<bool>("WizardMode", false, "Wizard debugging mode");
 auto _ZapResourceArea = _flag<bool>("ZapResourceArea", false, "Zap the resource area when deallocated");
+auto _ZombieReclaimThreshold = _flag<std::int32_t>("ZombieReclaimThreshold", 10, "percentage of the code zone taken by zombies at which the ZoneSweeper requests a (non-incremental) reclamation");
 
 
 // ----------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -128,6 +128,11 @@ void Processes::scavenge_contents() {
 	oop_iterate(&blk);
 }
 
+void Processes::retire_allocation_buffers() {
+	ALL_PROCESSES(p)
+		p->allocation_buffer()->retire();
+}
+
 void Processes::follow_roots() {
 	ALL_PROCESSES(p)
 		p->follow_roots();
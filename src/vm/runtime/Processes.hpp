@@ -45,6 +45,9 @@ public:
 	// Scavenge
 	static void scavenge_contents();
 
+	// Retires the allocation buffers of the inactive processes
+	static void retire_allocation_buffers();
+
 	// Garbage collection
 	static void follow_roots();
 
@@ -260,9 +260,14 @@ void ZoneSweeper::task() {
 
 	for (std::size_t i = 0; i < todo; i++) {
 		if (next == nullptr) {
+			// end of the pass; the zombies are flushed at the next allocation in the zone
+			if (_zombieBytes * 100 >= ZombieReclaimThreshold * Universe::code->capacity())
+				Universe::code->requestReclamation();
 			deactivate();
 			break;
 		}
+		if (next->isZombie())
+			_zombieBytes += next->size();
 		nativeMethod_task(next);
 		next = Universe::code->next_nm(next);
 	}
@@ -278,6 +283,7 @@ void ZoneSweeper::activate() {
 	if (Universe::code->numberOfNativeMethods() > 0) {
 		next = Universe::code->first_nm();
 		_excluded_nativeMethod = nullptr;
+		_zombieBytes = 0;
 		Sweeper::activate();
 	}
 	else {
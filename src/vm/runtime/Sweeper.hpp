@@ -194,11 +194,15 @@ private:
 
 extern MethodSweeper *methodSweeper;      // single instance
 
+// Sweeps through the zone, decays the invocation counters and cleans up the inline caches.
+// Also adds up the space taken by zombies, and has the zone reclaim it once it exceeds
+// ZombieReclaimThreshold percent of the zone.
 class ZoneSweeper : public CodeSweeper {
 
 private:
 	NativeMethod *_excluded_nativeMethod;
 	NativeMethod *next;
+	std::int32_t _zombieBytes;     // bytes taken by the zombies seen in this pass
 
 private:
 	NativeMethod *excluded_nativeMethod() {
@@ -222,7 +226,8 @@ private:
 public:
 	ZoneSweeper() :
 			_excluded_nativeMethod{nullptr},
-			next{nullptr} {
+			next{nullptr},
+			_zombieBytes{0} {
 	}
 
 	virtual ~ZoneSweeper() = default;
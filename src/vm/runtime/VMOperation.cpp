@@ -7,9 +7,13 @@
 #include "vm/utility/EventLog.hpp"
 #include "vm/runtime/ErrorHandler.hpp"
 #include "vm/memory/MarkSweep.hpp"
+#include "vm/memory/MarkCompact.hpp"
+#include "vm/memory/IncrementalMarking.hpp"
+#include "vm/runtime/Timer.hpp"
 #include "vm/compiler/Compiler.hpp"
 #include "vm/runtime/ResourceMark.hpp"
 #include "vm/runtime/Bootstrap.hpp"
+#include "vm/memory/SnapshotDescriptor.hpp"
 #include "vm/runtime/arguments.hpp"
 #include "VMSymbol.hpp"
 #include "vm/runtime/flags.hpp"
@@ -37,8 +41,34 @@ VM_GarbageCollect::VM_GarbageCollect() :
 		_addr{nullptr} {
 }
 
+std::int32_t VM_GarbageCollect::_mark_sweep_collections = 0;
+double VM_GarbageCollect::_mark_sweep_time = 0.0;
+std::int32_t VM_GarbageCollect::_mark_compact_collections = 0;
+double VM_GarbageCollect::_mark_compact_time = 0.0;
+
 void VM_GarbageCollect::doit() {
-	*_addr = MarkSweep::collect(*_addr);
+	// a cycle of incremental marking is finished by MarkCompact, which also does the sweeping;
+	// MarkCompact falls back to MarkSweep with more than one old space, count that as a mark-sweep
+	bool mark_compact = (UseMarkCompact or UseOldSpaceFreeLists or IncrementalMarking::is_active()) and MarkCompact::can_compact();
+
+	ElapsedTimer timer;
+	timer.start();
+	*_addr = mark_compact ? MarkCompact::collect(*_addr) : MarkSweep::collect(*_addr);
+	timer.stop();
+
+	double ms = timer.seconds() * 1000.0;
+	if (mark_compact) {
+		_mark_compact_collections++;
+		_mark_compact_time += ms;
+	}
+	else {
+		_mark_sweep_collections++;
+		_mark_sweep_time += ms;
+	}
+
+	if (PrintGC) {
+		SPDLOG_INFO("garbage collect ({}): {:.3f} ms; mark-sweep: {:d} collections, {:.3f} ms; mark-compact: {:d} collections, {:.3f} ms", mark_compact ? "mark-compact" : "mark-sweep", ms, _mark_sweep_collections, _mark_sweep_time, _mark_compact_collections, _mark_compact_time);
+	}
 }
 
 void VM_Scavenge::doit() {
@@ -101,8 +131,17 @@ void load_image() {
 
 	ResourceMark resourceMark;
 
-	Bootstrap bootstrap(image_basename);
-	bootstrap.load();
+	if (SnapshotDescriptor::is_snapshot(image_basename)) {
+		SnapshotDescriptor snapshot;
+		snapshot.read_from(image_basename);
+		if (snapshot.has_error())
+			st_fatal("failed to read snapshot");
+		Universe::cleanup_after_bootstrap();
+	}
+	else {
+		Bootstrap bootstrap(image_basename);
+		bootstrap.load();
+	}
 
 	vmSymbols::initialize();
 
@@ -119,6 +119,12 @@ private:
 	VM_GarbageCollect();
 	Oop *_addr;
 
+	// number and accumulated time (in ms) of the collections done by each collector (see UseMarkCompact)
+	static std::int32_t _mark_sweep_collections;
+	static double _mark_sweep_time;
+	static std::int32_t _mark_compact_collections;
+	static double _mark_compact_time;
+
 public:
 
 	bool is_garbage_collect() const {
@@ -141,6 +147,22 @@ public:
 	const char *name() {
 		return "garbage collect";
 	}
+
+	static std::int32_t mark_sweep_collections() {
+		return _mark_sweep_collections;
+	}
+
+	static double mark_sweep_time() {
+		return _mark_sweep_time;
+	}
+
+	static std::int32_t mark_compact_collections() {
+		return _mark_compact_collections;
+	}
+
+	static double mark_compact_time() {
+		return _mark_compact_time;
+	}
 };
 
 class VM_TerminateProcess : public VM_Operation {
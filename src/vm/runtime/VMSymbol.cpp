@@ -30,6 +30,12 @@ void vmSymbols::follow_contents() {
 	}
 }
 
+void vmSymbols::oops_do(void f(Oop *)) {
+	for (std::size_t i = 0; i < terminating_enum; i++) {
+		f((Oop *) &vm_symbols[i]);
+	}
+}
+
 void vmSymbols::relocate() {
 	for (std::size_t i = 0; i < terminating_enum; i++) {
 		Oop *p = (Oop *) &vm_symbols[i];
@@ -194,6 +194,8 @@ public:
 	// operations for memory management.
 	static void follow_contents();
 
+	static void oops_do(void f(Oop *));
+
 	static void switch_pointers(Oop from, Oop to);
 
 	static void relocate();
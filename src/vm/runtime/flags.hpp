@@ -92,7 +92,18 @@ public:
     develop( VerifyBeforeScavenge,                false, "Verify system before scavenge"                                               ) \
     develop( VerifyAfterScavenge,                 false, "Verify system after scavenge"                                                ) \
     develop( PrintScavenge,                       false, "Print message at scavenge"                                                   ) \
+    develop( UseParallelScavenge,                 false, "Copy the objects reachable from the scavenge roots with several worker threads" ) \
+    develop( UseMarkCompact,                      false, "Use the parallel sliding mark-compact collector instead of MarkSweep for full collections" ) \
+    develop( UseIncrementalMarking,               false, "Mark the old generation in slices after scavenges, leaving a remark to the full collection" ) \
+    develop( UseOldSpaceFreeLists,                false, "Let full collections sweep the old space into free lists instead of compacting it" ) \
     develop( PrintGC,                              true, "Print message at garbage collect"                                            ) \
+    develop( UseHeapPolicy,                        true, "Start full garbage collections automatically from the allocation slow path"  ) \
+    develop( UseHeapShrinking,                     true, "Uncommit the free tail of the old generation after a full collection"       ) \
+    develop( UseLargeObjectAllocation,            false, "Allocate objects of LargeObjectThreshold or more page aligned in the old generation" ) \
+    develop( UsePretenuring,                      false, "Allocate the instances of classes whose objects are nearly always tenured in the old generation" ) \
+    develop( PrintHeapPolicy,                     false, "Print heap policy decisions"                                                 ) \
+    develop( UseTLAB,                              true, "Allocate in per process buffers carved from eden"                            ) \
+    develop( UseAdaptiveNewGeneration,            false, "Resize eden and the survivor spaces after each scavenge (see HeapPolicy)"     ) \
     develop( WizardMode,                          false, "Wizard debugging mode"                                                       ) \
     develop( VerifyBeforeGC,                      false, "Verify system before garbage collect"                                        ) \
     develop( VerifyAfterGC,                       false, "Verify system after garbage collect"                                         ) \
@@ -100,6 +111,8 @@ public:
     develop( PrintVMMessages,                      true, "Print vm messages on _console"                                               ) \
     develop( CompiledCodeOnly,                    false, "Use compiled code only"                                                      ) \
     develop( UseRecompilation,                     true, "Automatically (re-)compile frequently-used methods"                          ) \
+    develop( UseLoopRecompilation,                 true, "Recompile methods whose loops overflow the loop counter without waiting for the next invocation" ) \
+    develop( UseBackgroundCompilation,             false, "Queue compilations of interpreted methods and compile them when the system is idle" ) \
     develop( UseNativeMethodAging,                 true, "Age nativeMethods before recompiling them"                                   ) \
     develop( UseInlineCaching,                     true, "Use inline caching in compiled code"                                         ) \
     develop( EnableTasks,                          true, "Enable periodic tasks to be performed"                                       ) \
@@ -112,6 +125,7 @@ public:
     develop( PrintStubRoutines,                   false, "Prints the stub routine's code"                                              ) \
     develop( UseInliningDatabase,                 false, "Use the inlining database for recompilation"                                 ) \
     develop( UseInliningDatabaseEagerly,          false, "Use the inlining database eagerly at lookup"                                 ) \
+    develop( UseInliningDatabaseWarmUp,           false, "Compile the methods in the inlining database index when the system is idle"  ) \
     develop( UseSlidingSystemAverage,              true, "Compute sliding system average on the fly"                                   ) \
     develop( UseGlobalFlatProfiling,               true, "Include all processes when flat-profiling"                                   ) \
     develop( EnableOptimizedCodeRecompilation,     true, "Enable recompilation of optimized code"                                      ) \
@@ -181,10 +195,12 @@ public:
     develop( ProfilerShowMethodHolder,             true, "Show method holder for method"                                               ) \
  \
     develop( UseMICs,                              true, "Use MEGAMORPHIC PICs (MegamorphicInlineCache)"                               ) \
+    develop( SegregateHotCode,                     true, "Place recompiled nativeMethods and first versions at opposite ends of the zone" ) \
     develop( UseLRUInterrupts,                     true, "User timers for zone LRU info"                                               ) \
     develop( UseNewBackend,                       false, "Use new backend"                                                             ) \
     develop( TryNewBackend,                       false, "Use new backend & set additional flags as needed for compilation"            ) \
     develop( UseFPUStack,                         false, "Use FPU stack for floats (unsafe)"                                           ) \
+    develop( UseSSE2,                             false, "Use SSE2 instead of the FPU for float operations"                            ) \
     develop( ReorderBBs,                           true, "Reorder basic blocks"                                                        ) \
     develop( CodeForP6,                           false, "Minimize use of byte registers in code generation for P6"                    ) \
     develop( PrintInlineCacheInvalidation,        false, "Print inline cache invalidation"                                             ) \
@@ -204,6 +220,7 @@ public:
     develop( ConstantFoldPrims,                    true, "Constant-fold primitive calls"                                               ) \
     develop( TypePredict,                          true, "Predict small_int_t/bool/array message sends"                                    ) \
     develop( TypePredictArrays,                   false, "Predict at:/at:Put: message sends"                                           ) \
+    develop( UseClassHierarchyAnalysis,            true, "Predict the receivers of sends whose selector has a single implementation"   ) \
     develop( TypeFeedback,                         true, "use type feedback data"                                                      ) \
     develop( CodeSizeImpactsInlining,              true, "code size is used as parameter to guide inlining"                            ) \
     develop( OptimizeIntegerLoops,                 true, "optimize integer loops"                                                      ) \
@@ -215,6 +232,7 @@ public:
     develop( BruteForcePropagate,                 false, "Perform brute-force global copy propagation (UNSAFE  -Urs 5/3/96)"           ) \
     develop( Splitting,                            true, "Perform message splitting"                                                   ) \
     develop( EliminateUnneededNodes,               true, "Eliminate dead code"                                                         ) \
+    develop( EliminateFloatBoxing,                 true, "Don't unbox floats that were boxed from an unchanged float temporary"        ) \
     develop( DeferUncommonBranches,                true, "Don't generate code for uncommon cases"                                      ) \
     develop( MemoizeBlocks,                        true, "memoize (delay creation of) blocks"                                          ) \
     develop( DebugPerformance,                    false, "Print info useful for performance debugging"                                 ) \
@@ -261,7 +279,26 @@ public:
     develop( ObjectHeapExpandSize,                  512, "Chunk size (in Kbytes) by which the object heap grows"                       ) \
     develop( EdenSize,                              512, "size of eden (in Kbytes)"                                                    ) \
     develop( SurvivorSize,                           64, "size of survivor spaces (in Kbytes)"                                         ) \
+    develop( TLABSize,                                8, "size of the per process allocation buffers with UseTLAB (in Kbytes)"         ) \
+    develop( MaxEdenSize,                        8*1024, "max. size of eden with UseAdaptiveNewGeneration (in Kbytes)"                 ) \
+    develop( MaxSurvivorSize,                      1024, "max. size of survivor spaces with UseAdaptiveNewGeneration (in Kbytes)"      ) \
+    develop( ScavengePauseGoal,                      10, "target pause time of a scavenge with UseAdaptiveNewGeneration (in ms)"       ) \
+    develop( ParallelScavengeThreads,                 4, "number of threads (including the VM thread) used by UseParallelScavenge"     ) \
+    develop( MarkCompactThreads,                      4, "number of threads (including the VM thread) used by UseMarkCompact"          ) \
+    develop( IncrementalMarkingThreshold,            50, "start UseIncrementalMarking at this percentage of the growth triggering a full collection" ) \
+    develop( IncrementalMarkingStepSize,             64, "words (in K) scanned by a slice of UseIncrementalMarking"        ) \
+    develop( OldSpaceFragmentationLimit,             25, "with UseOldSpaceFreeLists, compact once this percentage of the old space is free" ) \
+    develop( LargeObjectThreshold,                  64, "size (in Kbytes) from which objects are large (UseLargeObjectAllocation)"    ) \
+    develop( PretenureThreshold,                    90, "pretenure a class once this percentage of its allocated words gets tenured (UsePretenuring)" ) \
+    develop( PretenureSampleInterval,                4, "gather the pretenuring feedback at every n'th scavenge (UsePretenuring)"      ) \
+    develop( PretenureMinSize,                      64, "min. words (in K) allocated in sampled edens before a class is pretenured"   ) \
+    develop( ScavengeBufferSize,                    256, "size (in words) of the survivor and promotion buffers of a scavenge thread"   ) \
     develop( OldSize,                            3*1024, "initial size of oldspace (in Kbytes)"                                        ) \
+    develop( HeapTargetFootprint,                     0, "target size of old generation (in Kbytes) before collecting (0 = derived from ReservedHeapSize)" ) \
+    develop( FullGCGrowthPercent,                   100, "collect when the old generation grew by this % of the live data after the last collection" ) \
+    develop( FullGCMinGrowth,                    4*1024, "min. growth (in Kbytes) of the old generation between full collections"       ) \
+    develop( MinHeapFreeRatio,                       40, "percentage of the old generation left free when it is shrunk after a full collection" ) \
+    develop( MaxHeapFreeRatio,                       70, "shrink the old generation after a full collection if more than this percentage is free" ) \
     develop( ReservedCodeSize,                  10*1024, "Maximum size of code cache (in Kbytes)"                                      ) \
     develop( CodeSize,                          20*1024, "size of code cache (in Kbytes)"                                              ) \
     develop( ReservedPICSize,                    4*1024, "Maximum size of PolymorphicInlineCache cache (in Kbytes)"                    ) \
@@ -280,6 +317,8 @@ public:
  \
     develop( InvocationCounterLimit,              10000, "max. number of method invocations before (re-)compiling"                     ) \
     develop( LoopCounterLimit,                    10000, "max. number of loop iterations before (re-)compiling"                        ) \
+    develop( CompileQueueSize,                       64, "max. number of queued compilations (UseBackgroundCompilation)"              ) \
+    develop( BackgroundCompilationBudget,            50, "max. time in ms spent compiling queued methods per idle period"              ) \
  \
     develop( MaxNmInstrSize,                      12000, "max. desired size (in instr bytes) of an method"                             ) \
     develop( MinSendsBeforeRecompile,              2000, "min number of sends a method must have performed before being recompiled"            ) \
@@ -288,6 +327,8 @@ public:
     develop( MaxBlockInstrSize,                     450, "max. inline size (in instr bytes) of block method"                           ) \
     develop( MaxRecursionUnroll,                      2, "max. unrolling depth of recursive methods"                                   ) \
     develop( MaxTypeCaseSize,                         3, "max. number of types in typecase-based inlining"                             ) \
+    develop( MinTypeCaseFrequency,                   10, "min. share (in percent) of a PIC's hits a receiver type needs to be inlined"   ) \
+    develop( MaxPolymorphicInlineCacheEntries,        8, "max. number of receiver types in a PIC before it becomes megamorphic (<= 8)"  ) \
     develop( UncommonRecompileLimit,                  5, "min. number of uncommon traps before recompiling"                            ) \
     develop( UncommonInvocationLimit,             10000, "min. number of invocations uncommon NativeMethod before recompiling it again"      ) \
     develop( UncommonAgeBackoffFactor,                4, "for exponential back-off of UncommonAgeLimit based on NativeMethod version"  ) \
@@ -296,6 +337,7 @@ public:
     develop( MaxRecompilationSearchLength,           10, "max. number of real stack frames to traverse searching for recompilee"            ) \
     develop( MaxInterpretedSearchLength,             10, "max. number of interpreted stack frames to traverse searching for recompilee"     ) \
     develop( CounterHalfLifeTime,                    30, "time (in seconds) in which invocation counters decay by half"                ) \
+    develop( ZombieReclaimThreshold,                 10, "percentage of the code zone taken by zombies at which the ZoneSweeper requests a (non-incremental) reclamation" ) \
     develop( MaxCustomization,                       10, "max. number of customized method copies to create"                                   ) \
  \
     develop( StopInterpreterAt,                       0, "Stops interpreter execution at specified bytecode number"                    ) \
@@ -0,0 +1,252 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/utility/StringOps.hpp"
+#include "vm/memory/util.hpp"
+#include "vm/runtime/flags.hpp"
+
+#include <cstring>
+#include <emmintrin.h>
+
+
+static std::int32_t sub_sign(std::int32_t a, std::int32_t b) {
+	if (a < b)
+		return -1;
+
+	if (a > b)
+		return 1;
+
+	return 0;
+}
+
+
+// SSE2 kernels
+//
+// The indexable parts of byte arrays are only word aligned, so all loads and stores are unaligned.
+// A 16 byte compare yields a bit mask (one bit per byte) of which the lowest set bit is the first hit.
+
+__attribute__((target("sse2")))
+static std::int32_t sse2_mismatch(const std::uint8_t *a, const std::uint8_t *b, std::int32_t length) {
+	std::int32_t i = 0;
+	for (; i + 16 <= length; i += 16) {
+		__m128i x = _mm_loadu_si128((const __m128i *) (a + i));
+		__m128i y = _mm_loadu_si128((const __m128i *) (b + i));
+		std::uint32_t equal = _mm_movemask_epi8(_mm_cmpeq_epi8(x, y));
+		if (equal not_eq 0xFFFF)
+			return i + __builtin_ctz(~equal);
+	}
+	for (; i < length; i++) {
+		if (a[i] not_eq b[i])
+			return i;
+	}
+	return length;
+}
+
+__attribute__((target("sse2")))
+static std::int32_t sse2_mismatch(const std::uint16_t *a, const std::uint16_t *b, std::int32_t length) {
+	std::int32_t i = 0;
+	for (; i + 8 <= length; i += 8) {
+		__m128i x = _mm_loadu_si128((const __m128i *) (a + i));
+		__m128i y = _mm_loadu_si128((const __m128i *) (b + i));
+		std::uint32_t equal = _mm_movemask_epi8(_mm_cmpeq_epi16(x, y));
+		if (equal not_eq 0xFFFF)
+			return i + __builtin_ctz(~equal) / 2;
+	}
+	for (; i < length; i++) {
+		if (a[i] not_eq b[i])
+			return i;
+	}
+	return length;
+}
+
+__attribute__((target("sse2")))
+static std::int32_t sse2_index_of(const std::uint8_t *s, std::int32_t length, std::uint8_t c) {
+	__m128i pattern = _mm_set1_epi8((char) c);
+	std::int32_t i = 0;
+	for (; i + 16 <= length; i += 16) {
+		std::uint32_t hits = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) (s + i)), pattern));
+		if (hits)
+			return i + __builtin_ctz(hits);
+	}
+	for (; i < length; i++) {
+		if (s[i] == c)
+			return i;
+	}
+	return -1;
+}
+
+__attribute__((target("sse2")))
+static std::int32_t sse2_index_of(const std::uint16_t *s, std::int32_t length, std::uint16_t c) {
+	__m128i pattern = _mm_set1_epi16((short) c);
+	std::int32_t i = 0;
+	for (; i + 8 <= length; i += 8) {
+		std::uint32_t hits = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *) (s + i)), pattern));
+		if (hits)
+			return i + __builtin_ctz(hits) / 2;
+	}
+	for (; i < length; i++) {
+		if (s[i] == c)
+			return i;
+	}
+	return -1;
+}
+
+// Substring search: 16 candidate positions are filtered at once by comparing both the first and the
+// last byte of the pattern; only the survivors are compared in full.
+__attribute__((target("sse2")))
+static std::int32_t sse2_index_of(const std::uint8_t *s, std::int32_t length, const std::uint8_t *pattern, std::int32_t pattern_length) {
+	__m128i first = _mm_set1_epi8((char) pattern[0]);
+	__m128i last = _mm_set1_epi8((char) pattern[pattern_length - 1]);
+	std::int32_t i = 0;
+	for (; i + pattern_length - 1 + 16 <= length; i += 16) {
+		__m128i block_first = _mm_loadu_si128((const __m128i *) (s + i));
+		__m128i block_last = _mm_loadu_si128((const __m128i *) (s + i + pattern_length - 1));
+		std::uint32_t candidates = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last)));
+		while (candidates) {
+			std::int32_t index = i + __builtin_ctz(candidates);
+			if (pattern_length <= 2 or memcmp(s + index + 1, pattern + 1, pattern_length - 2) == 0)
+				return index;
+			candidates &= candidates - 1;
+		}
+	}
+	for (; i + pattern_length <= length; i++) {
+		if (s[i] == pattern[0] and memcmp(s + i, pattern, pattern_length) == 0)
+			return i;
+	}
+	return -1;
+}
+
+__attribute__((target("sse2")))
+static void sse2_fill(std::uint16_t *s, std::int32_t length, std::uint16_t c) {
+	__m128i value = _mm_set1_epi16((short) c);
+	std::int32_t i = 0;
+	for (; i + 8 <= length; i += 8) {
+		_mm_storeu_si128((__m128i *) (s + i), value);
+	}
+	for (; i < length; i++) {
+		s[i] = c;
+	}
+}
+
+__attribute__((target("sse2")))
+static bool sse2_narrow(std::uint8_t *to, const std::uint16_t *from, std::int32_t length) {
+	__m128i high = _mm_set1_epi16((short) 0xFF00);
+	std::int32_t i = 0;
+	for (; i + 16 <= length; i += 16) {
+		__m128i x = _mm_loadu_si128((const __m128i *) (from + i));
+		__m128i y = _mm_loadu_si128((const __m128i *) (from + i + 8));
+		__m128i wide = _mm_and_si128(_mm_or_si128(x, y), high);
+		if (_mm_movemask_epi8(_mm_cmpeq_epi16(wide, _mm_setzero_si128())) not_eq 0xFFFF)
+			return false;
+		_mm_storeu_si128((__m128i *) (to + i), _mm_packus_epi16(x, y));
+	}
+	for (; i < length; i++) {
+		if (from[i] >= (1 << 8))
+			return false;
+		to[i] = (std::uint8_t) from[i];
+	}
+	return true;
+}
+
+
+// Scalar kernels
+
+static std::int32_t scalar_mismatch(const std::uint8_t *a, const std::uint8_t *b, std::int32_t length) {
+	for (std::int32_t i = 0; i < length; i++) {
+		if (a[i] not_eq b[i])
+			return i;
+	}
+	return length;
+}
+
+static std::int32_t scalar_mismatch(const std::uint16_t *a, const std::uint16_t *b, std::int32_t length) {
+	for (std::int32_t i = 0; i < length; i++) {
+		if (a[i] not_eq b[i])
+			return i;
+	}
+	return length;
+}
+
+
+// StringOps
+
+std::int32_t StringOps::compare(const std::uint8_t *a, std::int32_t a_length, const std::uint8_t *b, std::int32_t b_length) {
+	std::int32_t length = min(a_length, b_length);
+	std::int32_t i = UseSSE2 ? sse2_mismatch(a, b, length) : scalar_mismatch(a, b, length);
+	if (i < length)
+		return sub_sign(a[i], b[i]);
+	return sub_sign(a_length, b_length);
+}
+
+bool StringOps::equals(const std::uint8_t *a, const std::uint8_t *b, std::int32_t length) {
+	if (UseSSE2)
+		return sse2_mismatch(a, b, length) == length;
+	return memcmp(a, b, length) == 0;
+}
+
+std::int32_t StringOps::index_of(const std::uint8_t *s, std::int32_t length, std::uint8_t c) {
+	if (UseSSE2)
+		return sse2_index_of(s, length, c);
+	const void *hit = memchr(s, c, length);
+	return hit == nullptr ? -1 : (const std::uint8_t *) hit - s;
+}
+
+std::int32_t StringOps::index_of(const std::uint8_t *s, std::int32_t length, const std::uint8_t *pattern, std::int32_t pattern_length) {
+	if (pattern_length == 0)
+		return 0;
+	if (pattern_length > length)
+		return -1;
+	if (UseSSE2)
+		return sse2_index_of(s, length, pattern, pattern_length);
+
+	for (std::int32_t i = 0; i + pattern_length <= length; i++) {
+		if (s[i] == pattern[0] and memcmp(s + i, pattern, pattern_length) == 0)
+			return i;
+	}
+	return -1;
+}
+
+void StringOps::fill(std::uint8_t *s, std::int32_t length, std::uint8_t c) {
+	memset(s, c, length);
+}
+
+std::int32_t StringOps::compare(const std::uint16_t *a, std::int32_t a_length, const std::uint16_t *b, std::int32_t b_length) {
+	std::int32_t length = min(a_length, b_length);
+	std::int32_t i = UseSSE2 ? sse2_mismatch(a, b, length) : scalar_mismatch(a, b, length);
+	if (i < length)
+		return sub_sign(a[i], b[i]);
+	return sub_sign(a_length, b_length);
+}
+
+std::int32_t StringOps::index_of(const std::uint16_t *s, std::int32_t length, std::uint16_t c) {
+	if (UseSSE2)
+		return sse2_index_of(s, length, c);
+	for (std::int32_t i = 0; i < length; i++) {
+		if (s[i] == c)
+			return i;
+	}
+	return -1;
+}
+
+void StringOps::fill(std::uint16_t *s, std::int32_t length, std::uint16_t c) {
+	if (UseSSE2) {
+		sse2_fill(s, length, c);
+		return;
+	}
+	for (std::int32_t i = 0; i < length; i++) {
+		s[i] = c;
+	}
+}
+
+bool StringOps::narrow(std::uint8_t *to, const std::uint16_t *from, std::int32_t length) {
+	if (UseSSE2)
+		return sse2_narrow(to, from, length);
+	for (std::int32_t i = 0; i < length; i++) {
+		if (from[i] >= (1 << 8))
+			return false;
+		to[i] = (std::uint8_t) from[i];
+	}
+	return true;
+}
@@ -0,0 +1,41 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+
+
+// StringOps provides the bulk operations on the indexable parts of byte and double byte arrays.
+//
+// When UseSSE2 is on, the operations work on 16 bytes at a time; otherwise they fall back to
+// scalar loops (or the C library). Indices are 0 based; a search returns -1 if nothing was found.
+// Compares return -1, 0 or 1, like ByteArrayOopDescriptor::compare.
+
+class StringOps : AllStatic {
+
+public:
+	// byte strings
+	static std::int32_t compare(const std::uint8_t *a, std::int32_t a_length, const std::uint8_t *b, std::int32_t b_length);
+
+	static bool equals(const std::uint8_t *a, const std::uint8_t *b, std::int32_t length);
+
+	static std::int32_t index_of(const std::uint8_t *s, std::int32_t length, std::uint8_t c);
+
+	static std::int32_t index_of(const std::uint8_t *s, std::int32_t length, const std::uint8_t *pattern, std::int32_t pattern_length);
+
+	static void fill(std::uint8_t *s, std::int32_t length, std::uint8_t c);
+
+	// double byte strings
+	static std::int32_t compare(const std::uint16_t *a, std::int32_t a_length, const std::uint16_t *b, std::int32_t b_length);
+
+	static std::int32_t index_of(const std::uint16_t *s, std::int32_t length, std::uint16_t c);
+
+	static void fill(std::uint16_t *s, std::int32_t length, std::uint16_t c);
+
+	// Copies the double bytes to to, provided all of them fit into a byte; returns false otherwise.
+	static bool narrow(std::uint8_t *to, const std::uint16_t *from, std::int32_t length);
+};
@@ -0,0 +1,83 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/platform/platform.hpp"
+#include "vm/assembler/CodeBuffer.hpp"
+#include "vm/assembler/Assembler.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+
+class AssemblerSSE2Tests : public ::testing::Test {
+
+protected:
+    char       buffer[ 32 ];
+    CodeBuffer *code;
+    Assembler  *masm;
+
+
+    void SetUp() override {
+        code = new CodeBuffer( buffer, sizeof( buffer ) );
+        masm = new Assembler( code );
+    }
+
+
+    void TearDown() override {
+        delete masm;
+        delete code;
+    }
+
+
+    void checkCode( std::vector<std::uint8_t> expected ) {
+        ASSERT_EQ( (std::int32_t) expected.size(), masm->offset() );
+        for ( std::size_t i = 0; i < expected.size(); i++ ) {
+            EXPECT_EQ( expected[ i ], (std::uint8_t) buffer[ i ] ) << "byte " << i;
+        }
+    }
+
+};
+
+
+TEST_F( AssemblerSSE2Tests, movsdShouldLoadFromMemory ) {
+    masm->movsd( xmm0, Address( eax ) );
+    checkCode( { 0xF2, 0x0F, 0x10, 0x00 } );
+}
+
+
+TEST_F( AssemblerSSE2Tests, movsdShouldStoreToMemory ) {
+    masm->movsd( Address( ebp, -8 ), xmm1 );
+    checkCode( { 0xF2, 0x0F, 0x11, 0x4D, 0xF8 } );
+}
+
+
+TEST_F( AssemblerSSE2Tests, addsdShouldEncodeRegisters ) {
+    masm->addsd( xmm0, xmm1 );
+    checkCode( { 0xF2, 0x0F, 0x58, 0xC1 } );
+}
+
+
+TEST_F( AssemblerSSE2Tests, sqrtsdShouldEncodeRegisters ) {
+    masm->sqrtsd( xmm2, xmm3 );
+    checkCode( { 0xF2, 0x0F, 0x51, 0xD3 } );
+}
+
+
+TEST_F( AssemblerSSE2Tests, ucomisdShouldUseOperandSizePrefix ) {
+    masm->ucomisd( xmm1, xmm0 );
+    checkCode( { 0x66, 0x0F, 0x2E, 0xC8 } );
+}
+
+
+TEST_F( AssemblerSSE2Tests, psllqShouldEmitImmediate ) {
+    masm->psllq( xmm1, 63 );
+    checkCode( { 0x66, 0x0F, 0x73, 0xF1, 0x3F } );
+}
+
+
+TEST_F( AssemblerSSE2Tests, cvtsi2sdShouldConvertFromGeneralRegister ) {
+    masm->cvtsi2sd( xmm0, eax );
+    checkCode( { 0xF2, 0x0F, 0x2A, 0xC0 } );
+}
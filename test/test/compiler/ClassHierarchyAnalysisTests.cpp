@@ -0,0 +1,78 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/lookup/ClassHierarchyAnalysis.hpp"
+#include "vm/lookup/LookupCache.hpp"
+#include "vm/runtime/ResourceMark.hpp"
+
+#include <gtest/gtest.h>
+
+
+class ClassHierarchyAnalysisTests : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        ClassHierarchyAnalysis::flush();
+    }
+
+
+    void TearDown() override {
+        ClassHierarchyAnalysis::flush();
+    }
+
+};
+
+
+TEST_F( ClassHierarchyAnalysisTests, unimplementedSelectorShouldHaveNoReceivers ) {
+    ResourceMark resourceMark;
+    SymbolOop selector = OopFactory::new_symbol( "classHierarchyAnalysisTestUnimplemented" );
+    ASSERT_EQ( nullptr, ClassHierarchyAnalysis::unique_implementation_receivers( selector, ClassHierarchyAnalysis::max_klasses ) );
+}
+
+
+TEST_F( ClassHierarchyAnalysisTests, overriddenSelectorShouldHaveNoReceivers ) {
+    ResourceMark resourceMark;
+    SymbolOop selector = OopFactory::new_symbol( "printOn:" );
+    ASSERT_EQ( nullptr, ClassHierarchyAnalysis::unique_implementation_receivers( selector, ClassHierarchyAnalysis::max_klasses ) );
+}
+
+
+TEST_F( ClassHierarchyAnalysisTests, cachedAnswerShouldMatchComputedOne ) {
+    ResourceMark resourceMark;
+    SymbolOop selector = OopFactory::new_symbol( "=" );
+    GrowableArray<KlassOop> *first  = ClassHierarchyAnalysis::unique_implementation_receivers( selector, ClassHierarchyAnalysis::max_klasses );
+    GrowableArray<KlassOop> *second = ClassHierarchyAnalysis::unique_implementation_receivers( selector, ClassHierarchyAnalysis::max_klasses );
+    ASSERT_EQ( first == nullptr, second == nullptr );
+    if ( first ) {
+        ASSERT_EQ( first->length(), second->length() );
+        for ( std::size_t i = 0; i < first->length(); i++ )
+            ASSERT_EQ( first->at( i ), second->at( i ) );
+    }
+}
+
+
+TEST_F( ClassHierarchyAnalysisTests, uniqueSelectorShouldHaveItsUnderstandingKlasses ) {
+    ResourceMark resourceMark;
+    // only DeltaParameterTest implements populatePIC, and it has no subclasses
+    SymbolOop               selector = OopFactory::new_symbol( "populatePIC" );
+    GrowableArray<KlassOop> *klasses = ClassHierarchyAnalysis::unique_implementation_receivers( selector, ClassHierarchyAnalysis::max_klasses );
+    ASSERT_TRUE( klasses != nullptr );
+    ASSERT_EQ( 1, static_cast<std::int32_t>( klasses->length() ) );
+    ASSERT_EQ( KlassOop( Universe::find_global( "DeltaParameterTest" ) ), klasses->at( 0 ) );
+}
+
+
+TEST_F( ClassHierarchyAnalysisTests, lookupCacheFlushShouldFlushAnswers ) {
+    ResourceMark resourceMark;
+    SymbolOop selector = OopFactory::new_symbol( "populatePIC" );
+    ClassHierarchyAnalysis::unique_implementation_receivers( selector, ClassHierarchyAnalysis::max_klasses );
+    ASSERT_TRUE( ClassHierarchyAnalysis::is_cached( selector ) );
+
+    LookupCache::flush();
+    ASSERT_FALSE( ClassHierarchyAnalysis::is_cached( selector ) );
+}
@@ -0,0 +1,183 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/lookup/LookupKey.hpp"
+#include "vm/lookup/LookupCache.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/oop/MethodOopDescriptor.hpp"
+#include "vm/recompiler/Recompilation.hpp"
+#include "vm/recompiler/CompileQueue.hpp"
+#include "vm/code/Zone.hpp"
+#include "vm/code/InliningDatabase.hpp"
+#include "vm/runtime/flags.hpp"
+
+#include <gtest/gtest.h>
+
+
+class CompileQueueTests : public ::testing::Test {
+
+protected:
+    KlassOop     objectClass;
+    bool         useBackgroundCompilation;
+    bool         useRecompilation;
+    bool         useInliningDatabase;
+    bool         useInliningDatabaseWarmUp;
+    std::int32_t pruningLimit;
+    std::int32_t budget;
+
+
+    void SetUp() override {
+        objectClass              = KlassOop( Universe::find_global( "Object" ) );
+        useBackgroundCompilation = UseBackgroundCompilation;
+        useRecompilation          = UseRecompilation;
+        useInliningDatabase       = UseInliningDatabase;
+        useInliningDatabaseWarmUp = UseInliningDatabaseWarmUp;
+        pruningLimit              = InliningDatabasePruningLimit;
+        budget                    = BackgroundCompilationBudget;
+        CompileQueue::clear();
+    }
+
+
+    void TearDown() override {
+        UseBackgroundCompilation    = useBackgroundCompilation;
+        UseRecompilation             = useRecompilation;
+        UseInliningDatabase          = useInliningDatabase;
+        UseInliningDatabaseWarmUp    = useInliningDatabaseWarmUp;
+        InliningDatabasePruningLimit = pruningLimit;
+        BackgroundCompilationBudget  = budget;
+        CompileQueue::clear();
+    }
+
+};
+
+
+TEST_F( CompileQueueTests, enqueueShouldAddKey ) {
+    LookupKey key( objectClass, OopFactory::new_symbol( "=" ) );
+    ASSERT_TRUE( CompileQueue::enqueue( &key ) );
+    ASSERT_EQ( 1, CompileQueue::length() );
+    ASSERT_TRUE( CompileQueue::includes( &key ) );
+}
+
+
+TEST_F( CompileQueueTests, enqueueShouldIgnoreDuplicates ) {
+    LookupKey key( objectClass, OopFactory::new_symbol( "=" ) );
+    ASSERT_TRUE( CompileQueue::enqueue( &key ) );
+    ASSERT_TRUE( CompileQueue::enqueue( &key ) );
+    ASSERT_EQ( 1, CompileQueue::length() );
+}
+
+
+TEST_F( CompileQueueTests, enqueueShouldFailWhenFull ) {
+    char selector[ 32 ];
+    for ( std::int32_t i = 0; i < CompileQueueSize; i++ ) {
+        sprintf( selector, "compileQueueTest%d", i );
+        LookupKey key( objectClass, OopFactory::new_symbol( selector ) );
+        ASSERT_TRUE( CompileQueue::enqueue( &key ) );
+    }
+    LookupKey key( objectClass, OopFactory::new_symbol( "compileQueueTestFull" ) );
+    ASSERT_FALSE( CompileQueue::enqueue( &key ) );
+    ASSERT_EQ( CompileQueueSize, CompileQueue::length() );
+}
+
+
+TEST_F( CompileQueueTests, clearShouldEmptyQueue ) {
+    LookupKey key( objectClass, OopFactory::new_symbol( "=" ) );
+    CompileQueue::enqueue( &key );
+    CompileQueue::clear();
+    ASSERT_TRUE( CompileQueue::is_empty() );
+    ASSERT_FALSE( CompileQueue::includes( &key ) );
+}
+
+
+TEST_F( CompileQueueTests, drainShouldDoNothingWithoutWork ) {
+    bool warmUp = UseInliningDatabaseWarmUp;
+    UseInliningDatabaseWarmUp = false;
+    ASSERT_FALSE( CompileQueue::has_work() );
+    ASSERT_EQ( 0, CompileQueue::drain( 1000 ) );
+    UseInliningDatabaseWarmUp = warmUp;
+}
+
+
+TEST_F( CompileQueueTests, drainShouldCompileQueuedMethod ) {
+    UseBackgroundCompilation = true;
+    Universe::code->flush();
+    LookupKey key( objectClass, OopFactory::new_symbol( "=" ) );
+    ASSERT_TRUE( Universe::code->lookup( &key ) == nullptr );
+
+    ASSERT_TRUE( CompileQueue::enqueue( &key ) );
+    std::int32_t compiled = CompileQueue::compiled();
+    ASSERT_EQ( 1, CompileQueue::drain( 10000 ) );
+    ASSERT_TRUE( CompileQueue::is_empty() );
+    ASSERT_EQ( compiled + 1, CompileQueue::compiled() );
+    ASSERT_TRUE( Universe::code->lookup( &key ) != nullptr );
+}
+
+
+TEST_F( CompileQueueTests, idleBudgetShouldNotBeZeroWhenWaitingForever ) {
+    BackgroundCompilationBudget = 50;
+    ASSERT_EQ( 50, CompileQueue::idle_budget( 0 ) );
+    ASSERT_EQ( 50, CompileQueue::idle_budget( -1 ) );
+    ASSERT_EQ( 20, CompileQueue::idle_budget( 20 ) );
+    ASSERT_EQ( 50, CompileQueue::idle_budget( 1000 ) );
+}
+
+
+TEST_F( CompileQueueTests, invocationCounterOverflowShouldQueueCompilation ) {
+    UseBackgroundCompilation = true;
+    UseRecompilation         = true;
+    Universe::code->flush();
+    LookupKey    key( objectClass, OopFactory::new_symbol( "=" ) );
+    MethodOop    method   = LookupCache::compile_time_normal_lookup( key.klass(), key.selector() );
+    ASSERT_TRUE( method != nullptr );
+    Oop          receiver = objectClass->klass_part()->allocateObject();
+    std::int32_t oldCount = method->invocation_count();
+
+    // the requester continues interpreted
+    ASSERT_EQ( nullptr, Recompilation::methodOop_invocation_counter_overflow( receiver, method ) );
+    ASSERT_TRUE( CompileQueue::includes( &key ) );
+    ASSERT_EQ( 0, method->invocation_count() );
+    ASSERT_TRUE( Universe::code->lookup( &key ) == nullptr );
+
+    method->set_invocation_count( oldCount );
+}
+
+
+TEST_F( CompileQueueTests, drainShouldCompileInliningDatabaseEntry ) {
+    UseBackgroundCompilation     = true;
+    InliningDatabasePruningLimit = 0;
+    Universe::code->flush();
+    LookupKey key( objectClass, OopFactory::new_symbol( "=" ) );
+    ASSERT_TRUE( CompileQueue::enqueue( &key ) );
+    ASSERT_EQ( 1, CompileQueue::drain( 10000 ) );
+    NativeMethod *nm = Universe::code->lookup( &key );
+    ASSERT_TRUE( nm != nullptr );
+
+    // seed the database with the method, then drop its code as a restarted system would
+    const char *directory = InliningDatabase::directory();
+    InliningDatabase::set_directory( "./.inlining-tests" );
+    InliningDatabase::reset_lookup_table();
+    ASSERT_TRUE( InliningDatabase::file_out( nm ) );
+    Universe::code->flush();
+    ASSERT_TRUE( Universe::code->lookup( &key ) == nullptr );
+
+    UseBackgroundCompilation  = false;
+    UseInliningDatabase       = true;
+    UseInliningDatabaseWarmUp = true;
+    ASSERT_TRUE( CompileQueue::has_work() );
+    std::int32_t warmedUp = CompileQueue::warmed_up();
+    ASSERT_EQ( 1, CompileQueue::drain( 10000 ) );
+    ASSERT_EQ( warmedUp + 1, CompileQueue::warmed_up() );
+    ASSERT_FALSE( CompileQueue::has_work() );
+
+    nm = Universe::code->lookup( &key );
+    ASSERT_TRUE( nm != nullptr );
+    ASSERT_TRUE( nm->_lookupKey.equal( &key ) );
+
+    InliningDatabase::reset_lookup_table();
+    InliningDatabase::set_directory( directory );
+}
@@ -246,7 +246,7 @@ TEST_F( CompilerTests, recompileZombieForcingFlush ) {
         Handle setup( OopFactory::new_symbol( "testSetup2" ) );
         Handle varClass( Universe::find_global( "NonInlinedBlockTest" ) );
         Universe::code->flush();
-        Universe::code->compact();
+        Universe::code->reclaim();
         LookupCache::flush();
         ASSERT_TRUE( lookup( "NonInlinedBlockTest", "exercise2:value:" ) == nullptr );
         clearICs( "NonInlinedBlockTest", "testSetup2" );
@@ -0,0 +1,113 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/lookup/LookupKey.hpp"
+#include "vm/lookup/LookupResult.hpp"
+#include "vm/lookup/LookupCache.hpp"
+#include "vm/interpreter/Floats.hpp"
+#include "vm/compiler/Node.hpp"
+#include "vm/compiler/NodeFactory.hpp"
+#include "vm/compiler/Compiler.hpp"
+#include "vm/compiler/Scope.hpp"
+#include "vm/runtime/ResourceMark.hpp"
+
+#include <gtest/gtest.h>
+
+
+// float_floatify of a box that float_unaryToOop just made from a float temporary should
+// copy the temporary instead of unboxing again, unless the temporary changed in between.
+
+class FloatBoxingTests : public ::testing::Test {
+
+protected:
+    HeapResourceMark *mark;
+    InlinedScope     *topScope;
+    NodeBuilder      *gen;
+    bool             eliminateFloatBoxing;
+    bool             useFPUStack;
+
+
+    void SetUp() override {
+        mark                 = new HeapResourceMark();
+        eliminateFloatBoxing = EliminateFloatBoxing;
+        useFPUStack          = UseFPUStack;
+        EliminateFloatBoxing = true;
+        UseFPUStack          = false;
+
+        LookupKey    key( KlassOop( Universe::find_global( "Object" ) ), OopFactory::new_symbol( "=" ) );
+        LookupResult result = LookupCache::lookup( &key );
+
+        theCompiler = new Compiler( &key, result.method() );
+        topScope    = theCompiler->topScope;
+        theCompiler->enterScope( topScope );
+        topScope->createFloatTemporaries( 2 );
+
+        NodeFactory::_cumulativeCost = 0;
+        gen                          = topScope->gen();
+        gen->setCurrent( NodeFactory::createAndRegisterNode<NopNode>() );
+    }
+
+
+    void TearDown() override {
+        EliminateFloatBoxing = eliminateFloatBoxing;
+        UseFPUStack          = useFPUStack;
+        theCompiler          = nullptr;
+        delete mark;
+        mark = nullptr;
+    }
+
+
+    PseudoRegister *floatTemporary( std::int32_t fno ) {
+        return topScope->floatTemporary( fno )->pseudoRegister();
+    }
+
+
+    // float(1) := (float(0) boxed) unboxed, with float(0) optionally changed after the boxing
+    void boxAndUnbox( bool assignSourceInBetween ) {
+        gen->float_set( 0, OopFactory::new_double( 1.5 ) );
+        gen->float_unaryToOop( Floats::Function::oopify, 0 );
+        if ( assignSourceInBetween )
+            gen->float_set( 0, OopFactory::new_double( 2.5 ) );
+        gen->float_floatify( Floats::Function::floatify, 1 );
+    }
+
+
+    NonTrivialNode *last() {
+        return (NonTrivialNode *) gen->current();
+    }
+
+
+    void checkUnboxed() {
+        ASSERT_TRUE( last()->isArithNode() );
+        ASSERT_EQ( ArithOpCode::f2FloatArithOp, ( (ArithmeticNode *) last() )->op() );
+        ASSERT_EQ( floatTemporary( 1 ), last()->dest() );
+    }
+
+};
+
+
+TEST_F( FloatBoxingTests, unboxOfFreshBoxShouldCopyTheSource ) {
+    boxAndUnbox( false );
+
+    ASSERT_TRUE( last()->isAssignNode() );
+    ASSERT_EQ( floatTemporary( 0 ), last()->src() );
+    ASSERT_EQ( floatTemporary( 1 ), last()->dest() );
+}
+
+
+TEST_F( FloatBoxingTests, unboxShouldStayWhenSourceWasAssigned ) {
+    boxAndUnbox( true );
+    checkUnboxed();
+}
+
+
+TEST_F( FloatBoxingTests, unboxShouldStayWhenEliminationIsOff ) {
+    EliminateFloatBoxing = false;
+    boxAndUnbox( false );
+    checkUnboxed();
+}
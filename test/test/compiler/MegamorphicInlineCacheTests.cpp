@@ -0,0 +1,163 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/code/CompiledInlineCache.hpp"
+#include "vm/code/PolymorphicInlineCache.hpp"
+#include "vm/lookup/LookupKey.hpp"
+#include "vm/lookup/LookupCache.hpp"
+
+#include "test/compiler/CompilerTests.hpp"
+#include "test/runtime/testProcess.hpp"
+
+#include <gtest/gtest.h>
+
+
+// The table of a MIC is filled and probed by the MIC stub routine; these tests fill it the way the stub does
+// and check the probe and the flushes, which must agree with the LookupCache.
+
+static CompiledInlineCache *firstIC;
+
+
+static void findFirstIC( CompiledInlineCache *ic ) {
+    if ( firstIC == nullptr )
+        firstIC = ic;
+}
+
+
+class MegamorphicInlineCacheTests : public CompilerTests {
+
+protected:
+    PolymorphicInlineCache *mic;
+    KlassOop               fixtureA;
+    KlassOop               fixtureB;
+    MethodOop              method;
+    bool                   inline_;
+
+
+    void SetUp() override {
+        CompilerTests::SetUp();
+        mic      = nullptr;
+        inline_  = Inline;
+        fixtureA = KlassOop( Universe::find_global( "FixtureA" ) );
+        fixtureB = KlassOop( Universe::find_global( "FixtureB" ) );
+    }
+
+
+    void TearDown() override {
+        if ( mic not_eq nullptr )
+            delete mic;
+        mic    = nullptr;
+        Inline = inline_;
+        CompilerTests::TearDown();
+    }
+
+
+    // a MIC for the "fixture value" send of CompilerTest>>with:, compiled without inlining so the send is real
+    void allocateMIC() {
+        Inline = false;
+        NativeMethod *nm = compile( "CompilerTest", "with:" );
+        ASSERT_TRUE( nm != nullptr );
+
+        firstIC = nullptr;
+        nm->CompiledICs_do( &findFirstIC );
+        ASSERT_TRUE( firstIC != nullptr );
+
+        mic    = PolymorphicInlineCache::allocate_megamorphic( firstIC );
+        method = fixtureA->klass_part()->lookup( mic->selector() );
+        ASSERT_TRUE( mic->is_megamorphic() );
+        ASSERT_TRUE( method != nullptr );
+    }
+
+
+    // what the MIC stub routine does with a hit in the LookupCache
+    void enter( KlassOop klass ) {
+        std::int32_t index = PolymorphicInlineCache::MegamorphicInlineCache_index( klass );
+        *mic->MegamorphicInlineCache_klass_address( index )  = klass;
+        *mic->MegamorphicInlineCache_target_address( index ) = method;
+    }
+
+};
+
+
+TEST_F( MegamorphicInlineCacheTests, indexShouldBeWithinTable ) {
+    char *address = (char *) fixtureA;
+    for ( std::int32_t i = 0; i < 64; i++ ) {
+        std::int32_t index = PolymorphicInlineCache::MegamorphicInlineCache_index( KlassOop( address + i * OOP_SIZE ) );
+        ASSERT_TRUE( 0 <= index and index < static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_table_size ) );
+    }
+}
+
+
+TEST_F( MegamorphicInlineCacheTests, indexShouldUseTheWordAddressOfTheKlass ) {
+    constexpr std::int32_t size  = static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_table_size );
+    char                   *base = (char *) fixtureA;
+    std::int32_t           index = PolymorphicInlineCache::MegamorphicInlineCache_index( fixtureA );
+
+    ASSERT_EQ( ( index + 1 ) % size, PolymorphicInlineCache::MegamorphicInlineCache_index( KlassOop( base + OOP_SIZE ) ) );
+    ASSERT_EQ( index, PolymorphicInlineCache::MegamorphicInlineCache_index( KlassOop( base + size * OOP_SIZE ) ) );
+}
+
+
+TEST_F( MegamorphicInlineCacheTests, newTableShouldMiss ) {
+    AddTestProcess addTest;
+    {
+        initializeSmalltalkEnvironment();
+        allocateMIC();
+        for ( std::int32_t i = 0; i < static_cast<std::int32_t>( PolymorphicInlineCache::Constant::MegamorphicInlineCache_table_size ); i++ )
+            ASSERT_EQ( nullptr, *mic->MegamorphicInlineCache_klass_address( i ) );
+        ASSERT_EQ( nullptr, mic->MegamorphicInlineCache_lookup( fixtureA ) );
+    }
+}
+
+
+TEST_F( MegamorphicInlineCacheTests, enteredKlassShouldHit ) {
+    AddTestProcess addTest;
+    {
+        initializeSmalltalkEnvironment();
+        allocateMIC();
+        enter( fixtureA );
+        ASSERT_EQ( Oop( method ), mic->MegamorphicInlineCache_lookup( fixtureA ) );
+        ASSERT_EQ( nullptr, mic->MegamorphicInlineCache_lookup( fixtureB ) );
+    }
+}
+
+
+TEST_F( MegamorphicInlineCacheTests, lookupCacheFlushShouldClearTable ) {
+    AddTestProcess addTest;
+    {
+        initializeSmalltalkEnvironment();
+        allocateMIC();
+        enter( fixtureA );
+        enter( fixtureB );
+        LookupCache::flush();
+        ASSERT_EQ( nullptr, mic->MegamorphicInlineCache_lookup( fixtureA ) );
+        ASSERT_EQ( nullptr, mic->MegamorphicInlineCache_lookup( fixtureB ) );
+    }
+}
+
+
+TEST_F( MegamorphicInlineCacheTests, lookupCacheFlushOfKeyShouldClearOnlyItsEntry ) {
+    AddTestProcess addTest;
+    {
+        initializeSmalltalkEnvironment();
+        allocateMIC();
+        enter( fixtureA );
+
+        LookupKey otherSelector( fixtureA, OopFactory::new_symbol( "megamorphicInlineCacheTestsOther" ) );
+        LookupCache::flush( &otherSelector );
+        ASSERT_EQ( Oop( method ), mic->MegamorphicInlineCache_lookup( fixtureA ) );
+
+        LookupKey otherKlass( fixtureB, mic->selector() );
+        LookupCache::flush( &otherKlass );
+        ASSERT_EQ( Oop( method ), mic->MegamorphicInlineCache_lookup( fixtureA ) );
+
+        LookupKey key( fixtureA, mic->selector() );
+        LookupCache::flush( &key );
+        ASSERT_EQ( nullptr, mic->MegamorphicInlineCache_lookup( fixtureA ) );
+    }
+}
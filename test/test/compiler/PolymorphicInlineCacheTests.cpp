@@ -0,0 +1,227 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/memory/Handle.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/oop/AssociationOopDescriptor.hpp"
+#include "vm/oop/ObjectArrayOopDescriptor.hpp"
+#include "vm/code/CompiledInlineCache.hpp"
+#include "vm/code/PolymorphicInlineCache.hpp"
+#include "vm/interpreter/InlineCacheIterator.hpp"
+#include "vm/lookup/LookupResult.hpp"
+#include "vm/runtime/Delta.hpp"
+
+#include "test/compiler/CompilerTests.hpp"
+#include "test/runtime/testProcess.hpp"
+
+#include <gtest/gtest.h>
+
+
+// The "fixture value" send of CompilerTest>>with:, compiled without inlining so that it is a real send
+// whose PolymorphicInlineCache counts the hits of FixtureA>>value and FixtureB>>value.
+
+static CompiledInlineCache *firstIC;
+
+
+static void findFirstIC( CompiledInlineCache *ic ) {
+    if ( firstIC == nullptr )
+        firstIC = ic;
+}
+
+
+class PolymorphicInlineCacheTests : public CompilerTests {
+
+protected:
+    CompiledInlineCache *ic;
+    bool                inline_;
+    bool                useMICs;
+    std::int32_t        maxPolymorphicInlineCacheEntries;
+
+
+    void SetUp() override {
+        CompilerTests::SetUp();
+        ic                               = nullptr;
+        inline_                          = Inline;
+        useMICs                          = UseMICs;
+        maxPolymorphicInlineCacheEntries = MaxPolymorphicInlineCacheEntries;
+        UseMICs                          = true;
+    }
+
+
+    void TearDown() override {
+        if ( ic not_eq nullptr )
+            ic->clear();
+        ic                               = nullptr;
+        Inline                           = inline_;
+        UseMICs                          = useMICs;
+        MaxPolymorphicInlineCacheEntries = maxPolymorphicInlineCacheEntries;
+        CompilerTests::TearDown();
+    }
+
+
+    void compileSend() {
+        Inline = false;
+        NativeMethod *nm = compile( "CompilerTest", "with:" );
+        ASSERT_TRUE( nm != nullptr );
+
+        firstIC = nullptr;
+        nm->CompiledICs_do( &findFirstIC );
+        ic = firstIC;
+        ASSERT_TRUE( ic != nullptr );
+        ic->clear();
+    }
+
+
+    // what CompiledInlineCache::normalLookup does with an interpreted target
+    void addEntry( KlassOop klass ) {
+        MethodOop              method = KlassOop( Universe::find_global( "FixtureA" ) )->klass_part()->lookup( ic->selector() );
+        PolymorphicInlineCache *pic   = PolymorphicInlineCache::allocate( ic, klass, LookupResult( method ) );
+        ic->set_call_destination( pic->entry() );
+    }
+
+
+    // n different klasses of the system dictionary
+    GrowableArray<KlassOop> *someKlasses( std::int32_t n ) {
+        GrowableArray<KlassOop> *klasses = new GrowableArray<KlassOop>( n );
+        ObjectArrayOop          array    = Universe::systemDictionaryObject();
+        for ( std::size_t i = 1; i <= array->length() and klasses->length() < static_cast<std::size_t>( n ); i++ ) {
+            AssociationOop assoc = AssociationOop( array->obj_at( i ) );
+            if ( assoc->is_constant() and assoc->value()->is_klass() and not klasses->contains( KlassOop( assoc->value() ) ) )
+                klasses->append( KlassOop( assoc->value() ) );
+        }
+        return klasses;
+    }
+
+
+    std::int32_t hitCount( const char *className ) {
+        KlassOop                       klass = KlassOop( Universe::find_global( className ) );
+        PolymorphicInlineCacheIterator it( ic->pic() );
+        while ( not it.at_end() ) {
+            if ( it.get_klass() == klass )
+                return it.hit_count();
+            it.advance();
+        }
+        return -1;
+    }
+
+
+    // sends "with: fixture" to a new CompilerTest count times
+    void sendWith( const char *fixtureName, std::int32_t count ) {
+        HandleMark mark;
+        Handle     _new( OopFactory::new_symbol( "new" ) );
+        Handle     with( OopFactory::new_symbol( "with:" ) );
+        Handle     test( Delta::call( Universe::find_global( "CompilerTest" ), _new.as_oop() ) );
+        Handle     fixture( Delta::call( Universe::find_global( fixtureName ), _new.as_oop() ) );
+        for ( std::int32_t i = 0; i < count; i++ )
+            Delta::call( test.as_oop(), with.as_oop(), fixture.as_oop() );
+    }
+
+};
+
+
+TEST_F( PolymorphicInlineCacheTests, picShouldHoldEightKlasses ) {
+    AddTestProcess addTest;
+    {
+        initializeSmalltalkEnvironment();
+        compileSend();
+        GrowableArray<KlassOop> *klasses = someKlasses( 9 );
+        ASSERT_EQ( 9, static_cast<std::int32_t>( klasses->length() ) );
+
+        for ( std::int32_t i = 0; i < 8; i++ )
+            addEntry( klasses->at( i ) );
+        ASSERT_TRUE( ic->is_polymorphic() );
+        ASSERT_EQ( 8, ic->pic()->number_of_targets() );
+
+        addEntry( klasses->at( 8 ) );
+        ASSERT_TRUE( ic->pic()->is_megamorphic() );
+    }
+}
+
+
+TEST_F( PolymorphicInlineCacheTests, picShouldHoldMaxPolymorphicInlineCacheEntries ) {
+    AddTestProcess addTest;
+    {
+        initializeSmalltalkEnvironment();
+        MaxPolymorphicInlineCacheEntries = 3;
+        compileSend();
+        GrowableArray<KlassOop> *klasses = someKlasses( 4 );
+
+        for ( std::int32_t i = 0; i < 3; i++ )
+            addEntry( klasses->at( i ) );
+        ASSERT_EQ( 3, ic->pic()->number_of_targets() );
+
+        addEntry( klasses->at( 3 ) );
+        ASSERT_TRUE( ic->pic()->is_megamorphic() );
+    }
+}
+
+
+TEST_F( PolymorphicInlineCacheTests, maxNumberOfEntriesShouldBeLimited ) {
+    MaxPolymorphicInlineCacheEntries = 100;
+    ASSERT_EQ( static_cast<std::int32_t>( PolymorphicInlineCache::Constant::max_nof_entries ), PolymorphicInlineCache::max_number_of_entries() );
+    MaxPolymorphicInlineCacheEntries = 0;
+    ASSERT_EQ( 2, PolymorphicInlineCache::max_number_of_entries() );
+}
+
+
+TEST_F( PolymorphicInlineCacheTests, newEntriesShouldStartWithoutHits ) {
+    AddTestProcess addTest;
+    {
+        initializeSmalltalkEnvironment();
+        compileSend();
+        addEntry( KlassOop( Universe::find_global( "FixtureA" ) ) );
+        addEntry( KlassOop( Universe::find_global( "FixtureB" ) ) );
+        ASSERT_EQ( 0, hitCount( "FixtureA" ) );
+        ASSERT_EQ( 0, hitCount( "FixtureB" ) );
+    }
+}
+
+
+TEST_F( PolymorphicInlineCacheTests, sendsShouldCountHits ) {
+    AddTestProcess addTest;
+    {
+        initializeSmalltalkEnvironment();
+        compileSend();
+        sendWith( "FixtureA", 1 );
+        sendWith( "FixtureB", 20 );
+        ASSERT_TRUE( ic->is_polymorphic() );
+        ASSERT_GE( hitCount( "FixtureB" ), 19 );
+        ASSERT_LT( hitCount( "FixtureA" ), hitCount( "FixtureB" ) );
+    }
+}
+
+
+TEST_F( PolymorphicInlineCacheTests, decayShouldDivideHits ) {
+    AddTestProcess addTest;
+    {
+        initializeSmalltalkEnvironment();
+        compileSend();
+        sendWith( "FixtureA", 1 );
+        sendWith( "FixtureB", 20 );
+        std::int32_t hits = hitCount( "FixtureB" );
+        ic->pic()->decay_counts( 2.0 );
+        ASSERT_EQ( hits / 2, hitCount( "FixtureB" ) );
+    }
+}
+
+
+TEST_F( PolymorphicInlineCacheTests, cleanupShouldTestFrequentKlassFirst ) {
+    AddTestProcess addTest;
+    {
+        initializeSmalltalkEnvironment();
+        compileSend();
+        sendWith( "FixtureA", 1 );
+        sendWith( "FixtureB", 40 );
+        ASSERT_EQ( KlassOop( Universe::find_global( "FixtureA" ) ), ic->pic()->klasses()->at( 0 ) );
+
+        std::int32_t hits = hitCount( "FixtureB" );
+        ic->cleanup();
+        ASSERT_TRUE( ic->is_polymorphic() );
+        ASSERT_EQ( KlassOop( Universe::find_global( "FixtureB" ) ), ic->pic()->klasses()->at( 0 ) );
+        ASSERT_EQ( hits, hitCount( "FixtureB" ) );
+    }
+}
@@ -0,0 +1,121 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/Scavenge.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/oop/MethodOopDescriptor.hpp"
+#include "vm/oop/MixinOopDescriptor.hpp"
+#include "vm/interpreter/Interpreter.hpp"
+#include "vm/interpreter/CodeIterator.hpp"
+
+#include <gtest/gtest.h>
+
+
+class LoopCounterTests : public ::testing::Test {
+
+protected:
+    std::int32_t oldLimit;
+
+
+    void SetUp() override {
+        oldLimit = Interpreter::loop_counter_limit();
+        Interpreter::set_loop_counter_limit( 100 );
+        Interpreter::loop_recompilation_done( true );
+    }
+
+
+    void TearDown() override {
+        Interpreter::set_loop_counter_limit( oldLimit );
+        Interpreter::loop_recompilation_done( true );
+        Interpreter::reset_loop_counter();
+    }
+
+
+    // the first block method of a method of Object, or nullptr
+    MethodOop findBlockMethod() {
+        MixinOop mixin = KlassOop( Universe::find_global( "Object" ) )->klass_part()->mixin();
+        for ( std::int32_t i = 1; i <= mixin->number_of_methods(); i++ ) {
+            CodeIterator c( mixin->method_at( i ) );
+            do {
+                switch ( c.code() ) {
+                    case ByteCodes::Code::push_new_closure_tos_0:
+                    case ByteCodes::Code::push_new_closure_tos_1:
+                    case ByteCodes::Code::push_new_closure_tos_2:
+                    case ByteCodes::Code::push_new_closure_context_0:
+                    case ByteCodes::Code::push_new_closure_context_1:
+                    case ByteCodes::Code::push_new_closure_context_2:
+                        return MethodOop( c.oop_at( 1 ) );
+                    case ByteCodes::Code::push_new_closure_tos_n:
+                    case ByteCodes::Code::push_new_closure_context_n:
+                        return MethodOop( c.oop_at( 2 ) );
+                    default:
+                        break;
+                }
+            } while ( c.advance() );
+        }
+        return nullptr;
+    }
+
+};
+
+
+TEST_F( LoopCounterTests, chargeShouldSaturateInvocationCount ) {
+    BlockScavenge bs;
+    MethodOop     method   = KlassOop( Universe::find_global( "Object" ) )->klass_part()->mixin()->method_at( 1 );
+    std::int32_t  oldCount = method->invocation_count();
+
+    method->set_invocation_count( MethodOopDescriptor::_invocation_count_max - 10 );
+    ASSERT_EQ( MethodOopDescriptor::_invocation_count_max, Interpreter::charge_loop_iterations( method ) );
+    ASSERT_EQ( MethodOopDescriptor::_invocation_count_max, method->invocation_count() );
+
+    method->set_invocation_count( oldCount );
+}
+
+
+TEST_F( LoopCounterTests, chargeShouldUseBlockMethodsOwnCounter ) {
+    BlockScavenge bs;
+    MethodOop     block = findBlockMethod();
+    ASSERT_TRUE( block != nullptr ) << "Object should have a method with a block";
+    ASSERT_TRUE( block->is_blockMethod() );
+
+    MethodOop    home         = block->home();
+    std::int32_t oldCount     = block->invocation_count();
+    std::int32_t oldHomeCount = home->invocation_count();
+
+    block->set_invocation_count( 0 );
+    ASSERT_EQ( 100, Interpreter::charge_loop_iterations( block ) );
+    ASSERT_EQ( oldHomeCount, home->invocation_count() );
+
+    block->set_invocation_count( oldCount );
+}
+
+
+TEST_F( LoopCounterTests, refusedRecompilationShouldBackOff ) {
+    Interpreter::loop_recompilation_done( false );
+    ASSERT_EQ( 2, Interpreter::loop_backoff() );
+    ASSERT_EQ( -100, Interpreter::loop_counter() );
+
+    Interpreter::loop_recompilation_done( false );
+    ASSERT_EQ( 4, Interpreter::loop_backoff() );
+    ASSERT_EQ( -300, Interpreter::loop_counter() );
+}
+
+
+TEST_F( LoopCounterTests, backOffShouldBeLimited ) {
+    for ( std::int32_t i = 0; i < 20; i++ )
+        Interpreter::loop_recompilation_done( false );
+    ASSERT_EQ( Interpreter::max_loop_backoff, Interpreter::loop_backoff() );
+    ASSERT_EQ( -( Interpreter::max_loop_backoff - 1 ) * 100, Interpreter::loop_counter() );
+}
+
+
+TEST_F( LoopCounterTests, recompilationShouldResetBackOff ) {
+    Interpreter::loop_recompilation_done( false );
+    Interpreter::loop_recompilation_done( true );
+    ASSERT_EQ( 1, Interpreter::loop_backoff() );
+    ASSERT_EQ( 0, Interpreter::loop_counter() );
+}
@@ -0,0 +1,200 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/HeapPolicy.hpp"
+#include "vm/runtime/flags.hpp"
+
+#include <gtest/gtest.h>
+
+
+class HeapPolicyTests : public ::testing::Test {
+
+public:
+    HeapPolicyTests() :
+        ::testing::Test(),
+        _growthPercent{ 0 },
+        _minGrowth{ 0 },
+        _useAdaptiveNewGeneration{ false },
+        _sizes{},
+        _edenSize{ 0 },
+        _survivorSize{ 0 } {}
+
+
+protected:
+    std::int32_t _growthPercent;
+    std::int32_t _minGrowth;
+    bool         _useAdaptiveNewGeneration;
+    SpaceSizes   _sizes;
+    std::int32_t _edenSize;
+    std::int32_t _survivorSize;
+
+    void SetUp() override {
+        _growthPercent            = FullGCGrowthPercent;
+        _minGrowth                = FullGCMinGrowth;
+        _useAdaptiveNewGeneration = UseAdaptiveNewGeneration;
+        _sizes                    = Universe::current_sizes;
+        _edenSize                 = Universe::new_gen.eden()->capacity();
+        _survivorSize             = Universe::new_gen.to()->capacity();
+    }
+
+
+    void TearDown() override {
+        FullGCGrowthPercent      = _growthPercent;
+        FullGCMinGrowth          = _minGrowth;
+        UseAdaptiveNewGeneration = _useAdaptiveNewGeneration;
+        Universe::current_sizes  = _sizes;
+        if ( Universe::new_gen.eden()->capacity() not_eq _edenSize or Universe::new_gen.to()->capacity() not_eq _survivorSize ) {
+            Universe::scavenge();
+            Universe::new_gen.resize( _edenSize, _survivorSize );
+        }
+        HeapPolicy::collect_if_requested();
+        HeapPolicy::record_collection( Universe::old_gen.used() );
+    }
+
+};
+
+
+TEST_F( HeapPolicyTests, shouldNotCollectRightAfterCollection ) {
+    HeapPolicy::record_collection( Universe::old_gen.used() );
+    ASSERT_FALSE( HeapPolicy::should_collect_garbage() );
+}
+
+
+TEST_F( HeapPolicyTests, shouldCollectWhenOldGenerationGrewPastLimit ) {
+    FullGCGrowthPercent = 10;
+    FullGCMinGrowth     = 0;
+    HeapPolicy::record_collection( Universe::old_gen.used() / 2 );
+    ASSERT_TRUE( HeapPolicy::should_collect_garbage() );
+}
+
+
+TEST_F( HeapPolicyTests, shouldNotCollectBelowMinimumGrowth ) {
+    FullGCGrowthPercent = 0;
+    FullGCMinGrowth     = ReservedHeapSize;
+    HeapPolicy::record_collection( Universe::old_gen.used() / 2 );
+    ASSERT_FALSE( HeapPolicy::should_collect_garbage() );
+}
+
+
+TEST_F( HeapPolicyTests, shouldCountTriggeredCollections ) {
+    FullGCGrowthPercent = 10;
+    FullGCMinGrowth     = 0;
+    std::int32_t before = HeapPolicy::collections();
+    HeapPolicy::record_collection( Universe::old_gen.used() / 2 );
+    HeapPolicy::should_collect_garbage();
+    ASSERT_EQ( before + 1, HeapPolicy::collections() );
+}
+
+
+TEST_F( HeapPolicyTests, allocationShouldOnlyRequestCollection ) {
+    FullGCGrowthPercent = 10;
+    FullGCMinGrowth     = 0;
+    HeapPolicy::record_collection( Universe::old_gen.used() / 2 );
+
+    // an old object held across the allocation, as C++ callers do
+    Oop  objectClass = Universe::find_global( "Object" );
+    Oop *obj         = Universe::scavenge_and_allocate( 4, nullptr );
+    Universe::fill( obj, obj + 4 );
+    ASSERT_EQ( objectClass, Universe::find_global( "Object" ) );
+    ASSERT_TRUE( HeapPolicy::collection_requested() );
+
+    ASSERT_TRUE( HeapPolicy::collect_if_requested() );
+    ASSERT_FALSE( HeapPolicy::collection_requested() );
+    ASSERT_FALSE( HeapPolicy::collect_if_requested() );
+}
+
+
+TEST_F( HeapPolicyTests, newGenerationShouldResizeWithinReservedSpace ) {
+    Universe::scavenge();
+    NewGeneration *new_gen   = &Universe::new_gen;
+    std::int32_t  eden_size = new_gen->eden()->capacity();
+    std::int32_t  surv_size = new_gen->to()->capacity();
+    std::int32_t  page_size = Universe::page_size();
+
+    new_gen->resize( eden_size - page_size, page_size );
+    ASSERT_EQ( eden_size - page_size, new_gen->eden()->capacity() );
+    ASSERT_EQ( page_size, new_gen->to()->capacity() );
+    ASSERT_TRUE( new_gen->eden()->is_empty() );
+
+    new_gen->resize( new_gen->max_eden_size(), new_gen->max_survivor_size() );
+    ASSERT_EQ( new_gen->max_eden_size(), new_gen->eden()->capacity() );
+
+    new_gen->resize( eden_size, surv_size );
+    ASSERT_EQ( eden_size, new_gen->eden()->capacity() );
+    ASSERT_EQ( surv_size, new_gen->to()->capacity() );
+}
+
+
+TEST_F( HeapPolicyTests, adaptiveNewGenerationShouldStayWithinLimits ) {
+    UseAdaptiveNewGeneration = true;
+    Universe::scavenge();
+
+    NewGeneration *new_gen   = &Universe::new_gen;
+    std::int32_t  page_size = Universe::page_size();
+    std::int32_t  eden_size = new_gen->eden()->capacity();
+
+    // the configured sizes are the lower limits; lower them so that eden can shrink at all
+    Universe::current_sizes._eden_size = page_size;
+    Universe::current_sizes._surv_size = page_size;
+
+    // pauses far above the goal shrink eden, down to the lower limit; no survivors, minimal survivor spaces
+    HeapPolicy::resize_new_generation( ScavengePauseGoal * 100.0, eden_size, 0 );
+    ASSERT_LT( new_gen->eden()->capacity(), eden_size );
+    for ( std::int32_t i = 0; i < 50; i++ ) {
+        std::int32_t previous = new_gen->eden()->capacity();
+        HeapPolicy::resize_new_generation( ScavengePauseGoal * 100.0, previous, 0 );
+        ASSERT_LE( new_gen->eden()->capacity(), previous );
+        ASSERT_GE( new_gen->eden()->capacity(), page_size );
+    }
+    ASSERT_EQ( page_size, new_gen->eden()->capacity() );
+    ASSERT_EQ( page_size, new_gen->to()->capacity() );
+
+    // short pauses grow eden again, up to the reserved size; if everything survives, so do the survivor spaces
+    for ( std::int32_t i = 0; i < 50; i++ ) {
+        std::int32_t previous = new_gen->eden()->capacity();
+        HeapPolicy::resize_new_generation( 0.0, previous, previous );
+        ASSERT_GE( new_gen->eden()->capacity(), previous );
+        ASSERT_LE( new_gen->eden()->capacity(), new_gen->max_eden_size() );
+        ASSERT_LE( new_gen->to()->capacity(), new_gen->max_survivor_size() );
+    }
+    ASSERT_EQ( new_gen->max_eden_size(), new_gen->eden()->capacity() );
+    ASSERT_EQ( new_gen->max_survivor_size(), new_gen->to()->capacity() );
+}
+
+
+TEST_F( HeapPolicyTests, shrinkShouldUncommitFreeTailOfOldGeneration ) {
+    std::int32_t maxHeapFreeRatio = MaxHeapFreeRatio;
+    MaxHeapFreeRatio = 0;
+    Universe::old_gen.expand( 8 * ObjectHeapExpandSize * 1024 );
+    std::int32_t capacity = Universe::old_gen.capacity();
+    std::int32_t shrinks  = HeapPolicy::shrinks();
+
+    HeapPolicy::shrink_old_generation();
+    MaxHeapFreeRatio = maxHeapFreeRatio;
+    ASSERT_EQ( shrinks + 1, HeapPolicy::shrinks() );
+    ASSERT_LT( Universe::old_gen.capacity(), capacity );
+    ASSERT_GE( Universe::old_gen.capacity(), Universe::current_sizes._old_size );
+    ASSERT_GE( Universe::old_gen.capacity(), Universe::old_gen.used() );
+    Universe::verify();
+}
+
+
+TEST_F( HeapPolicyTests, shrinkShouldKeepMinimumFreeRatio ) {
+    std::int32_t maxHeapFreeRatio = MaxHeapFreeRatio;
+    MaxHeapFreeRatio = 0;
+    // enough free space for a shrink to leave MinHeapFreeRatio percent free
+    Universe::old_gen.expand( Universe::old_gen.used() + 8 * ObjectHeapExpandSize * 1024 );
+    std::int32_t shrinks = HeapPolicy::shrinks();
+    HeapPolicy::shrink_old_generation();
+
+    std::int32_t capacity = Universe::old_gen.capacity();
+    std::int32_t used     = Universe::old_gen.used();
+    HeapPolicy::shrink_old_generation();
+    MaxHeapFreeRatio = maxHeapFreeRatio;
+    ASSERT_EQ( shrinks + 1, HeapPolicy::shrinks() );
+    ASSERT_GE( double( capacity - used ) / capacity * 100, MinHeapFreeRatio );
+    ASSERT_EQ( capacity, Universe::old_gen.capacity() );
+}
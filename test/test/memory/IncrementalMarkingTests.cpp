@@ -0,0 +1,100 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/memory/Handle.hpp"
+#include "vm/memory/MarkCompact.hpp"
+#include "vm/memory/IncrementalMarking.hpp"
+#include "vm/oop/ObjectArrayOopDescriptor.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/klass/Klass.hpp"
+#include "vm/runtime/flags.hpp"
+
+#include <gtest/gtest.h>
+
+
+class IncrementalMarkingTests : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        // start with everything old and an empty eden
+        MarkCompact::collect();
+    }
+
+
+    void TearDown() override {
+        IncrementalMarking::abort();
+    }
+
+
+    static ObjectArrayOop newOldArray( std::int32_t size ) {
+        KlassOop klass = Universe::objectArrayKlassObject();
+        ObjectArrayOop array = ObjectArrayOop( klass->klass_part()->allocateObjectSize( size, true, true ) );
+        for ( std::int32_t i = 1; i <= size; i++ ) {
+            array->obj_at_put( i, OopFactory::new_smi( i ) );
+        }
+        return array;
+    }
+
+
+    static void markToCompletion() {
+        while ( not IncrementalMarking::mark_slice( 100 ) );
+    }
+
+};
+
+
+TEST_F( IncrementalMarkingTests, markingShouldCompleteInSlices ) {
+    IncrementalMarking::start();
+    ASSERT_TRUE( IncrementalMarking::is_active() );
+    ASSERT_FALSE( IncrementalMarking::is_complete() );
+
+    markToCompletion();
+    ASSERT_TRUE( IncrementalMarking::is_complete() );
+    ASSERT_TRUE( IncrementalMarking::slices() > 1 );
+}
+
+
+TEST_F( IncrementalMarkingTests, abortShouldEndCycle ) {
+    IncrementalMarking::start();
+    IncrementalMarking::abort();
+    ASSERT_FALSE( IncrementalMarking::is_active() );
+    ASSERT_FALSE( IncrementalMarking::is_complete() );
+}
+
+
+TEST_F( IncrementalMarkingTests, remarkShouldPreserveOldObjectStoredAfterScan ) {
+    PersistentHandle holder( newOldArray( 2 ) );
+
+    IncrementalMarking::start();
+    markToCompletion();
+
+    // both arrays are old, so only the card mark of the store tells the remark about it
+    ObjectArrayOop stored = newOldArray( 10 );
+    ObjectArrayOop( holder.as_oop() )->obj_at_put( 1, stored );
+
+    MarkCompact::collect();
+    ASSERT_FALSE( IncrementalMarking::is_active() );
+
+    ObjectArrayOop array = ObjectArrayOop( ObjectArrayOop( holder.as_oop() )->obj_at( 1 ) );
+    ASSERT_TRUE( array->isObjectArray() );
+    ASSERT_EQ( 10, array->length() );
+    ASSERT_EQ( 7, SmallIntegerOop( array->obj_at( 7 ) )->value() );
+    Universe::verify();
+}
+
+
+TEST_F( IncrementalMarkingTests, remarkShouldPreserveNewObjects ) {
+    IncrementalMarking::start();
+    markToCompletion();
+
+    PersistentHandle array( OopFactory::new_objectArray( 10 ) );
+    ObjectArrayOop( array.as_oop() )->obj_at_put( 3, OopFactory::new_smi( 42 ) );
+
+    MarkCompact::collect();
+    ASSERT_TRUE( array.as_oop()->is_old() );
+    ASSERT_EQ( 42, SmallIntegerOop( ObjectArrayOop( array.as_oop() )->obj_at( 3 ) )->value() );
+}
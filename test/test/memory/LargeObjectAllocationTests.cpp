@@ -0,0 +1,131 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/memory/Handle.hpp"
+#include "vm/memory/HeapPolicy.hpp"
+#include "vm/memory/MarkCompact.hpp"
+#include "vm/memory/OldSpaceFreeList.hpp"
+#include "vm/oop/ObjectArrayOopDescriptor.hpp"
+#include "vm/oop/ByteArrayOopDescriptor.hpp"
+#include "vm/platform/os.hpp"
+#include "vm/runtime/flags.hpp"
+#include "vm/runtime/VMOperation.hpp"
+
+#include <gtest/gtest.h>
+
+
+class LargeObjectAllocationTests : public ::testing::Test {
+
+protected:
+    bool         _useLargeObjectAllocation;
+    bool         _useOldSpaceFreeLists;
+    std::int32_t _largeObjectThreshold;
+    std::int32_t _oldSpaceFragmentationLimit;
+    std::int32_t _growthPercent;
+    std::int32_t _minGrowth;
+
+
+    void SetUp() override {
+        _useLargeObjectAllocation   = UseLargeObjectAllocation;
+        _useOldSpaceFreeLists       = UseOldSpaceFreeLists;
+        _largeObjectThreshold       = LargeObjectThreshold;
+        _oldSpaceFragmentationLimit = OldSpaceFragmentationLimit;
+        _growthPercent              = FullGCGrowthPercent;
+        _minGrowth                  = FullGCMinGrowth;
+        UseLargeObjectAllocation    = true;
+        LargeObjectThreshold        = 16;
+    }
+
+
+    void TearDown() override {
+        UseLargeObjectAllocation   = _useLargeObjectAllocation;
+        UseOldSpaceFreeLists       = _useOldSpaceFreeLists;
+        LargeObjectThreshold       = _largeObjectThreshold;
+        OldSpaceFragmentationLimit = _oldSpaceFragmentationLimit;
+        FullGCGrowthPercent        = _growthPercent;
+        FullGCMinGrowth            = _minGrowth;
+        HeapPolicy::collect_if_requested();
+        HeapPolicy::record_collection( Universe::old_gen.used() );
+        Universe::old_gen.clear_free_lists();
+    }
+
+
+    static std::int32_t largeSize() {
+        return LargeObjectThreshold * 1024 / OOP_SIZE;
+    }
+
+
+    static bool isPageAligned( Oop obj ) {
+        return ( (std::uint32_t) MemOop( obj )->addr() ) % os::vm_page_size() == 0;
+    }
+
+};
+
+
+TEST_F( LargeObjectAllocationTests, largeArrayShouldBeOldAndPageAligned ) {
+    ObjectArrayOop array = OopFactory::new_objectArray( largeSize() );
+    ASSERT_TRUE( array->is_old() );
+    ASSERT_TRUE( isPageAligned( array ) );
+    ASSERT_EQ( largeSize(), array->length() );
+
+    ByteArrayOop bytes = OopFactory::new_byteArray( LargeObjectThreshold * 1024 );
+    ASSERT_TRUE( bytes->is_old() );
+    ASSERT_TRUE( isPageAligned( bytes ) );
+    Universe::verify();
+}
+
+
+TEST_F( LargeObjectAllocationTests, smallArrayShouldBeNew ) {
+    ObjectArrayOop array = OopFactory::new_objectArray( 10 );
+    ASSERT_TRUE( array->is_new() );
+}
+
+
+TEST_F( LargeObjectAllocationTests, scavengeShouldNotMoveLargeObject ) {
+    PersistentHandle array( OopFactory::new_objectArray( largeSize() ) );
+    Oop              address = array.as_oop();
+    ObjectArrayOop( array.as_oop() )->obj_at_put( largeSize(), OopFactory::new_objectArray( 2 ) );
+
+    Universe::scavenge();
+    ASSERT_EQ( address, array.as_oop() );
+    ASSERT_TRUE( ObjectArrayOop( array.as_oop() )->obj_at( largeSize() )->isObjectArray() );
+    Universe::verify();
+}
+
+
+TEST_F( LargeObjectAllocationTests, sweepShouldReuseDeadLargeObject ) {
+    UseOldSpaceFreeLists       = true;
+    OldSpaceFragmentationLimit = 100;
+    OopFactory::new_objectArray( 2 * largeSize() ); // garbage below the second array
+    PersistentHandle above( OopFactory::new_objectArray( largeSize() ) );
+
+    MarkCompact::collect();
+    Oop *top = Universe::old_gen.top_mark()._point;
+    ObjectArrayOop reused = OopFactory::new_objectArray( largeSize() );
+    ASSERT_TRUE( isPageAligned( reused ) );
+    ASSERT_EQ( top, Universe::old_gen.top_mark()._point );
+    Universe::verify();
+}
+
+
+TEST_F( LargeObjectAllocationTests, allocationShouldOnlyRequestCollection ) {
+    FullGCGrowthPercent = 10;
+    FullGCMinGrowth     = 0;
+    HeapPolicy::record_collection( Universe::old_gen.used() / 2 );
+    std::int32_t collections = VM_GarbageCollect::mark_sweep_collections() + VM_GarbageCollect::mark_compact_collections();
+
+    // an old object held across the allocation, as C++ callers do
+    Oop            objectClass = Universe::find_global( "Object" );
+    ObjectArrayOop array       = OopFactory::new_objectArray( largeSize() );
+    ASSERT_TRUE( array->is_old() );
+    ASSERT_EQ( objectClass, Universe::find_global( "Object" ) );
+    ASSERT_EQ( collections, VM_GarbageCollect::mark_sweep_collections() + VM_GarbageCollect::mark_compact_collections() );
+    ASSERT_TRUE( HeapPolicy::collection_requested() );
+
+    ASSERT_TRUE( HeapPolicy::collect_if_requested() );
+    ASSERT_EQ( collections + 1, VM_GarbageCollect::mark_sweep_collections() + VM_GarbageCollect::mark_compact_collections() );
+}
@@ -0,0 +1,88 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/memory/Handle.hpp"
+#include "vm/memory/MarkCompact.hpp"
+#include "vm/oop/ObjectArrayOopDescriptor.hpp"
+#include "vm/oop/DoubleOopDescriptor.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/klass/Klass.hpp"
+#include "vm/runtime/flags.hpp"
+#include "vm/runtime/VMOperation.hpp"
+#include "vm/runtime/VMProcess.hpp"
+
+#include "test/memory/ObjectGraph.hpp"
+
+#include <gtest/gtest.h>
+
+
+class MarkCompactTests : public ::testing::Test {
+};
+
+
+TEST_F( MarkCompactTests, collectShouldPreserveObjectGraph ) {
+    PersistentHandle graph( newGraph( 1000 ) );
+
+    MarkCompact::collect();
+    checkGraph( ObjectArrayOop( graph.as_oop() ), 1000, true );
+
+    MarkCompact::collect();
+    checkGraph( ObjectArrayOop( graph.as_oop() ), 1000, true );
+    Universe::verify();
+}
+
+
+TEST_F( MarkCompactTests, collectShouldEmptyNewGeneration ) {
+    PersistentHandle graph( newGraph( 100 ) );
+
+    MarkCompact::collect();
+    ASSERT_TRUE( Universe::new_gen.eden()->is_empty() );
+    ASSERT_TRUE( Universe::new_gen.from()->is_empty() );
+    ASSERT_TRUE( graph.as_oop()->is_old() );
+}
+
+
+TEST_F( MarkCompactTests, collectShouldReclaimUnreachableOldObjects ) {
+    MarkCompact::collect();
+    std::int32_t used = Universe::old_gen.used();
+
+    KlassOop klass = Universe::objectArrayKlassObject();
+    for ( std::int32_t i = 0; i < 100; i++ ) {
+        klass->klass_part()->allocateObjectSize( 500, true, true );
+    }
+    ASSERT_TRUE( Universe::old_gen.used() > used );
+
+    MarkCompact::collect();
+    ASSERT_TRUE( Universe::old_gen.used() <= used );
+}
+
+
+TEST_F( MarkCompactTests, collectShouldReturnMovedObject ) {
+    OopFactory::new_objectArray( 1000 ); // garbage below the array
+    Oop array = OopFactory::new_objectArray( 10 );
+    ObjectArrayOop( array )->obj_at_put( 1, OopFactory::new_smi( 42 ) );
+
+    array = MarkCompact::collect( array );
+    ASSERT_TRUE( array->isObjectArray() );
+    ASSERT_TRUE( array->is_old() );
+    ASSERT_EQ( 42, SmallIntegerOop( ObjectArrayOop( array )->obj_at( 1 ) )->value() );
+}
+
+
+TEST_F( MarkCompactTests, garbageCollectShouldCountCollectorThatRan ) {
+    FlagSetting  fs( UseMarkCompact, true );
+    std::int32_t mark_compacts = VM_GarbageCollect::mark_compact_collections();
+    std::int32_t mark_sweeps   = VM_GarbageCollect::mark_sweep_collections();
+    bool         compacts      = MarkCompact::can_compact();
+
+    Oop               ignored = nilObject;
+    VM_GarbageCollect gc( &ignored );
+    VMProcess::execute( &gc );
+
+    ASSERT_EQ( mark_compacts + ( compacts ? 1 : 0 ), VM_GarbageCollect::mark_compact_collections() );
+    ASSERT_EQ( mark_sweeps + ( compacts ? 0 : 1 ), VM_GarbageCollect::mark_sweep_collections() );
+}
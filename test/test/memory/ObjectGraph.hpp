@@ -0,0 +1,43 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/oop/ObjectArrayOopDescriptor.hpp"
+#include "vm/oop/DoubleOopDescriptor.hpp"
+
+#include <gtest/gtest.h>
+
+
+// A test graph for the collectors: an array of size two-element arrays, element i holding the smi i
+// and the double i + 0.5, so that moved (or lost) objects show up as wrong values.
+
+inline ObjectArrayOop newGraph( std::int32_t size ) {
+    ObjectArrayOop array = OopFactory::new_objectArray( size );
+    for ( std::int32_t i = 1; i <= size; i++ ) {
+        ObjectArrayOop element = OopFactory::new_objectArray( 2 );
+        element->obj_at_put( 1, OopFactory::new_smi( i ) );
+        element->obj_at_put( 2, OopFactory::new_double( i + 0.5 ) );
+        array->obj_at_put( i, element );
+    }
+    return array;
+}
+
+
+// checks the graph built by newGraph; with tenured, all elements must have been promoted too
+inline void checkGraph( ObjectArrayOop array, std::int32_t size, bool tenured = false ) {
+    ASSERT_EQ( size, array->length() );
+    for ( std::int32_t i = 1; i <= size; i++ ) {
+        ObjectArrayOop element = ObjectArrayOop( array->obj_at( i ) );
+        ASSERT_TRUE( element->isObjectArray() );
+        if ( tenured ) {
+            ASSERT_TRUE( element->is_old() );
+        }
+        ASSERT_EQ( i, SmallIntegerOop( element->obj_at( 1 ) )->value() );
+        ASSERT_EQ( i + 0.5, DoubleOop( element->obj_at( 2 ) )->value() );
+    }
+}
@@ -0,0 +1,104 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/memory/Handle.hpp"
+#include "vm/memory/MarkCompact.hpp"
+#include "vm/memory/OldSpaceFreeList.hpp"
+#include "vm/memory/Space.hpp"
+#include "vm/oop/ObjectArrayOopDescriptor.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/klass/Klass.hpp"
+#include "vm/runtime/flags.hpp"
+
+#include <gtest/gtest.h>
+
+
+class OldSpaceFreeListTests : public ::testing::Test {
+
+protected:
+    bool         _useOldSpaceFreeLists;
+    std::int32_t _oldSpaceFragmentationLimit;
+
+
+    void SetUp() override {
+        _useOldSpaceFreeLists       = UseOldSpaceFreeLists;
+        _oldSpaceFragmentationLimit = OldSpaceFragmentationLimit;
+        UseOldSpaceFreeLists        = true;
+        OldSpaceFragmentationLimit  = 100;
+    }
+
+
+    void TearDown() override {
+        UseOldSpaceFreeLists       = _useOldSpaceFreeLists;
+        OldSpaceFragmentationLimit = _oldSpaceFragmentationLimit;
+        Universe::old_gen.clear_free_lists();
+    }
+
+
+    static ObjectArrayOop newOldArray( std::int32_t size ) {
+        KlassOop klass = Universe::objectArrayKlassObject();
+        return ObjectArrayOop( klass->klass_part()->allocateObjectSize( size, true, true ) );
+    }
+
+
+    static OldSpaceFreeList *freeList() {
+        return Universe::old_gen.top_mark()._space->free_list();
+    }
+
+};
+
+
+TEST( OldSpaceFreeListTest, removeShouldFitOrLeaveRoomForHeader ) {
+    OldSpaceFreeList list;
+    Oop              chunk[100];
+    list.add( chunk, 11 );
+
+    std::int32_t chunk_size = 0;
+    ASSERT_EQ( nullptr, list.remove( 10, chunk_size ) );
+    ASSERT_EQ( chunk, list.remove( 9, chunk_size ) );
+    ASSERT_EQ( 11, chunk_size );
+    ASSERT_TRUE( list.is_empty() );
+
+    list.add( chunk, 100 );
+    ASSERT_EQ( chunk, list.remove( 100, chunk_size ) );
+    ASSERT_EQ( 0, list.free_words() );
+}
+
+
+TEST_F( OldSpaceFreeListTests, sweepShouldNotMoveLiveObjects ) {
+    PersistentHandle live( newOldArray( 10 ) );
+    newOldArray( 1000 ); // garbage below the second array
+    PersistentHandle above( newOldArray( 10 ) );
+    Oop              address = above.as_oop();
+
+    MarkCompact::collect();
+    ASSERT_EQ( address, above.as_oop() );
+    ASSERT_FALSE( freeList()->is_empty() );
+    Universe::verify();
+}
+
+
+TEST_F( OldSpaceFreeListTests, allocationShouldReuseFreeChunks ) {
+    newOldArray( 100 );
+    PersistentHandle above( newOldArray( 10 ) );
+    MarkCompact::collect();
+
+    Oop *top = Universe::old_gen.top_mark()._point;
+    ObjectArrayOop reused = newOldArray( 50 );
+    ASSERT_TRUE( (Oop *) reused->addr() < top );
+    ASSERT_EQ( top, Universe::old_gen.top_mark()._point );
+    Universe::verify();
+}
+
+
+TEST_F( OldSpaceFreeListTests, fragmentationLimitShouldCompact ) {
+    OldSpaceFragmentationLimit = 0;
+    newOldArray( 1000 );
+
+    MarkCompact::collect();
+    ASSERT_TRUE( freeList()->is_empty() );
+}
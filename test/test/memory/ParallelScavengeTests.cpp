@@ -0,0 +1,79 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/memory/Handle.hpp"
+#include "vm/memory/ParallelScavenge.hpp"
+#include "vm/oop/ObjectArrayOopDescriptor.hpp"
+#include "vm/oop/DoubleOopDescriptor.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/klass/Klass.hpp"
+#include "vm/runtime/flags.hpp"
+
+#include "test/memory/ObjectGraph.hpp"
+
+#include <gtest/gtest.h>
+
+
+class ParallelScavengeTests : public ::testing::Test {
+
+protected:
+    bool _useParallelScavenge;
+
+
+    void SetUp() override {
+        _useParallelScavenge = UseParallelScavenge;
+        UseParallelScavenge  = true;
+    }
+
+
+    void TearDown() override {
+        UseParallelScavenge = _useParallelScavenge;
+    }
+
+};
+
+
+TEST_F( ParallelScavengeTests, scavengeShouldPreserveObjectGraph ) {
+    PersistentHandle graph( newGraph( 1000 ) );
+
+    Universe::scavenge();
+    checkGraph( ObjectArrayOop( graph.as_oop() ), 1000 );
+
+    Universe::scavenge();
+    checkGraph( ObjectArrayOop( graph.as_oop() ), 1000 );
+}
+
+
+TEST_F( ParallelScavengeTests, scavengeShouldFollowStoresIntoOldObjects ) {
+    KlassOop       klass = Universe::objectArrayKlassObject();
+    ObjectArrayOop old   = ObjectArrayOop( klass->klass_part()->allocateObjectSize( 500, true, true ) );
+    PersistentHandle holder( old );
+    ASSERT_TRUE( old->is_old() );
+
+    for ( std::int32_t i = 1; i <= 500; i++ ) {
+        ObjectArrayOop( holder.as_oop() )->obj_at_put( i, OopFactory::new_double( i ) );
+    }
+
+    Universe::scavenge();
+
+    old = ObjectArrayOop( holder.as_oop() );
+    for ( std::int32_t i = 1; i <= 500; i++ ) {
+        ASSERT_FALSE( old->obj_at( i )->isMarkOop() );
+        ASSERT_EQ( i, DoubleOop( old->obj_at( i ) )->value() );
+    }
+}
+
+
+TEST_F( ParallelScavengeTests, fillShouldKeepSpaceParsable ) {
+    std::int32_t sizes[] = { MemOopDescriptor::header_size(), MemOopDescriptor::header_size() + 1, 50 };
+    for ( std::int32_t size : sizes ) {
+        Oop *start = Universe::allocate_tenured( size );
+        Universe::fill( start, start + size );
+        ASSERT_EQ( size, as_memOop( start )->size() );
+    }
+    Universe::verify();
+}
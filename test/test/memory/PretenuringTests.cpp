@@ -0,0 +1,114 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/memory/MarkSweep.hpp"
+#include "vm/memory/Pretenuring.hpp"
+#include "vm/oop/ObjectArrayOopDescriptor.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/klass/Klass.hpp"
+#include "vm/runtime/flags.hpp"
+
+#include "test/memory/TestClass.hpp"
+
+#include <gtest/gtest.h>
+
+
+class PretenuringTests : public ::testing::Test {
+
+protected:
+    bool         _usePretenuring;
+    std::int32_t _pretenureThreshold;
+    std::int32_t _pretenureSampleInterval;
+    std::int32_t _pretenureMinSize;
+
+
+    void SetUp() override {
+        _usePretenuring          = UsePretenuring;
+        _pretenureThreshold      = PretenureThreshold;
+        _pretenureSampleInterval = PretenureSampleInterval;
+        _pretenureMinSize        = PretenureMinSize;
+    }
+
+
+    void TearDown() override {
+        Pretenuring::reset();
+        UsePretenuring          = _usePretenuring;
+        PretenureThreshold      = _pretenureThreshold;
+        PretenureSampleInterval = _pretenureSampleInterval;
+        PretenureMinSize        = _pretenureMinSize;
+    }
+
+
+    static Klass *arrayKlass() {
+        return Universe::objectArrayKlassObject()->klass_part();
+    }
+
+};
+
+
+TEST_F( PretenuringTests, pretenuredBitShouldNotChangeUntaggedContents ) {
+    Klass *klass    = Universe::byteArrayKlassObject()->klass_part();
+    bool  untagged = klass->has_untagged_contents();
+
+    klass->set_pretenured( true );
+    ASSERT_TRUE( klass->is_pretenured() );
+    ASSERT_EQ( untagged, klass->has_untagged_contents() );
+
+    klass->set_pretenured( false );
+    ASSERT_FALSE( klass->is_pretenured() );
+    ASSERT_EQ( untagged, klass->has_untagged_contents() );
+}
+
+
+TEST_F( PretenuringTests, newClassShouldNotBePretenured ) {
+    KlassOop klass = newTestClass( 1 );
+    ASSERT_FALSE( klass->klass_part()->is_pretenured() );
+    ASSERT_FALSE( klass->klass_part()->has_untagged_contents() );
+    ASSERT_FALSE( klass->klass()->klass_part()->is_pretenured() );
+    ASSERT_TRUE( MemOop( klass->klass_part()->allocateObject() )->is_new() );
+}
+
+
+TEST_F( PretenuringTests, pretenuredKlassShouldAllocateInOldGeneration ) {
+    arrayKlass()->set_pretenured( true );
+    ObjectArrayOop array = OopFactory::new_objectArray( 10 );
+    arrayKlass()->set_pretenured( false );
+
+    ASSERT_TRUE( array->is_old() );
+    ASSERT_TRUE( OopFactory::new_objectArray( 10 )->is_new() );
+}
+
+
+TEST_F( PretenuringTests, sampledScavengeShouldPretenureLongLivedKlass ) {
+    UsePretenuring          = true;
+    PretenureSampleInterval = 1;
+    PretenureMinSize        = 0;
+    PretenureThreshold      = 0;
+    OopFactory::new_objectArray( 100 );
+
+    Universe::scavenge();
+    ASSERT_TRUE( arrayKlass()->is_pretenured() );
+    ASSERT_TRUE( Pretenuring::number_of_pretenured_klasses() > 0 );
+
+    MarkSweep::collect();
+    ASSERT_FALSE( arrayKlass()->is_pretenured() );
+    ASSERT_EQ( 0, Pretenuring::number_of_pretenured_klasses() );
+}
+
+
+TEST_F( PretenuringTests, shortLivedKlassShouldNotBePretenured ) {
+    UsePretenuring          = true;
+    PretenureSampleInterval = 1;
+    PretenureMinSize        = 0;
+    PretenureThreshold      = 100;
+    for ( std::int32_t i = 0; i < 100; i++ ) {
+        OopFactory::new_objectArray( 100 );
+    }
+
+    Universe::scavenge();
+    ASSERT_FALSE( arrayKlass()->is_pretenured() );
+}
@@ -0,0 +1,98 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/memory/Handle.hpp"
+#include "vm/memory/RememberedSet.hpp"
+#include "vm/oop/ObjectArrayOopDescriptor.hpp"
+#include "vm/oop/DoubleOopDescriptor.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/klass/Klass.hpp"
+#include "vm/runtime/flags.hpp"
+
+#include "test/memory/TestClass.hpp"
+
+#include <gtest/gtest.h>
+
+
+class RememberedSetTests : public ::testing::Test {
+
+protected:
+    static ObjectArrayOop newOldArray( std::int32_t size ) {
+        KlassOop klass = Universe::objectArrayKlassObject();
+        return ObjectArrayOop( klass->klass_part()->allocateObjectSize( size, true, true ) );
+    }
+
+
+    // an old instance of a new subclass of Object with size instance variables: a large object that isn't an array
+    static MemOop newOldObject( std::int32_t size ) {
+        KlassOop klass = newTestClass( size );
+        return MemOop( klass->klass_part()->allocateObject( false, true ) );
+    }
+
+};
+
+
+TEST_F( RememberedSetTests, scavengeShouldOnlyScanDirtyPartOfLargeArray ) {
+    PersistentHandle holder( newOldArray( 10 * card_size_in_oops ) );
+    Universe::scavenge();
+
+    ObjectArrayOop( holder.as_oop() )->obj_at_put( 5 * card_size_in_oops, OopFactory::new_double( 1.5 ) );
+    Universe::scavenge();
+
+    ObjectArrayOop old = ObjectArrayOop( holder.as_oop() );
+    ASSERT_EQ( 1.5, DoubleOop( old->obj_at( 5 * card_size_in_oops ) )->value() );
+    ASSERT_TRUE( RememberedSet::cards_dirty() >= 1 );
+
+    // the element still points into new space, so its card stays dirty
+    ASSERT_TRUE( Universe::remembered_set->is_dirty( old->objs( 5 * card_size_in_oops ) ) );
+}
+
+
+TEST_F( RememberedSetTests, scavengeShouldCleanCardsOnlyPointingToOldObjects ) {
+    // a card in the middle of the array holds nothing else
+    std::int32_t index = 3 * card_size_in_oops / 2;
+    PersistentHandle holder( newOldArray( 3 * card_size_in_oops ) );
+    ObjectArrayOop( holder.as_oop() )->obj_at_put( index, newOldArray( 1 ) );
+    ASSERT_TRUE( Universe::remembered_set->is_dirty( ObjectArrayOop( holder.as_oop() )->objs( index ) ) );
+
+    Universe::scavenge();
+    ASSERT_FALSE( Universe::remembered_set->is_dirty( ObjectArrayOop( holder.as_oop() )->objs( index ) ) );
+}
+
+
+TEST_F( RememberedSetTests, cloneInOldSpaceShouldDirtyAllCards ) {
+    ObjectArrayOop array = OopFactory::new_objectArray( 4 * card_size_in_oops );
+    array->obj_at_put( 4 * card_size_in_oops, OopFactory::new_double( 2.5 ) );
+    PersistentHandle clone( array->shallow_copy( true ) );
+    ASSERT_TRUE( clone.as_oop()->is_old() );
+
+    Universe::scavenge();
+    ASSERT_EQ( 2.5, DoubleOop( ObjectArrayOop( clone.as_oop() )->obj_at( 4 * card_size_in_oops ) )->value() );
+}
+
+
+TEST_F( RememberedSetTests, scavengeShouldKeepDirtyCardsOfLargeObjectScannedAsAWhole ) {
+    PersistentHandle holder( newOldObject( 4 * card_size_in_oops ) );
+    Universe::tenure();    // the new class as well
+
+    // the first dirty card only points to an old object, but the object is scanned as a whole since it isn't an
+    // array; the new object two cards further on must keep its card dirty for the next scavenge
+    std::int32_t first = MemOop( holder.as_oop() )->blueprint()->oop_header_size();
+    std::int32_t later = first + 2 * card_size_in_oops;
+    MemOop( holder.as_oop() )->raw_at_put( first, Universe::find_global( "Object" ) );
+    MemOop( holder.as_oop() )->raw_at_put( later, OopFactory::new_double( 3.5 ) );
+
+    for ( std::int32_t i = 0; i < 2; i++ ) {
+        Universe::scavenge();
+        MemOop old = MemOop( holder.as_oop() );
+        ASSERT_TRUE( old->raw_at( later )->is_new() );
+        ASSERT_EQ( 3.5, DoubleOop( old->raw_at( later ) )->value() );
+        ASSERT_FALSE( Universe::remembered_set->is_dirty( old->oops( first ) ) );
+        ASSERT_TRUE( Universe::remembered_set->is_dirty( old->oops( later ) ) );
+    }
+    Universe::verify();
+}
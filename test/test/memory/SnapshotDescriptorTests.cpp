@@ -0,0 +1,103 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/SnapshotDescriptor.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/memory/SymbolTable.hpp"
+#include "vm/oop/ObjectArrayOopDescriptor.hpp"
+#include "vm/oop/SmallIntegerOopDescriptor.hpp"
+#include "vm/runtime/arguments.hpp"
+
+#include <gtest/gtest.h>
+
+
+class SnapshotDescriptorTests : public ::testing::Test {
+
+protected:
+    const char  *_name    = "snapshot_descriptor_tests.snap";
+    SymbolTable *_symbols = nullptr;
+
+
+    void TearDown() override {
+        remove( _name );
+        if ( _symbols not_eq nullptr )
+            Universe::symbol_table = _symbols;
+        _symbols = nullptr;
+    }
+
+
+    // read_symbols adds every symbol of the snapshot to the symbol table; give it an empty one,
+    // as at startup, instead of adding them to the live table a second time
+    void useFreshSymbolTable() {
+        _symbols               = Universe::symbol_table;
+        Universe::symbol_table = new SymbolTable;
+    }
+
+};
+
+
+TEST_F( SnapshotDescriptorTests, bootstrapFileShouldNotBeSnapshot ) {
+    ASSERT_FALSE( SnapshotDescriptor::is_snapshot( image_basename ) );
+}
+
+
+TEST_F( SnapshotDescriptorTests, missingFileShouldNotBeSnapshot ) {
+    ASSERT_FALSE( SnapshotDescriptor::is_snapshot( "no_such_file.snap" ) );
+}
+
+
+TEST_F( SnapshotDescriptorTests, readFromOtherFileShouldFailWithoutTouchingHeap ) {
+    FILE *file = fopen( _name, "wb" );
+    fputs( "not a snapshot", file );
+    fclose( file );
+
+    std::int32_t used = Universe::old_gen.used();
+    SnapshotDescriptor sd;
+    sd.read_from( _name );
+    ASSERT_TRUE( sd.has_error() );
+    ASSERT_EQ( used, Universe::old_gen.used() );
+}
+
+
+TEST_F( SnapshotDescriptorTests, writeOnShouldFailWhenNewGenerationIsNotEmpty ) {
+    OopFactory::new_objectArray( 10 );
+    ASSERT_TRUE( Universe::new_gen.used() > 0 );
+
+    SnapshotDescriptor sd;
+    sd.write_on( _name );
+    ASSERT_TRUE( sd.has_error() );
+    ASSERT_FALSE( SnapshotDescriptor::is_snapshot( _name ) );
+}
+
+
+TEST_F( SnapshotDescriptorTests, writtenSnapshotShouldReadBackSameObjects ) {
+    ObjectArrayOop array = OopFactory::new_objectArray( 3 );
+    array->obj_at_put( 1, smiOopFromValue( 17 ) );
+    array->obj_at_put( 2, OopFactory::new_symbol( "snapshotDescriptorTests" ) );
+    array = ObjectArrayOop( Universe::tenure( array ) );        // empties the new generation too
+
+    std::int32_t used        = Universe::old_gen.used();
+    Oop          objectClass = Universe::find_global( "Object" );
+
+    SnapshotDescriptor out;
+    out.write_on( _name );
+    ASSERT_FALSE( out.has_error() );
+    ASSERT_TRUE( SnapshotDescriptor::is_snapshot( _name ) );
+
+    // the old space is read back at the address it was written from, so the objects keep their addresses
+    useFreshSymbolTable();
+    SnapshotDescriptor in;
+    in.read_from( _name );
+    ASSERT_FALSE( in.has_error() );
+    ASSERT_EQ( used, Universe::old_gen.used() );
+    ASSERT_EQ( objectClass, Universe::find_global( "Object" ) );
+    ASSERT_EQ( 3, array->length() );
+    ASSERT_EQ( smiOopFromValue( 17 ), array->obj_at( 1 ) );
+    ASSERT_EQ( OopFactory::new_symbol( "snapshotDescriptorTests" ), array->obj_at( 2 ) );
+    ASSERT_EQ( nilObject, array->obj_at( 3 ) );
+    ASSERT_TRUE( Universe::symbol_table->is_present( SymbolOop( array->obj_at( 2 ) ) ) );
+    Universe::verify();
+}
@@ -0,0 +1,41 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/memory/Scavenge.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/oop/MixinOopDescriptor.hpp"
+#include "vm/oop/ObjectArrayOopDescriptor.hpp"
+#include "vm/klass/Klass.hpp"
+
+
+// Creates classes for tests the way the class builder does, but without installing them anywhere.
+
+inline MixinOop newTestMixin( const char *mixinClassName, ObjectArrayOop instVars ) {
+    MixinOop mixin = MixinOop( KlassOop( Universe::find_global( mixinClassName ) )->klass_part()->allocateObject() );
+    mixin->set_methods( OopFactory::new_objectArray( std::int32_t{ 0 } ) );
+    mixin->set_instVars( instVars );
+    mixin->set_classVars( OopFactory::new_objectArray( std::int32_t{ 0 } ) );
+    mixin->set_installed( falseObject );
+    return mixin;
+}
+
+
+// a new subclass of Object with instVars instance variables
+inline KlassOop newTestClass( std::int32_t instVars ) {
+    BlockScavenge  bs;
+    ObjectArrayOop names = OopFactory::new_objectArray( instVars );
+    SymbolOop      name  = OopFactory::new_symbol( "testVariable" );
+    for ( std::int32_t i = 1; i <= instVars; i++ )
+        names->obj_at_put( i, name );
+
+    MixinOop mixin = newTestMixin( "ClassMixin", names );
+    mixin->set_class_mixin( newTestMixin( "MetaClassMixin", OopFactory::new_objectArray( std::int32_t{ 0 } ) ) );
+    return KlassOop( Universe::find_global( "Object" ) )->klass_part()->create_subclass( mixin, Klass::Format::mem_klass );
+}
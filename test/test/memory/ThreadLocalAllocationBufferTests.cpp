@@ -0,0 +1,101 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/memory/ThreadLocalAllocationBuffer.hpp"
+#include "vm/oop/ObjectArrayOopDescriptor.hpp"
+#include "vm/runtime/flags.hpp"
+
+#include <gtest/gtest.h>
+
+
+class ThreadLocalAllocationBufferTests : public ::testing::Test {
+
+protected:
+    bool _useTLAB;
+
+
+    void SetUp() override {
+        _useTLAB = UseTLAB;
+        UseTLAB  = true;
+        ThreadLocalAllocationBuffer::retire_all();
+    }
+
+
+    void TearDown() override {
+        UseTLAB = _useTLAB;
+    }
+
+
+    // allocates 4 words and makes them a filler object, so that the heap stays parsable
+    Oop *allocate() {
+        Oop *p = Universe::allocate( 4 );
+        Universe::fill( p, p + 4 );
+        return p;
+    }
+
+};
+
+
+TEST_F( ThreadLocalAllocationBufferTests, allocationShouldRefillEmptyBuffer ) {
+    std::int32_t refills = ThreadLocalAllocationBuffer::refills();
+    Oop          *eden   = Universe::new_gen.eden()->top();
+
+    Oop *first  = allocate();
+    Oop *second = allocate();
+
+    ASSERT_EQ( refills + 1, ThreadLocalAllocationBuffer::refills() );
+    ASSERT_EQ( eden, first );
+    ASSERT_EQ( first + 4, second );
+    ASSERT_EQ( second + 4, tlab_top );
+    ASSERT_TRUE( Universe::new_gen.eden()->top() > tlab_end );
+}
+
+
+TEST_F( ThreadLocalAllocationBufferTests, largeObjectsShouldBypassBuffer ) {
+    allocate();
+    Oop *top = tlab_top;
+
+    ObjectArrayOop array = OopFactory::new_objectArray( TLABSize * 1024 / OOP_SIZE );
+    ASSERT_EQ( top, tlab_top );
+    ASSERT_FALSE( array->is_old() );
+}
+
+
+TEST_F( ThreadLocalAllocationBufferTests, retiredBufferShouldBeEmpty ) {
+    allocate();
+    ASSERT_TRUE( tlab_top not_eq nullptr );
+
+    ThreadLocalAllocationBuffer::retire_all();
+    ASSERT_EQ( nullptr, tlab_top );
+    ASSERT_EQ( nullptr, tlab_end );
+    Universe::verify();
+}
+
+
+TEST_F( ThreadLocalAllocationBufferTests, saveAndRestoreShouldMoveActiveBuffer ) {
+    allocate();
+    Oop *top = tlab_top;
+    Oop *end = tlab_end;
+
+    ThreadLocalAllocationBuffer saved;
+    saved.save();
+    ASSERT_FALSE( saved.is_empty() );
+    ASSERT_EQ( nullptr, tlab_top );
+
+    saved.restore();
+    ASSERT_TRUE( saved.is_empty() );
+    ASSERT_EQ( top, tlab_top );
+    ASSERT_EQ( end, tlab_end );
+}
+
+
+TEST_F( ThreadLocalAllocationBufferTests, scavengeShouldRetireBuffer ) {
+    allocate();
+    Universe::scavenge();
+    ASSERT_EQ( nullptr, tlab_top );
+    ASSERT_TRUE( Universe::new_gen.eden()->is_empty() );
+}
@@ -0,0 +1,111 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/code/ZoneHeap.hpp"
+
+#include <gtest/gtest.h>
+
+
+class ZoneHeapTests : public ::testing::Test {
+
+protected:
+    static constexpr std::int32_t block_size = 64;
+    static constexpr std::int32_t heap_size  = 1024 * block_size;
+
+    ZoneHeap *heap;
+
+
+    void SetUp() override {
+        heap = new ZoneHeap( heap_size, block_size );    // not deleted: the heap's code memory can't be freed
+    }
+
+
+    std::int32_t freeChunks() const {
+        std::int32_t counts[ZoneHeap::histogram_size];
+        std::int32_t bytes[ZoneHeap::histogram_size];
+        heap->free_histogram( counts, bytes );
+
+        std::int32_t n = 0;
+        for ( std::int32_t i = 0; i < ZoneHeap::histogram_size; i++ )
+            n += counts[ i ];
+        return n;
+    }
+
+};
+
+
+TEST_F( ZoneHeapTests, emptyHeapShouldBeOneFreeChunk ) {
+    std::int32_t counts[ZoneHeap::histogram_size];
+    std::int32_t bytes[ZoneHeap::histogram_size];
+    heap->free_histogram( counts, bytes );
+
+    ASSERT_EQ( 1, counts[ 10 ] );    // 1024 blocks
+    ASSERT_EQ( heap_size, bytes[ 10 ] );
+    ASSERT_EQ( heap_size, heap->largestFreeChunk() );
+}
+
+
+TEST_F( ZoneHeapTests, bigAllocationShouldReuseChunkOfItsSizeClass ) {
+    void *a = heap->allocate( 100 * block_size );
+    void *b = heap->allocate( 10 * block_size );     // keeps a from being combined with the rest
+    void *c = heap->allocate( 40 * block_size );
+    void *d = heap->allocate( 10 * block_size );
+    ASSERT_TRUE( a and b and c and d );
+
+    heap->deallocate( a, 100 * block_size );
+    heap->deallocate( c, 40 * block_size );
+    ASSERT_EQ( 3, freeChunks() );
+
+    // the 40 block chunk fits, so the 100 block chunk is left alone
+    void *e = heap->allocate( 35 * block_size );
+    ASSERT_EQ( c, e );
+    ASSERT_EQ( 100 * block_size, heap->sizeOfBlock( a ) );
+    heap->verify();
+}
+
+
+TEST_F( ZoneHeapTests, deallocationShouldCombineBigChunks ) {
+    void *a = heap->allocate( 100 * block_size );
+    void *b = heap->allocate( 100 * block_size );
+    ASSERT_TRUE( a and b );
+
+    heap->deallocate( a, 100 * block_size );
+    heap->deallocate( b, 100 * block_size );
+    ASSERT_EQ( 1, freeChunks() );
+    ASSERT_EQ( heap_size, heap->largestFreeChunk() );
+}
+
+
+TEST_F( ZoneHeapTests, histogramShouldCountFreeBytes ) {
+    void *a = heap->allocate( 3 * block_size );
+    void *b = heap->allocate( 1 * block_size );
+    ASSERT_TRUE( a and b );
+    heap->deallocate( a, 3 * block_size );
+
+    std::int32_t counts[ZoneHeap::histogram_size];
+    std::int32_t bytes[ZoneHeap::histogram_size];
+    heap->free_histogram( counts, bytes );
+
+    std::int32_t free = 0;
+    for ( std::int32_t i = 0; i < ZoneHeap::histogram_size; i++ )
+        free += bytes[ i ];
+    ASSERT_EQ( heap->freeBytes(), free );
+    ASSERT_EQ( 1, counts[ 1 ] );    // the 3 blocks of a
+}
+
+
+TEST_F( ZoneHeapTests, topAllocationShouldUseEndOfHeap ) {
+    void *hot  = heap->allocate( 100 * block_size );
+    void *cold = heap->allocate( 100 * block_size, true );
+    ASSERT_EQ( heap->startAddr(), hot );
+    ASSERT_EQ( heap->endAddr() - 100 * block_size, cold );
+
+    // the space between them remains one free chunk
+    ASSERT_EQ( 1, freeChunks() );
+    ASSERT_EQ( heap_size - 200 * block_size, heap->largestFreeChunk() );
+    ASSERT_EQ( hot, heap->firstUsed() );
+    ASSERT_EQ( cold, heap->nextUsed( hot ) );
+    heap->verify();
+}
@@ -15,6 +15,7 @@
 #include "vm/runtime/VMSymbol.hpp"
 #include "vm/runtime/ResourceMark.hpp"
 #include "vm/memory/Scavenge.hpp"
+#include "vm/memory/OopFactory.hpp"
 
 #include <gtest/gtest.h>
 
@@ -361,3 +362,87 @@ TEST_F( ByteArrayPrimsTests, alienUnsignedByteAtShouldReturnMarkedSymbolWhenInde
     result = ByteArrayPrimitives::alienUnsignedByteAt( smiOopFromValue( 0 ), alien );
     checkMarkedSymbol( "invalid argument", result, vmSymbols::index_not_valid() );
 }
+
+
+TEST_F( ByteArrayPrimsTests, indexOfShouldAnswerIndexOfFirstMatchFromStart ) {
+    ByteArrayOop bytes = OopFactory::new_byteArray( "abcabc" );
+    ASSERT_EQ( smiOopFromValue( 3 ), ByteArrayPrimitives::indexOf( smiOopFromValue( 1 ), smiOopFromValue( 'c' ), bytes ) );
+    ASSERT_EQ( smiOopFromValue( 6 ), ByteArrayPrimitives::indexOf( smiOopFromValue( 4 ), smiOopFromValue( 'c' ), bytes ) );
+    ASSERT_EQ( smiOopFromValue( 0 ), ByteArrayPrimitives::indexOf( smiOopFromValue( 1 ), smiOopFromValue( 'x' ), bytes ) );
+    ASSERT_EQ( smiOopFromValue( 0 ), ByteArrayPrimitives::indexOf( smiOopFromValue( 7 ), smiOopFromValue( 'c' ), bytes ) );
+}
+
+
+TEST_F( ByteArrayPrimsTests, indexOfShouldReturnMarkedSymbolWhenStartOutOfBounds ) {
+    ByteArrayOop bytes = OopFactory::new_byteArray( "abcabc" );
+    checkMarkedSymbol( "start too small", ByteArrayPrimitives::indexOf( smiOopFromValue( 0 ), smiOopFromValue( 'a' ), bytes ), vmSymbols::out_of_bounds() );
+    checkMarkedSymbol( "start too large", ByteArrayPrimitives::indexOf( smiOopFromValue( 8 ), smiOopFromValue( 'a' ), bytes ), vmSymbols::out_of_bounds() );
+}
+
+
+TEST_F( ByteArrayPrimsTests, indexOfShouldReturnMarkedSymbolWhenArgumentsInvalid ) {
+    ByteArrayOop bytes = OopFactory::new_byteArray( "abcabc" );
+    checkMarkedSymbol( "value not a byte", ByteArrayPrimitives::indexOf( smiOopFromValue( 1 ), smiOopFromValue( 256 ), bytes ), vmSymbols::value_out_of_range() );
+    checkMarkedSymbol( "value negative", ByteArrayPrimitives::indexOf( smiOopFromValue( 1 ), smiOopFromValue( -1 ), bytes ), vmSymbols::value_out_of_range() );
+    checkMarkedSymbol( "value wrong type", ByteArrayPrimitives::indexOf( smiOopFromValue( 1 ), vmSymbols::abs(), bytes ), vmSymbols::first_argument_has_wrong_type() );
+    checkMarkedSymbol( "start wrong type", ByteArrayPrimitives::indexOf( vmSymbols::abs(), smiOopFromValue( 'a' ), bytes ), vmSymbols::second_argument_has_wrong_type() );
+}
+
+
+TEST_F( ByteArrayPrimsTests, indexOfBytesShouldAnswerIndexOfFirstMatchFromStart ) {
+    ByteArrayOop bytes = OopFactory::new_byteArray( "abcabc" );
+    ByteArrayOop ca    = OopFactory::new_byteArray( "ca" );
+    ASSERT_EQ( smiOopFromValue( 3 ), ByteArrayPrimitives::indexOfBytes( smiOopFromValue( 1 ), ca, bytes ) );
+    ASSERT_EQ( smiOopFromValue( 0 ), ByteArrayPrimitives::indexOfBytes( smiOopFromValue( 4 ), ca, bytes ) );
+    ASSERT_EQ( smiOopFromValue( 4 ), ByteArrayPrimitives::indexOfBytes( smiOopFromValue( 2 ), OopFactory::new_byteArray( "abc" ), bytes ) );
+}
+
+
+TEST_F( ByteArrayPrimsTests, indexOfBytesShouldReturnMarkedSymbolWhenArgumentsInvalid ) {
+    ByteArrayOop bytes = OopFactory::new_byteArray( "abcabc" );
+    ByteArrayOop ca    = OopFactory::new_byteArray( "ca" );
+    checkMarkedSymbol( "start too small", ByteArrayPrimitives::indexOfBytes( smiOopFromValue( 0 ), ca, bytes ), vmSymbols::out_of_bounds() );
+    checkMarkedSymbol( "start too large", ByteArrayPrimitives::indexOfBytes( smiOopFromValue( 8 ), ca, bytes ), vmSymbols::out_of_bounds() );
+    checkMarkedSymbol( "pattern wrong type", ByteArrayPrimitives::indexOfBytes( smiOopFromValue( 1 ), smiOopFromValue( 1 ), bytes ), vmSymbols::first_argument_has_wrong_type() );
+    checkMarkedSymbol( "start wrong type", ByteArrayPrimitives::indexOfBytes( vmSymbols::abs(), ca, bytes ), vmSymbols::second_argument_has_wrong_type() );
+}
+
+
+TEST_F( ByteArrayPrimsTests, replaceFromToShouldCopyBytes ) {
+    ByteArrayOop bytes  = OopFactory::new_byteArray( "abcdef" );
+    Oop          result = ByteArrayPrimitives::replaceFromTo( smiOopFromValue( 2 ), OopFactory::new_byteArray( "wxyz" ), smiOopFromValue( 4 ), smiOopFromValue( 2 ), bytes );
+    ASSERT_EQ( bytes, result );
+    ASSERT_EQ( 0, strncmp( "axyzef", (const char *) bytes->bytes(), 6 ) );
+}
+
+
+TEST_F( ByteArrayPrimsTests, replaceFromToShouldAllowOverlapAndEmptyRange ) {
+    ByteArrayOop bytes = OopFactory::new_byteArray( "abcdef" );
+    ByteArrayPrimitives::replaceFromTo( smiOopFromValue( 1 ), bytes, smiOopFromValue( 4 ), smiOopFromValue( 2 ), bytes );
+    ASSERT_EQ( 0, strncmp( "aabcef", (const char *) bytes->bytes(), 6 ) );
+
+    ASSERT_EQ( bytes, ByteArrayPrimitives::replaceFromTo( smiOopFromValue( 7 ), bytes, smiOopFromValue( 2 ), smiOopFromValue( 3 ), bytes ) );
+    ASSERT_EQ( 0, strncmp( "aabcef", (const char *) bytes->bytes(), 6 ) );
+}
+
+
+TEST_F( ByteArrayPrimsTests, replaceFromToShouldReturnMarkedSymbolWhenOutOfBounds ) {
+    ByteArrayOop bytes  = OopFactory::new_byteArray( "abcdef" );
+    ByteArrayOop source = OopFactory::new_byteArray( "xyz" );
+    checkMarkedSymbol( "from too small", ByteArrayPrimitives::replaceFromTo( smiOopFromValue( 1 ), source, smiOopFromValue( 2 ), smiOopFromValue( 0 ), bytes ), vmSymbols::out_of_bounds() );
+    checkMarkedSymbol( "to too large", ByteArrayPrimitives::replaceFromTo( smiOopFromValue( 1 ), source, smiOopFromValue( 7 ), smiOopFromValue( 5 ), bytes ), vmSymbols::out_of_bounds() );
+    checkMarkedSymbol( "to before from", ByteArrayPrimitives::replaceFromTo( smiOopFromValue( 1 ), source, smiOopFromValue( 1 ), smiOopFromValue( 3 ), bytes ), vmSymbols::out_of_bounds() );
+    checkMarkedSymbol( "source too short", ByteArrayPrimitives::replaceFromTo( smiOopFromValue( 2 ), source, smiOopFromValue( 3 ), smiOopFromValue( 1 ), bytes ), vmSymbols::out_of_bounds() );
+    checkMarkedSymbol( "start too small", ByteArrayPrimitives::replaceFromTo( smiOopFromValue( 0 ), source, smiOopFromValue( 3 ), smiOopFromValue( 1 ), bytes ), vmSymbols::out_of_bounds() );
+    ASSERT_EQ( 0, strncmp( "abcdef", (const char *) bytes->bytes(), 6 ) );
+}
+
+
+TEST_F( ByteArrayPrimsTests, replaceFromToShouldReturnMarkedSymbolWhenArgumentsWrongType ) {
+    ByteArrayOop bytes  = OopFactory::new_byteArray( "abcdef" );
+    ByteArrayOop source = OopFactory::new_byteArray( "xyz" );
+    checkMarkedSymbol( "from", ByteArrayPrimitives::replaceFromTo( smiOopFromValue( 1 ), source, smiOopFromValue( 3 ), vmSymbols::abs(), bytes ), vmSymbols::first_argument_has_wrong_type() );
+    checkMarkedSymbol( "to", ByteArrayPrimitives::replaceFromTo( smiOopFromValue( 1 ), source, vmSymbols::abs(), smiOopFromValue( 1 ), bytes ), vmSymbols::second_argument_has_wrong_type() );
+    checkMarkedSymbol( "source", ByteArrayPrimitives::replaceFromTo( smiOopFromValue( 1 ), smiOopFromValue( 1 ), smiOopFromValue( 3 ), smiOopFromValue( 1 ), bytes ), vmSymbols::third_argument_has_wrong_type() );
+    checkMarkedSymbol( "start", ByteArrayPrimitives::replaceFromTo( vmSymbols::abs(), source, smiOopFromValue( 3 ), smiOopFromValue( 1 ), bytes ), vmSymbols::fourth_argument_has_wrong_type() );
+}
@@ -44,6 +44,14 @@ protected:
     KlassOop dByteArrayClass;
 
 
+    DoubleByteArrayOop newString( const char *contents ) {
+        std::int32_t       length = strlen( contents );
+        DoubleByteArrayOop result = DoubleByteArrayOop( DoubleByteArrayPrimitives::allocateSize2( falseObject, smiOopFromValue( length ), dByteArrayClass ) );
+        for ( std::int32_t index = 1; index <= length; index++ )
+            result->doubleByte_at_put( index, contents[ index - 1 ] );
+        return result;
+    }
+
 };
 
 
@@ -129,3 +137,47 @@ TEST_F( DoubleByteArrayPrimitivesTests, allocateSize2ShouldFailWhenTooBigForOldG
     ASSERT_TRUE( result->isMarkOop() );
     EXPECT_EQ( markSymbol( vmSymbols::failed_allocation() ), result ) << unmarkSymbol( result )->as_string();
 }
+
+
+TEST_F( DoubleByteArrayPrimitivesTests, atAllPutShouldFillEveryElement ) {
+    DoubleByteArrayOop string = newString( "abcdefghijklmnopq" );
+    ASSERT_EQ( string, DoubleByteArrayPrimitives::at_all_put( smiOopFromValue( 0x1234 ), string ) );
+    for ( std::int32_t index = 1; index <= string->length(); index++ )
+        ASSERT_EQ( std::uint16_t( 0x1234 ), string->doubleByte_at( index ) );
+}
+
+
+TEST_F( DoubleByteArrayPrimitivesTests, atAllPutShouldFailWhenValueInvalid ) {
+    DoubleByteArrayOop string = newString( "abc" );
+    Oop                result = DoubleByteArrayPrimitives::at_all_put( smiOopFromValue( 1 << 16 ), string );
+    ASSERT_EQ( markSymbol( vmSymbols::value_out_of_range() ), result );
+    result = DoubleByteArrayPrimitives::at_all_put( Universe::nilObject(), string );
+    ASSERT_EQ( markSymbol( vmSymbols::first_argument_has_wrong_type() ), result );
+    ASSERT_EQ( std::uint16_t( 'a' ), string->doubleByte_at( 1 ) );
+}
+
+
+TEST_F( DoubleByteArrayPrimitivesTests, indexOfShouldAnswerIndexOfFirstMatchFromStart ) {
+    DoubleByteArrayOop string = newString( "abcabc" );
+    string->doubleByte_at_put( 5, 0x1234 );
+    ASSERT_EQ( smiOopFromValue( 3 ), DoubleByteArrayPrimitives::indexOf( smiOopFromValue( 1 ), smiOopFromValue( 'c' ), string ) );
+    ASSERT_EQ( smiOopFromValue( 6 ), DoubleByteArrayPrimitives::indexOf( smiOopFromValue( 4 ), smiOopFromValue( 'c' ), string ) );
+    ASSERT_EQ( smiOopFromValue( 5 ), DoubleByteArrayPrimitives::indexOf( smiOopFromValue( 1 ), smiOopFromValue( 0x1234 ), string ) );
+    ASSERT_EQ( smiOopFromValue( 0 ), DoubleByteArrayPrimitives::indexOf( smiOopFromValue( 1 ), smiOopFromValue( 0x34 ), string ) );
+    ASSERT_EQ( smiOopFromValue( 0 ), DoubleByteArrayPrimitives::indexOf( smiOopFromValue( 7 ), smiOopFromValue( 'c' ), string ) );
+}
+
+
+TEST_F( DoubleByteArrayPrimitivesTests, indexOfShouldFailWhenStartOutOfBounds ) {
+    DoubleByteArrayOop string = newString( "abcabc" );
+    ASSERT_EQ( markSymbol( vmSymbols::out_of_bounds() ), DoubleByteArrayPrimitives::indexOf( smiOopFromValue( 0 ), smiOopFromValue( 'a' ), string ) );
+    ASSERT_EQ( markSymbol( vmSymbols::out_of_bounds() ), DoubleByteArrayPrimitives::indexOf( smiOopFromValue( 8 ), smiOopFromValue( 'a' ), string ) );
+}
+
+
+TEST_F( DoubleByteArrayPrimitivesTests, indexOfShouldFailWhenArgumentsInvalid ) {
+    DoubleByteArrayOop string = newString( "abcabc" );
+    ASSERT_EQ( markSymbol( vmSymbols::value_out_of_range() ), DoubleByteArrayPrimitives::indexOf( smiOopFromValue( 1 ), smiOopFromValue( 1 << 16 ), string ) );
+    ASSERT_EQ( markSymbol( vmSymbols::first_argument_has_wrong_type() ), DoubleByteArrayPrimitives::indexOf( smiOopFromValue( 1 ), Universe::nilObject(), string ) );
+    ASSERT_EQ( markSymbol( vmSymbols::second_argument_has_wrong_type() ), DoubleByteArrayPrimitives::indexOf( Universe::nilObject(), smiOopFromValue( 'a' ), string ) );
+}
@@ -0,0 +1,147 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/MarkSweep.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/oop/DoubleOopDescriptor.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/oop/DoubleValueArrayOopDescriptor.hpp"
+#include "vm/primitive/DoubleValueArray_primitives.hpp"
+#include "vm/runtime/VMSymbol.hpp"
+#include "vm/runtime/flags.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+
+
+class DoubleValueArrayPrimitivesTests : public ::testing::Test {
+
+public:
+    DoubleValueArrayPrimitivesTests() :
+        ::testing::Test(),
+        theClass{},
+        useSSE2{ false } {}
+
+
+protected:
+    void SetUp() override {
+        theClass = KlassOop( Universe::find_global( "DoubleValueArray" ) );
+        useSSE2  = UseSSE2;
+    }
+
+
+    void TearDown() override {
+        UseSSE2 = useSSE2;
+        MarkSweep::collect();
+    }
+
+
+    DoubleValueArrayOop arrayOf( std::int32_t length, double first, double step ) {
+        DoubleValueArrayOop array = DoubleValueArrayOop( DoubleValueArrayPrimitives::allocateSize( theClass, smiOopFromValue( length ) ) );
+        for ( std::int32_t i = 1; i <= length; i++ ) {
+            array->double_at_put( i, first + ( i - 1 ) * step );
+        }
+        return array;
+    }
+
+
+    KlassOop theClass;
+    bool     useSSE2;
+
+};
+
+
+TEST_F( DoubleValueArrayPrimitivesTests, addShouldAddElementWise ) {
+    for ( bool sse2 : { false, true } ) {
+        UseSSE2 = sse2;
+        DoubleValueArrayOop x = arrayOf( 5, 1.0, 1.0 );
+        DoubleValueArrayOop y = arrayOf( 5, 10.0, 10.0 );
+        ASSERT_EQ( x, DoubleValueArrayPrimitives::add( x, y ) );
+        for ( std::int32_t i = 1; i <= 5; i++ ) {
+            ASSERT_EQ( 11.0 * i, x->double_at( i ) );
+        }
+    }
+}
+
+
+TEST_F( DoubleValueArrayPrimitivesTests, addShouldFailWhenSizesDiffer ) {
+    DoubleValueArrayOop x = arrayOf( 5, 1.0, 1.0 );
+    DoubleValueArrayOop y = arrayOf( 4, 1.0, 1.0 );
+    ASSERT_EQ( markSymbol( vmSymbols::argument_is_invalid() ), DoubleValueArrayPrimitives::add( x, y ) );
+}
+
+
+TEST_F( DoubleValueArrayPrimitivesTests, dotShouldAnswerSumOfProducts ) {
+    for ( bool sse2 : { false, true } ) {
+        UseSSE2 = sse2;
+        DoubleValueArrayOop x      = arrayOf( 5, 1.0, 1.0 );
+        DoubleValueArrayOop y      = arrayOf( 5, 2.0, 0.0 );
+        Oop                 result = DoubleValueArrayPrimitives::dot( x, y );
+        ASSERT_TRUE( result->isDouble() );
+        ASSERT_EQ( 30.0, DoubleOop( result )->value() );
+    }
+}
+
+
+TEST_F( DoubleValueArrayPrimitivesTests, minAndMaxShouldAnswerExtremes ) {
+    for ( bool sse2 : { false, true } ) {
+        UseSSE2 = sse2;
+        DoubleValueArrayOop x = arrayOf( 7, 3.0, -1.0 );
+        ASSERT_EQ( -3.0, DoubleOop( DoubleValueArrayPrimitives::min( x ) )->value() );
+        ASSERT_EQ( 3.0, DoubleOop( DoubleValueArrayPrimitives::max( x ) )->value() );
+    }
+}
+
+
+TEST_F( DoubleValueArrayPrimitivesTests, minAndMaxShouldIgnoreNaNs ) {
+    // a NaN in every position, in the vector part and in the tail of the SSE2 kernel
+    for ( bool sse2 : { false, true } ) {
+        UseSSE2 = sse2;
+        for ( std::int32_t nan = 1; nan <= 7; nan++ ) {
+            DoubleValueArrayOop x = arrayOf( 7, 3.0, -1.0 );
+            x->double_at_put( nan, NAN );
+            double min = nan == 7 ? -2.0 : -3.0;
+            double max = nan == 1 ? 2.0 : 3.0;
+            ASSERT_EQ( min, DoubleOop( DoubleValueArrayPrimitives::min( x ) )->value() ) << "NaN at " << nan << ", sse2 " << sse2;
+            ASSERT_EQ( max, DoubleOop( DoubleValueArrayPrimitives::max( x ) )->value() ) << "NaN at " << nan << ", sse2 " << sse2;
+        }
+    }
+}
+
+
+TEST_F( DoubleValueArrayPrimitivesTests, minOfNaNsShouldBeNaN ) {
+    for ( bool sse2 : { false, true } ) {
+        UseSSE2 = sse2;
+        DoubleValueArrayOop x = arrayOf( 5, NAN, 0.0 );
+        ASSERT_TRUE( std::isnan( DoubleOop( DoubleValueArrayPrimitives::min( x ) )->value() ) );
+        ASSERT_TRUE( std::isnan( DoubleOop( DoubleValueArrayPrimitives::max( x ) )->value() ) );
+    }
+}
+
+
+TEST_F( DoubleValueArrayPrimitivesTests, minShouldFailWhenEmpty ) {
+    DoubleValueArrayOop x = arrayOf( 0, 0.0, 0.0 );
+    ASSERT_EQ( markSymbol( vmSymbols::out_of_bounds() ), DoubleValueArrayPrimitives::min( x ) );
+}
+
+
+TEST_F( DoubleValueArrayPrimitivesTests, replaceFromToShouldCopyRange ) {
+    DoubleValueArrayOop x = arrayOf( 5, 0.0, 0.0 );
+    DoubleValueArrayOop y = arrayOf( 5, 1.0, 1.0 );
+    DoubleValueArrayPrimitives::replace_from_to( x, smiOopFromValue( 2 ), smiOopFromValue( 3 ), y, smiOopFromValue( 4 ) );
+    ASSERT_EQ( 0.0, x->double_at( 1 ) );
+    ASSERT_EQ( 4.0, x->double_at( 2 ) );
+    ASSERT_EQ( 5.0, x->double_at( 3 ) );
+    ASSERT_EQ( 0.0, x->double_at( 4 ) );
+}
+
+
+TEST_F( DoubleValueArrayPrimitivesTests, fromToPutShouldFailOutsideBounds ) {
+    DoubleValueArrayOop x = arrayOf( 5, 0.0, 0.0 );
+    Oop                 v = OopFactory::new_double( 1.0 );
+    ASSERT_EQ( markSymbol( vmSymbols::out_of_bounds() ), DoubleValueArrayPrimitives::from_to_put( x, smiOopFromValue( 0 ), smiOopFromValue( 3 ), v ) );
+    ASSERT_EQ( markSymbol( vmSymbols::out_of_bounds() ), DoubleValueArrayPrimitives::from_to_put( x, smiOopFromValue( 1 ), smiOopFromValue( 6 ), v ) );
+}
@@ -0,0 +1,129 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/platform/platform.hpp"
+#include "vm/utility/StringOps.hpp"
+#include "vm/runtime/flags.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+
+// Every test is run with and without the SSE2 kernels; the strings are longer than one vector so
+// that both the vector loop and the scalar tail are exercised.
+
+class StringOpsTests : public ::testing::TestWithParam<bool> {
+
+protected:
+    bool         useSSE2;
+    std::uint8_t text[ 64 ];
+
+
+    void SetUp() override {
+        useSSE2 = UseSSE2;
+        UseSSE2 = GetParam();
+        for ( std::int32_t i = 0; i < 64; i++ ) {
+            text[ i ] = 'a' + i % 26;
+        }
+    }
+
+
+    void TearDown() override {
+        UseSSE2 = useSSE2;
+    }
+
+};
+
+
+TEST_P( StringOpsTests, compareShouldFindFirstDifference ) {
+    std::uint8_t other[ 64 ];
+    memcpy( other, text, 64 );
+    ASSERT_EQ( 0, StringOps::compare( text, 64, other, 64 ) );
+
+    other[ 40 ] = 'z' + 1;
+    ASSERT_EQ( -1, StringOps::compare( text, 64, other, 64 ) );
+    ASSERT_EQ( 1, StringOps::compare( other, 64, text, 64 ) );
+    ASSERT_EQ( 0, StringOps::compare( text, 40, other, 40 ) );
+}
+
+
+TEST_P( StringOpsTests, compareShouldOrderPrefixFirst ) {
+    ASSERT_EQ( -1, StringOps::compare( text, 30, text, 31 ) );
+    ASSERT_EQ( 1, StringOps::compare( text, 31, text, 30 ) );
+    ASSERT_EQ( 0, StringOps::compare( text, 0, text, 0 ) );
+}
+
+
+TEST_P( StringOpsTests, equalsShouldNotStopAtNull ) {
+    std::uint8_t a[ 20 ] = { 0 };
+    std::uint8_t b[ 20 ] = { 0 };
+    b[ 19 ] = 1;
+    ASSERT_TRUE( StringOps::equals( a, b, 19 ) );
+    ASSERT_FALSE( StringOps::equals( a, b, 20 ) );
+}
+
+
+TEST_P( StringOpsTests, indexOfByteShouldFindFirstOccurrence ) {
+    ASSERT_EQ( 0, StringOps::index_of( text, 64, ( std::uint8_t ) 'a' ) );
+    ASSERT_EQ( 25, StringOps::index_of( text, 64, ( std::uint8_t ) 'z' ) );
+    ASSERT_EQ( 21, StringOps::index_of( text + 30, 34, ( std::uint8_t ) 'z' ) );
+    ASSERT_EQ( -1, StringOps::index_of( text, 64, ( std::uint8_t ) '!' ) );
+    ASSERT_EQ( -1, StringOps::index_of( text, 0, ( std::uint8_t ) 'a' ) );
+}
+
+
+TEST_P( StringOpsTests, indexOfPatternShouldFindFirstOccurrence ) {
+    ASSERT_EQ( 0, StringOps::index_of( text, 64, ( const std::uint8_t * ) "abc", 3 ) );
+    ASSERT_EQ( 23, StringOps::index_of( text, 64, ( const std::uint8_t * ) "xyzab", 5 ) );
+    ASSERT_EQ( 25, StringOps::index_of( text + 1, 63, ( const std::uint8_t * ) "abcdefghijkl", 12 ) );
+    ASSERT_EQ( 7, StringOps::index_of( text, 64, ( const std::uint8_t * ) "h", 1 ) );
+    ASSERT_EQ( -1, StringOps::index_of( text, 64, ( const std::uint8_t * ) "abd", 3 ) );
+    ASSERT_EQ( 0, StringOps::index_of( text, 64, ( const std::uint8_t * ) "", 0 ) );
+    ASSERT_EQ( -1, StringOps::index_of( text, 2, ( const std::uint8_t * ) "abc", 3 ) );
+}
+
+
+TEST_P( StringOpsTests, fillShouldSetAllElements ) {
+    std::uint16_t wide[ 21 ];
+    StringOps::fill( wide, 21, 0x1234 );
+    for ( std::int32_t i = 0; i < 21; i++ ) {
+        ASSERT_EQ( 0x1234, wide[ i ] );
+    }
+}
+
+
+TEST_P( StringOpsTests, doubleByteOperations ) {
+    std::uint16_t a[ 21 ];
+    std::uint16_t b[ 21 ];
+    for ( std::int32_t i = 0; i < 21; i++ ) {
+        a[ i ] = b[ i ] = 0x100 + i;
+    }
+    ASSERT_EQ( 0, StringOps::compare( a, 21, b, 21 ) );
+    b[ 17 ] = 0xFFFF;
+    ASSERT_EQ( -1, StringOps::compare( a, 21, b, 21 ) );
+    ASSERT_EQ( 17, StringOps::index_of( b, 21, 0xFFFF ) );
+    ASSERT_EQ( -1, StringOps::index_of( a, 21, 0xFFFF ) );
+}
+
+
+TEST_P( StringOpsTests, narrowShouldFailOnWideCharacters ) {
+    std::uint16_t wide[ 40 ];
+    std::uint8_t  narrow[ 40 ];
+    for ( std::int32_t i = 0; i < 40; i++ ) {
+        wide[ i ] = text[ i ];
+    }
+    ASSERT_TRUE( StringOps::narrow( narrow, wide, 40 ) );
+    ASSERT_EQ( 0, memcmp( narrow, text, 40 ) );
+
+    wide[ 20 ] = 0x100;
+    ASSERT_FALSE( StringOps::narrow( narrow, wide, 40 ) );
+    wide[ 20 ] = 'a';
+    wide[ 39 ] = 0x100;
+    ASSERT_FALSE( StringOps::narrow( narrow, wide, 40 ) );
+}
+
+
+INSTANTIATE_TEST_SUITE_P( SSE2, StringOpsTests, ::testing::Values( false, true ) );